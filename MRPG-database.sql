@@ -411,6 +411,19 @@ CREATE TABLE `tw_auction_items` (
 
 -- --------------------------------------------------------
 
+--
+-- Структура таблицы `tw_bank_journal`
+--
+
+CREATE TABLE `tw_bank_journal` (
+  `Kind` int(11) NOT NULL,
+  `OwnerID` int(11) NOT NULL,
+  `Seq` bigint(20) NOT NULL,
+  `Delta` bigint(20) NOT NULL
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4;
+
+-- --------------------------------------------------------
+
 --
 -- Структура таблицы `tw_bots_info`
 --
@@ -1591,6 +1604,12 @@ ALTER TABLE `tw_auction_items`
   ADD KEY `Time` (`ValidUntil`),
   ADD KEY `Price` (`Price`);
 
+--
+-- Индексы таблицы `tw_bank_journal`
+--
+ALTER TABLE `tw_bank_journal`
+  ADD PRIMARY KEY (`Kind`,`OwnerID`,`Seq`);
+
 --
 -- Индексы таблицы `tw_bots_info`
 --
@@ -1667,6 +1686,7 @@ ALTER TABLE `tw_dungeons_door`
 --
 ALTER TABLE `tw_dungeons_records`
   ADD PRIMARY KEY (`ID`),
+  ADD UNIQUE KEY `UserDungeon` (`UserID`,`DungeonID`),
   ADD KEY `tw_dungeons_records_ibfk_1` (`UserID`),
   ADD KEY `DungeonID` (`DungeonID`),
   ADD KEY `Seconds` (`Seconds`);
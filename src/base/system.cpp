@@ -161,6 +161,18 @@ void net_buffer_init(NETSOCKET_BUFFER *buffer);
 void net_buffer_reinit(NETSOCKET_BUFFER *buffer);
 void net_buffer_simple(NETSOCKET_BUFFER *buffer, char **buf, int *size);
 
+#ifdef CONF_PLATFORM_LINUX
+typedef struct
+{
+	int count;
+	int socks[VLEN];
+	struct mmsghdr msgs[VLEN];
+	struct iovec iovecs[VLEN];
+	char bufs[VLEN][PACKETSIZE];
+	char sockaddrs[VLEN][128];
+} NETSOCKET_SEND_QUEUE;
+#endif
+
 struct NETSOCKET_INTERNAL
 {
 	int type;
@@ -169,6 +181,9 @@ struct NETSOCKET_INTERNAL
 	int web_ipv4sock;
 
 	NETSOCKET_BUFFER buffer;
+#ifdef CONF_PLATFORM_LINUX
+	NETSOCKET_SEND_QUEUE *send_queue;
+#endif
 };
 static NETSOCKET_INTERNAL invalid_socket = {NETTYPE_INVALID, -1, -1, -1};
 
@@ -1444,6 +1459,9 @@ static int priv_net_close_all_sockets(NETSOCKET sock)
 		sock->type &= ~NETTYPE_IPV6;
 	}
 
+#if defined(CONF_PLATFORM_LINUX)
+	free(sock->send_queue);
+#endif
 	free(sock);
 	return 0;
 }
@@ -1623,6 +1641,32 @@ NETSOCKET net_udp_create(NETADDR bindaddr)
 	return sock;
 }
 
+static int priv_net_udp_sendto(NETSOCKET sock, int fd, const void *data, int size, const struct sockaddr *sa, int sa_len)
+{
+#if defined(CONF_PLATFORM_LINUX)
+	NETSOCKET_SEND_QUEUE *queue = sock->send_queue;
+	if(queue && size <= PACKETSIZE && sa_len <= (int)sizeof(queue->sockaddrs[0]))
+	{
+		if(queue->count >= VLEN)
+			net_udp_flush(sock);
+
+		int i = queue->count++;
+		mem_copy(queue->bufs[i], data, size);
+		mem_copy(queue->sockaddrs[i], sa, sa_len);
+		queue->iovecs[i].iov_len = size;
+		queue->msgs[i].msg_hdr.msg_namelen = sa_len;
+		queue->socks[i] = fd;
+		return size;
+	}
+
+	// keep the packet order when something can't be queued
+	if(queue)
+		net_udp_flush(sock);
+#endif
+	network_stats.sent_calls++;
+	return sendto(fd, (const char *)data, size, 0, sa, sa_len);
+}
+
 int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size)
 {
 	int d = -1;
@@ -1642,7 +1686,7 @@ int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size
 			else
 				netaddr_to_sockaddr_in(addr, &sa);
 
-			d = sendto((int)sock->ipv4sock, (const char *)data, size, 0, (struct sockaddr *)&sa, sizeof(sa));
+			d = priv_net_udp_sendto(sock, (int)sock->ipv4sock, data, size, (struct sockaddr *)&sa, sizeof(sa));
 		}
 		else
 			dbg_msg("net", "can't send ipv4 traffic to this socket");
@@ -1680,7 +1724,7 @@ int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size
 			else
 				netaddr_to_sockaddr_in6(addr, &sa);
 
-			d = sendto((int)sock->ipv6sock, (const char *)data, size, 0, (struct sockaddr *)&sa, sizeof(sa));
+			d = priv_net_udp_sendto(sock, (int)sock->ipv6sock, data, size, (struct sockaddr *)&sa, sizeof(sa));
 		}
 		else
 			dbg_msg("net", "can't send ipv6 traffic to this socket");
@@ -1706,6 +1750,69 @@ int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size
 	return d;
 }
 
+void net_udp_set_send_batching(NETSOCKET sock, bool enabled)
+{
+#if defined(CONF_PLATFORM_LINUX)
+	if(!enabled)
+	{
+		net_udp_flush(sock);
+		free(sock->send_queue);
+		sock->send_queue = nullptr;
+		return;
+	}
+
+	if(sock->send_queue)
+		return;
+
+	NETSOCKET_SEND_QUEUE *queue = (NETSOCKET_SEND_QUEUE *)calloc(1, sizeof(NETSOCKET_SEND_QUEUE));
+	for(int i = 0; i < VLEN; ++i)
+	{
+		queue->iovecs[i].iov_base = queue->bufs[i];
+		queue->msgs[i].msg_hdr.msg_iov = &(queue->iovecs[i]);
+		queue->msgs[i].msg_hdr.msg_iovlen = 1;
+		queue->msgs[i].msg_hdr.msg_name = &(queue->sockaddrs[i]);
+	}
+	sock->send_queue = queue;
+#endif
+}
+
+int net_udp_flush(NETSOCKET sock)
+{
+#if defined(CONF_PLATFORM_LINUX)
+	NETSOCKET_SEND_QUEUE *queue = sock->send_queue;
+	if(!queue || !queue->count)
+		return 0;
+
+	int sent = 0;
+	for(int start = 0; start < queue->count;)
+	{
+		// one call for each run of packets going out through the same socket
+		int end = start + 1;
+		while(end < queue->count && queue->socks[end] == queue->socks[start])
+			end++;
+
+		for(int pos = start; pos < end;)
+		{
+			network_stats.sent_calls++;
+			int result = sendmmsg(queue->socks[start], &queue->msgs[pos], end - pos, 0);
+			if(result <= 0)
+			{
+				// the packet at pos failed, drop it like a failed sendto
+				pos++;
+				continue;
+			}
+			pos += result;
+			sent += result;
+		}
+		start = end;
+	}
+	queue->count = 0;
+	return sent;
+#else
+	return 0;
+#endif
+}
+
 void net_buffer_init(NETSOCKET_BUFFER *buffer)
 {
 #if defined(CONF_PLATFORM_LINUX)
@@ -1759,6 +1866,7 @@ int net_udp_recv(NETSOCKET sock, NETADDR *addr, unsigned char **data)
 		if(sock->buffer.pos >= sock->buffer.size)
 		{
 			net_buffer_reinit(&sock->buffer);
+			network_stats.recv_calls++;
 			sock->buffer.size = recvmmsg(sock->ipv4sock, sock->buffer.msgs, VLEN, 0, NULL);
 			sock->buffer.pos = 0;
 		}
@@ -1769,6 +1877,7 @@ int net_udp_recv(NETSOCKET sock, NETADDR *addr, unsigned char **data)
 		if(sock->buffer.pos >= sock->buffer.size)
 		{
 			net_buffer_reinit(&sock->buffer);
+			network_stats.recv_calls++;
 			sock->buffer.size = recvmmsg(sock->ipv6sock, sock->buffer.msgs, VLEN, 0, NULL);
 			sock->buffer.pos = 0;
 		}
@@ -1788,6 +1897,7 @@ int net_udp_recv(NETSOCKET sock, NETADDR *addr, unsigned char **data)
 	if(sock->ipv4sock >= 0)
 	{
 		socklen_t fromlen = sizeof(struct sockaddr_in);
+		network_stats.recv_calls++;
 		bytes = recvfrom(sock->ipv4sock, sock->buffer.buf, sizeof(sock->buffer.buf), 0, (struct sockaddr *)&sockaddrbuf, &fromlen);
 		*data = (unsigned char *)sock->buffer.buf;
 	}
@@ -1795,6 +1905,7 @@ int net_udp_recv(NETSOCKET sock, NETADDR *addr, unsigned char **data)
 	if(bytes <= 0 && sock->ipv6sock >= 0)
 	{
 		socklen_t fromlen = sizeof(struct sockaddr_in6);
+		network_stats.recv_calls++;
 		bytes = recvfrom(sock->ipv6sock, sock->buffer.buf, sizeof(sock->buffer.buf), 0, (struct sockaddr *)&sockaddrbuf, &fromlen);
 		*data = (unsigned char *)sock->buffer.buf;
 	}
@@ -937,6 +937,31 @@ NETSOCKET net_udp_create(NETADDR bindaddr);
  */
 int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size);
 
+/**
+ * Enables or disables batching of outgoing packets on an UDP socket.
+ *
+ * @ingroup Network-UDP
+ *
+ * @param sock Socket to use.
+ * @param enabled Whether to batch.
+ *
+ * @remark While enabled, net_udp_send queues the packets until net_udp_flush
+ * is called or the queue is full, and sends them with a single sendmmsg call.
+ * Only supported on Linux, other platforms always send right away.
+ */
+void net_udp_set_send_batching(NETSOCKET sock, bool enabled);
+
+/**
+ * Sends all packets queued on an UDP socket with batching enabled.
+ *
+ * @ingroup Network-UDP
+ *
+ * @param sock Socket to use.
+ *
+ * @return The number of packets sent.
+ */
+int net_udp_flush(NETSOCKET sock);
+
 /*
 	Function: net_udp_recv
 		Receives a packet over an UDP socket.
@@ -2178,6 +2203,8 @@ typedef struct
 	uint64_t sent_bytes;
 	uint64_t recv_packets;
 	uint64_t recv_bytes;
+	uint64_t sent_calls;
+	uint64_t recv_calls;
 } NETSTATS;
 
 void net_stats(NETSTATS *stats);
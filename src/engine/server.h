@@ -7,6 +7,8 @@
 #include "message.h"
 #include <engine/shared/world_detail.h>
 
+class CJsonWriter;
+
 #define DC_SERVER_INFO 13872503
 #define DC_PLAYER_INFO 1346299
 #define DC_JOIN_LEAVE 14494801
@@ -218,6 +220,7 @@ public:
 	virtual const char* Localize(int ClientID, const char* pText) = 0;
 	virtual void SetClientLanguage(int ClientID, const char* pLanguage) = 0;
 	virtual const char* GetClientLanguage(int ClientID) const = 0;
+	virtual int GetClientLanguageIndex(int ClientID) const = 0;
 
 	// discord
 	virtual void SendDiscordMessage(const char *pChannel, int Color, const char* pTitle, const char* pText) = 0;
@@ -231,6 +234,8 @@ public:
 	// snapshots
 	virtual int SnapNewID() = 0;
 	virtual void SnapFreeID(int ID) = 0;
+	virtual int SnapNewIDBlock(int Num) = 0;
+	virtual void SnapFreeIDBlock(int ID) = 0;
 	virtual void *SnapNewItem(int Type, int ID, int Size) = 0;
 	virtual void SnapSetStaticsize(int ItemType, int Size) = 0;
 
@@ -267,6 +272,7 @@ public:
 
 	virtual void OnTick() = 0;
 	virtual void OnTickGlobal() = 0;
+	virtual void OnWakeUp(int SkippedTicks) = 0;
 	virtual void OnPreSnap() = 0;
 	virtual void OnSnap(int ClientID) = 0;
 	virtual void OnPostSnap() = 0;
@@ -297,10 +303,10 @@ public:
 	/**
 	 * Used to report custom player info to master servers.
 	 *
-	 * @param aBuf Should be the json key values to add, starting with a ',' beforehand, like: ',"skin": "default", "team": 1'
-	 * @param i The client id.
+	 * @param pJson The writer inside the player object, attributes written here are added to it.
+	 * @param ClientID The client id.
 	 */
-	virtual void OnUpdatePlayerServerInfo(nlohmann::json* pJson, int ClientID) = 0;
+	virtual void OnUpdatePlayerServerInfo(CJsonWriter* pJson, int ClientID) = 0;
 };
 
 namespace Instance
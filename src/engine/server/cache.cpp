@@ -10,17 +10,36 @@ CBrowserCache::~CBrowserCache()
 	Clear();
 }
 
-CBrowserCache::CChunk::CChunk(const void* pData, int Size)
+CBrowserCache::CChunk::CChunk(const unsigned char* pType, const void* pData, int Size)
 {
-	m_vData.assign((const uint8_t*)pData, (const uint8_t*)pData + Size);
+	m_pType = pType;
+	m_vData.resize(HEADER_SPACE);
+	m_vData.insert(m_vData.end(), (const uint8_t*)pData, (const uint8_t*)pData + Size);
 }
 
-void CBrowserCache::AddChunk(const void* pData, int Size)
+const uint8_t* CBrowserCache::CChunk::Prepare(int Token, int* pSize)
 {
-	m_vCache.emplace_back(pData, Size);
+	char aToken[16];
+	str_from_int(Token, aToken);
+	const int TokenSize = str_length(aToken) + 1;
+
+	const int Start = HEADER_SPACE - (6 + sizeof(SERVERBROWSE_INFO) + TokenSize);
+	uint8_t* pDatagram = m_vData.data() + Start;
+	for(int i = 0; i < 6; i++)
+		pDatagram[i] = 0xff;
+	mem_copy(pDatagram + 6, m_pType, sizeof(SERVERBROWSE_INFO));
+	mem_copy(pDatagram + 6 + sizeof(SERVERBROWSE_INFO), aToken, TokenSize);
+
+	*pSize = (int)m_vData.size() - Start;
+	return pDatagram;
+}
+
+void CBrowserCache::AddChunk(const unsigned char* pType, const void* pData, int Size)
+{
+	m_vCache.emplace_back(pType, pData, Size);
 }
 
 void CBrowserCache::Clear()
 {
 	m_vCache.clear();
-}
\ No newline at end of file
+}
@@ -1,16 +1,28 @@
 #ifndef ENGINE_SERVER_CBROWSERCACHE_H
 #define ENGINE_SERVER_CBROWSERCACHE_H
 
+#include <mastersrv/mastersrv.h>
+
 class CBrowserCache
 {
 public:
+	enum
+	{
+		// connless header, response type and the longest token string in front of the payload
+		HEADER_SPACE = 6 + sizeof(SERVERBROWSE_INFO) + 12,
+	};
+
 	class CChunk
 	{
 	public:
-		CChunk(const void* pData, int Size);
+		CChunk(const unsigned char* pType, const void* pData, int Size);
 		CChunk(const CChunk&) = delete;
 		CChunk(CChunk&&) = default;
 
+		// writes the header and token right in front of the payload, returns the whole datagram
+		const uint8_t* Prepare(int Token, int* pSize);
+
+		const unsigned char* m_pType;
 		std::vector<uint8_t> m_vData;
 	};
 
@@ -19,8 +31,8 @@ public:
 	CBrowserCache();
 	~CBrowserCache();
 
-	void AddChunk(const void* pData, int Size);
+	void AddChunk(const unsigned char* pType, const void* pData, int Size);
 	void Clear();
 };
 
-#endif
\ No newline at end of file
+#endif
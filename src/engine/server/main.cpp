@@ -170,7 +170,7 @@ int main(int argc, const char** argv)
 		IOHANDLE Logfile = pStorage->OpenFile(g_Config.m_Logfile, Mode, IStorageEngine::TYPE_SAVE_OR_ABSOLUTE);
 		if(Logfile)
 		{
-			pFutureFileLogger->Set(log_logger_file(Logfile));
+			pFutureFileLogger->Set(std::make_shared<CServerFileLogger>(Logfile));
 		}
 		else
 		{
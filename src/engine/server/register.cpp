@@ -14,6 +14,9 @@
 #include <engine/shared/packer.h>
 #include <engine/shared/uuid_manager.h>
 
+#include <memory>
+#include <string>
+
 class CRegister : public IRegister
 {
 	enum
@@ -43,6 +46,8 @@ class CRegister : public IRegister
 		CLock m_Lock;
 		int m_InfoSerial GUARDED_BY(m_Lock) = -1;
 		int m_LatestSuccessfulInfoSerial GUARDED_BY(m_Lock) = -1;
+		// only the latest info is kept, requests take whatever is newest when they run
+		std::shared_ptr<const std::string> m_pInfo GUARDED_BY(m_Lock);
 	};
 
 	class CProtocol
@@ -67,17 +72,16 @@ class CRegister : public IRegister
 			int m_Protocol;
 			int m_ServerPort;
 			int m_Index;
-			int m_InfoSerial;
+			int m_InfoSerial = -1;
 			std::shared_ptr<CShared> m_pShared;
 			std::unique_ptr<CHttpRequest> m_pRegister;
 			void Run() override;
 
 		public:
-			CJob(int Protocol, int ServerPort, int Index, int InfoSerial, std::shared_ptr<CShared> pShared, std::unique_ptr<CHttpRequest>&& pRegister) :
+			CJob(int Protocol, int ServerPort, int Index, std::shared_ptr<CShared> pShared, std::unique_ptr<CHttpRequest>&& pRegister) :
 				m_Protocol(Protocol),
 				m_ServerPort(ServerPort),
 				m_Index(Index),
-				m_InfoSerial(InfoSerial),
 				m_pShared(std::move(pShared)),
 				m_pRegister(std::move(pRegister))
 			{
@@ -126,7 +130,6 @@ class CRegister : public IRegister
 	CUuid m_Secret = RandomUuid();
 	CUuid m_ChallengeSecret = RandomUuid();
 	bool m_GotServerInfo = false;
-	char m_aServerInfo[16384];
 
 public:
 	CRegister(CConfig* pConfig, IConsole* pConsole, IEngine* pEngine, int ServerPort, unsigned SixupSecurityToken);
@@ -245,24 +248,10 @@ void CRegister::CProtocol::SendRegister()
 	FormatUuid(m_pParent->m_ChallengeSecret, aChallengeUuid, sizeof(aChallengeUuid));
 	char aChallengeSecret[64];
 	str_format(aChallengeSecret, sizeof(aChallengeSecret), "%s:%s", aChallengeUuid, ProtocolToString(m_Protocol));
-	int InfoSerial;
-	bool SendInfo;
 
-	{
-		CLockScope ls(m_pShared->m_pGlobal->m_Lock);
-		InfoSerial = m_pShared->m_pGlobal->m_InfoSerial;
-		SendInfo = InfoSerial > m_pShared->m_pGlobal->m_LatestSuccessfulInfoSerial;
-	}
-
-	std::unique_ptr<CHttpRequest> pRegister;
-	if(SendInfo)
-	{
-		pRegister = HttpPostJson(m_pParent->m_pConfig->m_SvRegisterUrl, m_pParent->m_aServerInfo);
-	}
-	else
-	{
-		pRegister = HttpPost(m_pParent->m_pConfig->m_SvRegisterUrl, (unsigned char*)"", 0);
-	}
+	// the body and the info serial are filled in by the job
+	std::unique_ptr<CHttpRequest> pRegister = std::make_unique<CHttpRequest>(m_pParent->m_pConfig->m_SvRegisterUrl);
+	pRegister->Timeout(CTimeout { 4000, 15000, 500, 5 });
 	pRegister->HeaderString("Address", aAddress);
 	pRegister->HeaderString("Secret", aSecret);
 	pRegister->HeaderString("Challenge-Secret", aChallengeSecret);
@@ -270,7 +259,6 @@ void CRegister::CProtocol::SendRegister()
 	{
 		pRegister->HeaderString("Challenge-Token", m_aChallengeToken);
 	}
-	pRegister->HeaderInt("Info-Serial", InfoSerial);
 	for(int i = 0; i < m_pParent->m_NumExtraHeaders; i++)
 	{
 		pRegister->Header(m_pParent->m_aaExtraHeaders[i]);
@@ -288,7 +276,7 @@ void CRegister::CProtocol::SendRegister()
 		RequestIndex = m_pShared->m_NumTotalRequests;
 		m_pShared->m_NumTotalRequests += 1;
 	}
-	m_pParent->m_pEngine->AddJob(std::make_shared<CJob>(m_Protocol, m_pParent->m_ServerPort, RequestIndex, InfoSerial, m_pShared, std::move(pRegister)));
+	m_pParent->m_pEngine->AddJob(std::make_shared<CJob>(m_Protocol, m_pParent->m_ServerPort, RequestIndex, m_pShared, std::move(pRegister)));
 	m_NewChallengeToken = false;
 
 	m_PrevRegister = Now;
@@ -384,6 +372,26 @@ void CRegister::CProtocol::OnToken(const char* pToken)
 
 void CRegister::CProtocol::CJob::Run()
 {
+	// infos published while this job waited collapse into the newest one
+	std::shared_ptr<const std::string> pInfo;
+	{
+		CLockScope ls(m_pShared->m_pGlobal->m_Lock);
+		m_InfoSerial = m_pShared->m_pGlobal->m_InfoSerial;
+		if(m_InfoSerial > m_pShared->m_pGlobal->m_LatestSuccessfulInfoSerial)
+		{
+			pInfo = m_pShared->m_pGlobal->m_pInfo;
+		}
+	}
+	if(pInfo)
+	{
+		m_pRegister->PostJson(pInfo->c_str());
+	}
+	else
+	{
+		m_pRegister->Post((const unsigned char*)"", 0);
+	}
+	m_pRegister->HeaderInt("Info-Serial", m_InfoSerial);
+
 	IEngine::RunJobBlocking(m_pRegister.get());
 	if(m_pRegister->State() != HTTP_DONE)
 	{
@@ -638,15 +646,12 @@ bool CRegister::OnPacket(const CNetChunk* pPacket)
 void CRegister::OnNewInfo(const char* pInfo)
 {
 	log_trace("register", "info: %s", pInfo);
-	if(m_GotServerInfo && str_comp(m_aServerInfo, pInfo) == 0)
-	{
-		return;
-	}
+	std::shared_ptr<const std::string> pNewInfo = std::make_shared<const std::string>(pInfo);
 
 	m_GotServerInfo = true;
-	str_copy(m_aServerInfo, pInfo);
 	{
 		CLockScope ls(m_pGlobal->m_Lock);
+		m_pGlobal->m_pInfo = std::move(pNewInfo);
 		m_pGlobal->m_InfoSerial += 1;
 	}
 
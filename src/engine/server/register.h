@@ -18,7 +18,8 @@ public:
 	// Returns `true` if the packet was a packet related to registering
 	// code and doesn't have to processed furtherly.
 	virtual bool OnPacket(const CNetChunk* pPacket) = 0;
-	// `pInfo` must be an encoded JSON object.
+	// `pInfo` must be an encoded JSON object, only pass it when it changed.
+	// It is copied once, the requests pick it up on the job threads.
 	virtual void OnNewInfo(const char* pInfo) = 0;
 	virtual void OnShutdown() = 0;
 };
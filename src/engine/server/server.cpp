@@ -17,6 +17,7 @@
 #include <engine/shared/json.h>
 #include <engine/shared/http.h>
 #include <engine/shared/network.h>
+#include <engine/shared/network_thread.h>
 #include <engine/shared/packer.h>
 #include <engine/shared/protocol.h>
 #include <engine/shared/protocol_ex.h>
@@ -76,6 +77,9 @@ CServer::CServer()
 	m_ServerInfoFirstRequest = 0;
 	m_ServerInfoNumRequests = 0;
 	m_ServerInfoNeedsUpdate = false;
+	m_ServerInfoSignature = 0;
+	m_RegisterInfoHash = 0;
+	mem_zero(m_aServerInfoRequests, sizeof(m_aServerInfoRequests));
 
 	m_pServerBan = new CServerBan;
 	m_pMultiWorlds = new CMultiWorlds;
@@ -279,7 +283,11 @@ void CServer::SetClientScore(int ClientID, int Score)
 	if(ClientID < 0 || ClientID >= MAX_CLIENTS || m_aClients[ClientID].m_State < CClient::STATE_READY)
 		return;
 
-	m_aClients[ClientID].m_Score = Score;
+	if(m_aClients[ClientID].m_Score != Score)
+	{
+		m_aClients[ClientID].m_Score = Score;
+		ExpireServerInfo();
+	}
 }
 
 void CServer::SetClientNameChangeRequest(int ClientID, const char* pName)
@@ -303,7 +311,7 @@ const char* CServer::Localize(int ClientID, const char* pText)
 	if(ClientID < 0 || ClientID >= MAX_CLIENTS || m_aClients[ClientID].m_State < CClient::STATE_READY)
 		return nullptr;
 
-	return m_pLocalization->Localize(m_aClients[ClientID].m_aLanguage, pText);
+	return m_pLocalization->Localize(m_aClients[ClientID].m_LanguageIndex, pText);
 }
 
 void CServer::SetClientLanguage(int ClientID, const char* pLanguage)
@@ -312,6 +320,7 @@ void CServer::SetClientLanguage(int ClientID, const char* pLanguage)
 		return;
 
 	str_copy(m_aClients[ClientID].m_aLanguage, pLanguage, sizeof(m_aClients[ClientID].m_aLanguage));
+	m_aClients[ClientID].m_LanguageIndex = m_pLocalization->GetLanguageIndex(pLanguage);
 }
 
 bool CServer::IsClientChangesWorld(int ClientID)
@@ -355,6 +364,13 @@ const char* CServer::GetClientLanguage(int ClientID) const
 	return m_aClients[ClientID].m_aLanguage;
 }
 
+int CServer::GetClientLanguageIndex(int ClientID) const
+{
+	if(ClientID < 0 || ClientID >= MAX_CLIENTS || m_aClients[ClientID].m_State < CClient::STATE_READY)
+		return m_pLocalization->GetLanguageIndex("en");
+	return m_aClients[ClientID].m_LanguageIndex;
+}
+
 void CServer::ChangeWorld(int ClientID, int NewWorldID)
 {
 	if(ClientID < 0 || ClientID >= MAX_PLAYERS || NewWorldID == m_aClients[ClientID].m_WorldID || !MultiWorlds()->IsValid(NewWorldID) || m_aClients[ClientID].m_State < CClient::STATE_READY)
@@ -363,7 +379,9 @@ void CServer::ChangeWorld(int ClientID, int NewWorldID)
 	m_aClients[ClientID].m_OldWorldID = m_aClients[ClientID].m_WorldID;
 	GameServer(m_aClients[ClientID].m_OldWorldID)->PrepareClientChangeWorld(ClientID);
 
+	// the catch-up of a dormant world runs with its next tick, before the player finished loading
 	m_aClients[ClientID].m_WorldID = NewWorldID;
+	m_aWorldDormancy[NewWorldID].Wake(Tick());
 	GameServer(m_aClients[ClientID].m_WorldID)->PrepareClientChangeWorld(ClientID);
 
 	int* pIdMap = GetIdMap(ClientID);
@@ -473,6 +491,7 @@ int CServer::Init()
 	for(int i = 0; i < MAX_PLAYERS; i++)
 	{
 		str_copy(m_aClients[i].m_aLanguage, "en", sizeof(m_aClients[i].m_aLanguage));
+		m_aClients[i].m_LanguageIndex = -1; // main language, localization isn't created yet on construction
 		m_aClients[i].m_State = CClient::STATE_EMPTY;
 		m_aClients[i].m_aName[0] = 0;
 		m_aClients[i].m_aClan[0] = 0;
@@ -834,28 +853,37 @@ void CServer::DoSnapshot(int WorldID)
 					int Chunk = Left < MaxSize ? Left : MaxSize;
 					Left -= Chunk;
 
+					// pack the message straight into the outgoing packet of the connection
+					unsigned char* pStart = m_NetServer.SendBegin(i, Chunk + MAX_SNAPSHOT_HEADERSIZE);
+					if(!pStart)
+						break;
+
+					unsigned char* pDst = pStart;
+					unsigned char* pEnd = pStart + Chunk + MAX_SNAPSHOT_HEADERSIZE;
+					auto PackInt = [&](int Value) { pDst = CVariableInt::Pack(pDst, Value, (int)(pEnd - pDst)); };
 					if(NumPackets == 1)
 					{
-						CMsgPacker Msg(NETMSG_SNAPSINGLE, true);
-						Msg.AddInt(m_CurrentGameTick);
-						Msg.AddInt(m_CurrentGameTick - DeltaTick);
-						Msg.AddInt(Crc);
-						Msg.AddInt(Chunk);
-						Msg.AddRaw(&aCompData[n * MaxSize], Chunk);
-						SendMsg(&Msg, MSGFLAG_FLUSH, i, -1, WorldID);
+						PackInt((NETMSG_SNAPSINGLE << 1) | 1);
+						PackInt(m_CurrentGameTick);
+						PackInt(m_CurrentGameTick - DeltaTick);
+						PackInt(Crc);
+						PackInt(Chunk);
 					}
 					else
 					{
-						CMsgPacker Msg(NETMSG_SNAP, true);
-						Msg.AddInt(m_CurrentGameTick);
-						Msg.AddInt(m_CurrentGameTick - DeltaTick);
-						Msg.AddInt(NumPackets);
-						Msg.AddInt(n);
-						Msg.AddInt(Crc);
-						Msg.AddInt(Chunk);
-						Msg.AddRaw(&aCompData[n * MaxSize], Chunk);
-						SendMsg(&Msg, MSGFLAG_FLUSH, i, -1, WorldID);
+						PackInt((NETMSG_SNAP << 1) | 1);
+						PackInt(m_CurrentGameTick);
+						PackInt(m_CurrentGameTick - DeltaTick);
+						PackInt(NumPackets);
+						PackInt(n);
+						PackInt(Crc);
+						PackInt(Chunk);
 					}
+					mem_copy(pDst, &aCompData[n * MaxSize], Chunk);
+					pDst += Chunk;
+					m_SnapshotBytesCopied += Chunk;
+
+					m_NetServer.SendEnd(i, (int)(pDst - pStart), NETSENDFLAG_FLUSH);
 				}
 			}
 			else
@@ -918,6 +946,7 @@ int CServer::NewClientCallback(int ClientID, void* pUser)
 
 	pThis->GameServer(MAIN_WORLD_ID)->ClearClientData(ClientID);
 	str_copy(pThis->m_aClients[ClientID].m_aLanguage, "en", sizeof(pThis->m_aClients[ClientID].m_aLanguage));
+	pThis->m_aClients[ClientID].m_LanguageIndex = pThis->m_pLocalization->GetLanguageIndex("en");
 	pThis->m_aClients[ClientID].m_State = CClient::STATE_AUTH;
 	pThis->m_aClients[ClientID].m_aName[0] = 0;
 	pThis->m_aClients[ClientID].m_aClan[0] = 0;
@@ -1644,10 +1673,22 @@ void CServer::CacheServerInfo(CBrowserCache* pCache, int Type, bool SendClients)
 	int ChunksStored = 0;
 	int PlayersStored = 0;
 
+	const unsigned char* pResponseType;
+	switch(Type)
+	{
+		case SERVERINFO_EXTENDED: pResponseType = SERVERBROWSE_INFO_EXTENDED; break;
+		case SERVERINFO_64_LEGACY: pResponseType = SERVERBROWSE_INFO_64_LEGACY; break;
+		case SERVERINFO_VANILLA:
+		case SERVERINFO_INGAME: pResponseType = SERVERBROWSE_INFO; break;
+		default: dbg_assert(false, "unknown serverinfo type"); return;
+	}
+
 #define SAVE(size) \
 	do \
 	{ \
-		pCache->AddChunk(q.Data(), size); \
+		pCache->AddChunk(pResponseType, q.Data(), size); \
+		if(Type == SERVERINFO_EXTENDED) \
+			pResponseType = SERVERBROWSE_INFO_EXTENDED_MORE; \
 		ChunksStored++; \
 	} while(0)
 
@@ -1771,38 +1812,102 @@ void CServer::UpdateRegisterServerInfo()
 
 	sha256_str(MultiWorlds()->GetWorld(MAIN_WORLD_ID)->MapDetail()->GetSha256(), aMapSha256, sizeof(aMapSha256));
 
-	nlohmann::json JsServerInfo;
-	JsServerInfo["max_clients"] = MaxClients;
-	JsServerInfo["max_players"] = MaxPlayers;
-	JsServerInfo["passworded"] = g_Config.m_Password[0] != '\0';
-	JsServerInfo["game_type"] = "MRPG";
-	JsServerInfo["name"] = g_Config.m_SvName;
-
-	JsServerInfo["map"]["name"] = "Multiworld";
-	JsServerInfo["map"]["sha256"] = aMapSha256;
-	JsServerInfo["map"]["size"] = MultiWorlds()->GetWorld(MAIN_WORLD_ID)->MapDetail()->GetSize();
-
-	JsServerInfo["version"] = GameServer()->Version();
-	JsServerInfo["game_type"] = "MRPG";
-	JsServerInfo["client_score_kind"] = "points";
-
+	// streamed into the same buffer every time
+	CJsonBufferWriter& Json = m_RegisterInfo;
+	Json.Clear();
+	Json.BeginObject();
+	Json.WriteAttribute("max_clients");
+	Json.WriteIntValue(MaxClients);
+	Json.WriteAttribute("max_players");
+	Json.WriteIntValue(MaxPlayers);
+	Json.WriteAttribute("passworded");
+	Json.WriteBoolValue(g_Config.m_Password[0] != '\0');
+	Json.WriteAttribute("game_type");
+	Json.WriteStrValue("MRPG");
+	Json.WriteAttribute("name");
+	Json.WriteStrValue(g_Config.m_SvName);
+
+	Json.WriteAttribute("map");
+	Json.BeginObject();
+	Json.WriteAttribute("name");
+	Json.WriteStrValue("Multiworld");
+	Json.WriteAttribute("sha256");
+	Json.WriteStrValue(aMapSha256);
+	Json.WriteAttribute("size");
+	Json.WriteIntValue(MultiWorlds()->GetWorld(MAIN_WORLD_ID)->MapDetail()->GetSize());
+	Json.EndObject();
+
+	Json.WriteAttribute("version");
+	Json.WriteStrValue(GameServer()->Version());
+	Json.WriteAttribute("client_score_kind");
+	Json.WriteStrValue("points");
+
+	Json.WriteAttribute("clients");
+	Json.BeginArray();
 	for(int i = 0; i < MAX_PLAYERS; i++)
 	{
 		if(m_aClients[i].m_State != CClient::STATE_EMPTY)
 		{
-			nlohmann::json JsPlayerInfo;
-			JsPlayerInfo["name"] = ClientName(i);
-			JsPlayerInfo["clan"] = ClientClan(i);
-			JsPlayerInfo["country"] = m_aClients[i].m_Country;
-			JsPlayerInfo["score"] = m_aClients[i].m_Score;
-			JsPlayerInfo["is_player"] = GameServer()->IsClientPlayer(i);
-			GameServer()->OnUpdatePlayerServerInfo(&JsPlayerInfo, i);
-
-			JsServerInfo["clients"].push_back(JsPlayerInfo);
+			Json.BeginObject();
+			Json.WriteAttribute("name");
+			Json.WriteStrValue(ClientName(i));
+			Json.WriteAttribute("clan");
+			Json.WriteStrValue(ClientClan(i));
+			Json.WriteAttribute("country");
+			Json.WriteIntValue(m_aClients[i].m_Country);
+			Json.WriteAttribute("score");
+			Json.WriteIntValue(m_aClients[i].m_Score);
+			Json.WriteAttribute("is_player");
+			Json.WriteBoolValue(GameServer()->IsClientPlayer(i));
+			GameServer()->OnUpdatePlayerServerInfo(&Json, i);
+			Json.EndObject();
 		}
 	}
+	Json.EndArray();
+	Json.EndObject();
+
+	// the register only hears of documents with other content
+	uint64_t Hash = 14695981039346656037ull;
+	const char* pData = Json.GetOutput();
+	for(int i = 0; i < Json.GetOutputLength(); i++)
+		Hash = (Hash ^ (unsigned char)pData[i]) * 1099511628211ull;
+	if(Hash == m_RegisterInfoHash)
+		return;
 
-	m_pRegister->OnNewInfo(JsServerInfo.dump(-1).c_str());
+	m_RegisterInfoHash = Hash;
+	m_pRegister->OnNewInfo(Json.GetOutput());
+}
+
+uint64_t CServer::ServerInfoSignature()
+{
+	uint64_t Hash = 14695981039346656037ull;
+	auto Add = [&Hash](const void* pData, int Size) {
+		for(int i = 0; i < Size; i++)
+			Hash = (Hash ^ ((const unsigned char*)pData)[i]) * 1099511628211ull;
+	};
+	auto AddString = [&Add](const char* pStr) { Add(pStr, str_length(pStr) + 1); };
+	auto AddInt = [&Add](int Value) { Add(&Value, sizeof(Value)); };
+
+	AddString(g_Config.m_SvName);
+	AddString(g_Config.m_SvMap);
+	AddInt(g_Config.m_Password[0] != '\0');
+	AddInt(m_NetServer.MaxClients());
+	AddInt(MultiWorlds()->GetWorld(MAIN_WORLD_ID)->MapDetail()->GetCrc());
+	AddInt(MultiWorlds()->GetWorld(MAIN_WORLD_ID)->MapDetail()->GetSize());
+
+	for(int i = 0; i < MAX_PLAYERS; i++)
+	{
+		if(m_aClients[i].m_State == CClient::STATE_EMPTY)
+			continue;
+
+		AddInt(i);
+		AddString(ClientName(i));
+		AddString(ClientClan(i));
+		AddInt(m_aClients[i].m_Country);
+		AddInt(m_aClients[i].m_Score);
+		AddInt(GameServer()->IsClientPlayer(i));
+	}
+	return Hash;
 }
 
 void CServer::UpdateServerInfo(bool Resend)
@@ -1812,10 +1917,16 @@ void CServer::UpdateServerInfo(bool Resend)
 
 	UpdateRegisterServerInfo();
 
-	for(int i = 0; i < 3; i++)
+	// the browser datagrams only depend on what the signature covers
+	const uint64_t Signature = ServerInfoSignature();
+	if(Resend || Signature != m_ServerInfoSignature || m_aServerInfoCache[0].m_vCache.empty())
 	{
-		for(int j = 0; j < 2; j++)
-			CacheServerInfo(&m_aServerInfoCache[i * 2 + j], i, j);
+		for(int i = 0; i < 3; i++)
+		{
+			for(int j = 0; j < 2; j++)
+				CacheServerInfo(&m_aServerInfoCache[i * 2 + j], i, j);
+		}
+		m_ServerInfoSignature = Signature;
 	}
 
 	if(Resend)
@@ -1834,55 +1945,14 @@ void CServer::UpdateServerInfo(bool Resend)
 
 void CServer::SendServerInfo(const NETADDR* pAddr, int Token, int Type, bool SendClients)
 {
-	CPacker p;
-	char aBuf[128];
-	p.Reset();
-
 	CBrowserCache* pCache = &m_aServerInfoCache[GetCacheIndex(Type, SendClients)];
 
-#define ADD_RAW(p, x) (p).AddRaw(x, sizeof(x))
-#define ADD_INT(p, x) \
-	do \
-	{ \
-		str_from_int(x, aBuf); \
-		(p).AddString(aBuf, 0); \
-	} while(0)
-
-	CNetChunk Packet;
-	Packet.m_ClientID = -1;
-	Packet.m_Address = *pAddr;
-	Packet.m_Flags = NETSENDFLAG_CONNLESS;
-
-	for(const auto& Chunk : pCache->m_vCache)
+	// the cached chunks are complete datagrams, only the token has to be filled in
+	for(auto& Chunk : pCache->m_vCache)
 	{
-		p.Reset();
-		if(Type == SERVERINFO_EXTENDED)
-		{
-			if(&Chunk == &pCache->m_vCache.front())
-				p.AddRaw(SERVERBROWSE_INFO_EXTENDED, sizeof(SERVERBROWSE_INFO_EXTENDED));
-			else
-				p.AddRaw(SERVERBROWSE_INFO_EXTENDED_MORE, sizeof(SERVERBROWSE_INFO_EXTENDED_MORE));
-			ADD_INT(p, Token);
-		}
-		else if(Type == SERVERINFO_64_LEGACY)
-		{
-			ADD_RAW(p, SERVERBROWSE_INFO_64_LEGACY);
-			ADD_INT(p, Token);
-		}
-		else if(Type == SERVERINFO_VANILLA || Type == SERVERINFO_INGAME)
-		{
-			ADD_RAW(p, SERVERBROWSE_INFO);
-			ADD_INT(p, Token);
-		}
-		else
-		{
-			dbg_assert(false, "unknown serverinfo type");
-		}
-
-		p.AddRaw(Chunk.m_vData.data(), Chunk.m_vData.size());
-		Packet.m_pData = p.Data();
-		Packet.m_DataSize = p.Size();
-		m_NetServer.Send(&Packet);
+		int Size;
+		const uint8_t* pDatagram = Chunk.Prepare(Token, &Size);
+		net_udp_send(m_NetServer.Socket(), pAddr, pDatagram, Size);
 	}
 }
 
@@ -1908,8 +1978,33 @@ bool CServer::RateLimitServerInfoConnless()
 	return SendClients;
 }
 
+bool CServer::IsRepeatServerInfoRequest(const NETADDR* pAddr, int Type)
+{
+	unsigned Hash = Type * 2654435761u;
+	for(int i = 0; i < (int)sizeof(pAddr->ip); i++)
+		Hash = (Hash ^ pAddr->ip[i]) * 16777619u;
+	Hash = (Hash ^ pAddr->port) * 16777619u;
+
+	CServerInfoRequest& Request = m_aServerInfoRequests[Hash % MAX_SERVERINFO_REQUESTERS];
+	const int64_t Now = Tick();
+	if(Request.m_Type == Type && net_addr_comp(&Request.m_Addr, pAddr) == 0 && Now < Request.m_Tick + TickSpeed())
+		return true;
+
+	Request.m_Addr = *pAddr;
+	Request.m_Type = Type;
+	Request.m_Tick = Now;
+	return false;
+}
+
 void CServer::SendServerInfoConnless(const NETADDR* pAddr, int Token, int Type)
 {
+	// requesters asking again within a second only get the short info and don't use up the budget for complete ones
+	if(IsRepeatServerInfoRequest(pAddr, Type))
+	{
+		SendServerInfo(pAddr, Token, Type, false);
+		return;
+	}
+
 	SendServerInfo(pAddr, Token, Type, RateLimitServerInfoConnless());
 }
 
@@ -2029,6 +2124,17 @@ int CServer::Run(ILogger* pLogger)
 	m_pDiscord = new DiscordJob(this);
 #endif
 
+	// profiled scopes of the main loop
+	m_pProfileSnapshot = CProfiler::Get()->Entry("server/snapshot");
+	m_pProfileNetwork = CProfiler::Get()->Entry("server/network");
+	m_pProfileTickGlobal = CProfiler::Get()->Entry("server/tick global");
+	for(int i = 0; i < ENGINE_MAX_WORLDS; i++)
+	{
+		char aName[32];
+		str_format(aName, sizeof(aName), "w%d/tick", i);
+		m_apProfileWorldTick[i] = CProfiler::Get()->Entry(aName);
+	}
+
 	// start game
 	{
 		bool NonActive = false;
@@ -2042,6 +2148,7 @@ int CServer::Run(ILogger* pLogger)
 		{
 			if(NonActive)
 			{
+				PROFILE_SCOPE(m_pProfileNetwork);
 				PumpNetwork(PacketWaiting);
 			}
 
@@ -2094,11 +2201,30 @@ int CServer::Run(ILogger* pLogger)
 					}
 				}
 
-				MultiWorlds()->GetWorld(MAIN_WORLD_ID)->GameServer()->OnTickGlobal();
+				{
+					PROFILE_SCOPE(m_pProfileTickGlobal);
+					MultiWorlds()->GetWorld(MAIN_WORLD_ID)->GameServer()->OnTickGlobal();
+				}
+
+				// worlds without players go dormant after sv_world_dormancy seconds
+				bool aWorldHasPlayers[ENGINE_MAX_WORLDS] = {};
+				for(int c = 0; c < MAX_PLAYERS; c++)
+				{
+					if(m_aClients[c].m_State != CClient::STATE_EMPTY && MultiWorlds()->IsValid(m_aClients[c].m_WorldID))
+						aWorldHasPlayers[m_aClients[c].m_WorldID] = true;
+				}
+
 				for(int i = 0; i < MultiWorlds()->GetSizeInitilized(); i++)
 				{
+					if(!m_aWorldDormancy[i].Update(Tick(), aWorldHasPlayers[i], g_Config.m_SvWorldDormancy * TickSpeed()))
+						continue;
+
+					PROFILE_SCOPE(m_apProfileWorldTick[i]);
 					IGameServer* pGameServer = MultiWorlds()->GetWorld(i)->GameServer();
-					pGameServer->OnTick();
+					if(const int SkippedTicks = m_aWorldDormancy[i].TakeCatchUp())
+						pGameServer->OnWakeUp(SkippedTicks);
+					else
+						pGameServer->OnTick();
 				}
 			}
 
@@ -2134,6 +2260,10 @@ int CServer::Run(ILogger* pLogger)
 					}
 
 					// check if heavy reload is needed
+					// every world starts awake
+					for(auto& Dormancy : m_aWorldDormancy)
+						Dormancy.Reset();
+
 					if(m_HeavyReload)
 					{
 						// reload players
@@ -2180,8 +2310,16 @@ int CServer::Run(ILogger* pLogger)
 					if(g_Config.m_SvHighBandwidth || (m_CurrentGameTick % 2) == 0)
 					{
 						// perform a snapshot
+						PROFILE_SCOPE(m_pProfileSnapshot);
+						m_SnapshotBytesCopied = 0;
 						for(int i = 0; i < MultiWorlds()->GetSizeInitilized(); i++)
-							DoSnapshot(i);
+						{
+							if(!m_aWorldDormancy[i].IsDormant())
+								DoSnapshot(i);
+						}
+
+						if(g_Config.m_Debug && (m_CurrentGameTick % TickSpeed()) == 0)
+							dbg_msg("server", "snapshot send path copied %d bytes this tick", m_SnapshotBytesCopied);
 					}
 
 					// Loop through all players
@@ -2212,9 +2350,21 @@ int CServer::Run(ILogger* pLogger)
 			if(!NonActive)
 			{
 				// Pump the network to process any waiting packets
+				PROFILE_SCOPE(m_pProfileNetwork);
 				PumpNetwork(PacketWaiting);
 			}
 
+			// Append the profiler report periodically
+			if(g_Config.m_SvProfileDump > 0 && time_get() >= m_NextProfileDump)
+			{
+				if(m_NextProfileDump)
+					DumpProfile();
+				m_NextProfileDump = time_get() + time_freq() * g_Config.m_SvProfileDump;
+			}
+
+			// Send everything queued on the socket during this iteration
+			m_NetServer.Flush();
+
 			// Check if the server is in a non-active state
 			NonActive = std::none_of(std::begin(m_aClients), std::end(m_aClients), [](const auto& client) { return client.m_State != CClient::STATE_EMPTY; });
 
@@ -2222,7 +2372,7 @@ int CServer::Run(ILogger* pLogger)
 			if(NonActive)
 			{
 				// Wait for incoming data with a timeout of 1000000 microseconds (1 second)
-				PacketWaiting = net_socket_read_wait(m_NetServer.Socket(), 1000000);
+				PacketWaiting = m_NetServer.Wait(1000000);
 			}
 			else
 			{
@@ -2233,7 +2383,7 @@ int CServer::Run(ILogger* pLogger)
 
 				// Wait for incoming data with a timeout of x microseconds
 				// If x is greater than 0, otherwise set PacketWaiting to true
-				PacketWaiting = x > 0 ? net_socket_read_wait(m_NetServer.Socket(), x) : true;
+				PacketWaiting = x > 0 ? m_NetServer.Wait(x) : true;
 			}
 		}
 	}
@@ -2307,6 +2457,92 @@ void CServer::ConShutdown(IConsole::IResult* pResult, void* pUser)
 	pThis->m_RunServer = STOPPING;
 }
 
+// Print the queueing latency of the network thread per packet class
+void CServer::ConNetThreadStats(IConsole::IResult* pResult, void* pUser)
+{
+	CServer* pThis = static_cast<CServer*>(pUser);
+	const CNetRecvThread* pThread = pThis->m_NetServer.RecvThread();
+	if(!pThread)
+	{
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "server", "network thread is not running (sv_net_thread 0)");
+		return;
+	}
+
+	for(int Class = 0; Class < CNetRecvThread::NUM_CLASSES; Class++)
+	{
+		// bucket i counts packets that waited less than 2^i microseconds
+		char aBuf[512];
+		int Length = str_format(aBuf, sizeof(aBuf), "%s: dropped=%llu", CNetRecvThread::ClassName(Class), (unsigned long long)pThread->Dropped(Class));
+		for(int Bucket = 0; Bucket < CNetRecvThread::NUM_LATENCY_BUCKETS; Bucket++)
+		{
+			const uint64_t Count = pThread->LatencyCount(Class, Bucket);
+			if(!Count)
+				continue;
+			if(Bucket == CNetRecvThread::NUM_LATENCY_BUCKETS - 1)
+				Length += str_format(aBuf + Length, sizeof(aBuf) - Length, " >=%dus:%llu", 1 << (Bucket - 1), (unsigned long long)Count);
+			else
+				Length += str_format(aBuf + Length, sizeof(aBuf) - Length, " <%dus:%llu", 1 << Bucket, (unsigned long long)Count);
+		}
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "server", aBuf);
+	}
+}
+
+void CServer::ConSqlBenchmark(IConsole::IResult* pResult, void* pUser)
+{
+	CServer* pThis = static_cast<CServer*>(pUser);
+	const int Queries = pResult->NumArguments() ? maximum(1, pResult->GetInteger(0)) : 1000;
+
+	// both paths read the same rows on the calling thread
+	int64_t Start = time_get();
+	for(int i = 0; i < Queries; i++)
+	{
+		ResultPtr pRes = Database->Execute<DB::SELECT>("ID, Level", "tw_accounts_data", "WHERE ID = '%d'", i % 64 + 1);
+		while(pRes && pRes->next()) {}
+	}
+	const int64_t Formatted = time_get() - Start;
+
+	Start = time_get();
+	for(int i = 0; i < Queries; i++)
+	{
+		auto pSelect = Database->Prepare(STMT_SQL_BENCHMARK, "SELECT ID, Level FROM tw_accounts_data WHERE ID = ?");
+		pSelect->Bind(i % 64 + 1).ExecuteSelect([](ResultPtr pRes) { while(pRes->next()) {} });
+	}
+	const int64_t Prepared = time_get() - Start;
+
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "%d queries: formatted %.0f/s, prepared %.0f/s", Queries,
+		Queries * (double)time_freq() / maximum<int64_t>(Formatted, 1), Queries * (double)time_freq() / maximum<int64_t>(Prepared, 1));
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "server", aBuf);
+}
+
+void CServer::DumpProfile()
+{
+	IOHANDLE File = Storage()->OpenFile(g_Config.m_SvProfileFile, IOFLAG_APPEND, IStorageEngine::TYPE_SAVE_OR_ABSOLUTE);
+	if(!CProfiler::Get()->Dump(File))
+	{
+		log_error("server", "failed to open profile dump '%s'", g_Config.m_SvProfileFile);
+		return;
+	}
+	io_close(File);
+}
+
+void CServer::ConProfile(IConsole::IResult* pResult, void* pUser)
+{
+	CServer* pThis = static_cast<CServer*>(pUser);
+#if !defined(CONF_PROFILER)
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "profile", "the tick profiler is not compiled in (TICK_PROFILER)");
+#endif
+	CProfiler::Get()->Report(pResult->NumArguments() ? pResult->GetString(0) : nullptr, [pThis](const char* pLine)
+	{
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "profile", pLine);
+	});
+}
+
+void CServer::ConProfileReset(IConsole::IResult* pResult, void* pUser)
+{
+	CProfiler::Get()->Reset();
+}
+
 // Reload the server
 void CServer::ConReload(IConsole::IResult* pResult, void* pUser)
 {
@@ -2479,6 +2715,10 @@ void CServer::RegisterCommands()
 	Console()->Register("shutdown", "", CFGFLAG_SERVER, ConShutdown, this, "Shut down");
 	Console()->Register("reload", "", CFGFLAG_SERVER, ConReload, this, "Reload maps and synchronize data with the database");
 	Console()->Register("logout", "", CFGFLAG_SERVER, ConLogout, this, "Logout of rcon");
+	Console()->Register("net_thread_stats", "", CFGFLAG_SERVER, ConNetThreadStats, this, "Show queueing latency and drops of the network thread per packet class");
+	Console()->Register("sv_profile", "?s[filter]", CFGFLAG_SERVER, ConProfile, this, "Show the tick profiler report, optionally only scopes containing the filter (e.g. w0/, tick)");
+	Console()->Register("sv_profile_reset", "", CFGFLAG_SERVER, ConProfileReset, this, "Reset the tick profiler histograms");
+	Console()->Register("sql_benchmark", "?i[queries]", CFGFLAG_SERVER, ConSqlBenchmark, this, "Compare formatted and prepared query throughput against the account table");
 
 	// Chain console commands
 	Console()->Chain("sv_name", ConchainSpecialInfoupdate, this);
@@ -2523,6 +2763,20 @@ void CServer::SnapFreeID(int ID)
 	m_IDPool.FreeID(ID);
 }
 
+// Function to get Num contiguous IDs from the ID pool
+int CServer::SnapNewIDBlock(int Num)
+{
+	// Return the first ID of the block, -1 if the block space is exhausted
+	return m_IDPool.NewIDBlock(Num);
+}
+
+// Function to free a block of IDs in the ID pool
+void CServer::SnapFreeIDBlock(int ID)
+{
+	// Free the block starting at the specified ID
+	m_IDPool.FreeIDBlock(ID);
+}
+
 // Function to create a new item in the snapshot builder
 void* CServer::SnapNewItem(int Type, int ID, int Size)
 {
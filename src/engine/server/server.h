@@ -6,14 +6,18 @@
 #include <engine/console.h>
 #include <engine/server.h>
 
+#include <engine/shared/compression.h>
 #include <engine/shared/econ.h>
+#include <engine/shared/jsonwriter.h>
 #include <engine/shared/network.h>
+#include <engine/shared/profiler.h>
 #include <engine/shared/protocol.h>
 #include <engine/shared/snapshot.h>
 #include <engine/shared/uuid_manager.h>
 
 #include "cache.h"
 #include "snapshot_ids_pool.h"
+#include "world_dormancy.h"
 
 class CServer : public IServer
 {
@@ -42,6 +46,7 @@ public:
 	{
 		MAX_RCONCMD_RATIO = 8,
 		MAX_RCONCMD_SEND = 16,
+		MAX_SNAPSHOT_HEADERSIZE = 7 * CVariableInt::MAX_BYTES_PACKED, // message id and up to six ints
 	};
 
 	class CClient
@@ -87,6 +92,7 @@ public:
 
 		char m_aClan[MAX_CLAN_LENGTH];
 		char m_aLanguage[MAX_LANGUAGE_LENGTH];
+		int m_LanguageIndex;
 		int64_t m_aActionEventKeys;
 		int64_t m_aBlockedInputKeys;
 
@@ -122,6 +128,16 @@ public:
 
 	CSnapshotDelta m_SnapshotDelta;
 	CSnapshotBuilder m_SnapshotBuilder;
+	int m_SnapshotBytesCopied {};
+	CWorldDormancy m_aWorldDormancy[ENGINE_MAX_WORLDS];
+
+	// profiled parts of the main loop, see sv_profile
+	CProfileEntry* m_pProfileSnapshot {};
+	CProfileEntry* m_pProfileNetwork {};
+	CProfileEntry* m_pProfileTickGlobal {};
+	CProfileEntry* m_apProfileWorldTick[ENGINE_MAX_WORLDS] {};
+	int64_t m_NextProfileDump {};
+	void DumpProfile();
 	CSnapIDPool m_IDPool;
 	CNetServer m_NetServer;
 	CEcon m_Econ;
@@ -186,6 +202,7 @@ public:
 	const char* Localize(int ClientID, const char* pText) override;
 	void SetClientLanguage(int ClientID, const char* pLanguage) override;
 	const char* GetClientLanguage(int ClientID) const override;
+	int GetClientLanguageIndex(int ClientID) const override;
 	const char* GetWorldName(int WorldID) override;
 	CWorldDetail* GetWorldDetail(int WorldID) override;
 	bool IsWorldType(int WorldID, WorldType Type) const override;
@@ -250,15 +267,32 @@ public:
 
 	CBrowserCache m_aServerInfoCache[3 * 2];
 	bool m_ServerInfoNeedsUpdate;
+	uint64_t m_ServerInfoSignature;
+	CJsonBufferWriter m_RegisterInfo;
+	uint64_t m_RegisterInfoHash;
 	int64_t m_ServerInfoFirstRequest;
 	int m_ServerInfoNumRequests;
 
+	enum
+	{
+		MAX_SERVERINFO_REQUESTERS = 256,
+	};
+	struct CServerInfoRequest
+	{
+		NETADDR m_Addr;
+		int m_Type;
+		int64_t m_Tick;
+	};
+	CServerInfoRequest m_aServerInfoRequests[MAX_SERVERINFO_REQUESTERS];
+
 	void ExpireServerInfo() override;
 	void CacheServerInfo(CBrowserCache* pCache, int Type, bool SendClients);
 	void SendServerInfo(const NETADDR* pAddr, int Token, int Type, bool SendClients);
 	bool RateLimitServerInfoConnless();
+	bool IsRepeatServerInfoRequest(const NETADDR* pAddr, int Type);
 	void SendServerInfoConnless(const NETADDR* pAddr, int Token, int Type);
 	void UpdateRegisterServerInfo();
+	uint64_t ServerInfoSignature();
 	void UpdateServerInfo(bool Resend = false);
 
 	void PumpNetwork(bool PacketWaiting);
@@ -270,6 +304,10 @@ public:
 	static void ConKick(IConsole::IResult* pResult, void* pUser);
 	static void ConStatus(IConsole::IResult* pResult, void* pUser);
 	static void ConShutdown(IConsole::IResult* pResult, void* pUser);
+	static void ConNetThreadStats(IConsole::IResult* pResult, void* pUser);
+	static void ConSqlBenchmark(IConsole::IResult* pResult, void* pUser);
+	static void ConProfile(IConsole::IResult* pResult, void* pUser);
+	static void ConProfileReset(IConsole::IResult* pResult, void* pUser);
 	static void ConReload(IConsole::IResult* pResult, void* pUser);
 	static void ConLogout(IConsole::IResult* pResult, void* pUser);
 
@@ -287,6 +325,8 @@ public:
 
 	int SnapNewID() override;
 	void SnapFreeID(int ID) override;
+	int SnapNewIDBlock(int Num) override;
+	void SnapFreeIDBlock(int ID) override;
 	void* SnapNewItem(int Type, int ID, int Size) override;
 	void SnapSetStaticsize(int ItemType, int Size) override;
 
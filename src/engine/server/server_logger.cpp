@@ -2,30 +2,41 @@
 
 #include "server.h"
 
-constexpr size_t MAX_PENDING_MSG_SHIRK = 300;
-std::atomic_bool grequest_update {false};
+#include <engine/shared/config.h>
+
+#include <chrono>
+
+constexpr unsigned SERVER_LOG_QUEUE_SIZE = 1024;
+constexpr unsigned FILE_LOG_QUEUE_SIZE = 2048;
 
 CServerLogger::CServerLogger(CServer *pServer) :
 	m_pServer(pServer),
 	m_MainThread(std::this_thread::get_id())
 {
 	dbg_assert(pServer != nullptr, "server pointer must not be null");
-	m_vPending.reserve(MAX_PENDING_MSG_SHIRK);
+	m_Queue.Init(SERVER_LOG_QUEUE_SIZE);
 }
 
 void CServerLogger::Update()
 {
-	if(grequest_update.load())
-	{
-		log_info("logger", "relocation request from stores future log");
+	dbg_assert(m_MainThread == std::this_thread::get_id(), "CServerLogger::Update not called from the main thread");
 
-		m_PendingLock.lock();
-		m_vPending.clear();
-		m_vPending.shrink_to_fit();
-		m_vPending.reserve(MAX_PENDING_MSG_SHIRK);
-		m_PendingLock.unlock();
+	// whatever stays over the budget goes out with the next loops
+	m_Queue.Drain(g_Config.m_SvLogDrainBudget, [this](const CLogRecord &Record) {
+		if(m_pServer)
+		{
+			Record.Get(&m_Drained);
+			m_pServer->SendLogLine(&m_Drained);
+		}
+	});
 
-		grequest_update.store(false);
+	// report drops at most once a second
+	const uint64_t Dropped = m_Queue.Dropped();
+	if(Dropped != m_ReportedDrops && time_get() > m_LastDropReport + time_freq())
+	{
+		log_warn("logger", "dropped %llu log lines for rcon and econ, the queue was full", (unsigned long long)(Dropped - m_ReportedDrops));
+		m_ReportedDrops = Dropped;
+		m_LastDropReport = time_get();
 	}
 }
 
@@ -36,35 +47,16 @@ void CServerLogger::Log(const CLogMessage *pMessage)
 		return;
 	}
 
-	m_PendingLock.lock();
-	if(m_MainThread == std::this_thread::get_id())
+	// the main thread sends right away unless older lines are still queued
+	if(m_MainThread == std::this_thread::get_id() && m_Queue.Empty())
 	{
-		if(!m_vPending.empty())
-		{
-			if(m_pServer)
-			{
-				for(const auto &Message : m_vPending)
-				{
-					m_pServer->SendLogLine(&Message);
-				}
-			}
-			m_vPending.clear();
-		}
-		m_PendingLock.unlock();
-
 		if(m_pServer)
 		{
 			m_pServer->SendLogLine(pMessage);
 		}
+		return;
 	}
-	else
-	{
-		if(m_vPending.capacity() > MAX_PENDING_MSG_SHIRK)
-			grequest_update.store(true);
-
-		m_vPending.push_back(*pMessage);
-		m_PendingLock.unlock();
-	}
+	m_Queue.Push(pMessage);
 }
 
 void CServerLogger::OnServerDeletion()
@@ -72,3 +64,75 @@ void CServerLogger::OnServerDeletion()
 	dbg_assert(m_MainThread == std::this_thread::get_id(), "CServerLogger::OnServerDeletion not called from the main thread");
 	m_pServer = nullptr;
 }
+
+CServerFileLogger::CServerFileLogger(IOHANDLE File) :
+	m_File(File)
+{
+	m_Queue.Init(FILE_LOG_QUEUE_SIZE);
+	m_pThread = thread_init(ThreadFunc, this, "file logger");
+}
+
+CServerFileLogger::~CServerFileLogger()
+{
+	Finish();
+}
+
+void CServerFileLogger::Log(const CLogMessage *pMessage)
+{
+	if(m_Filter.Filters(pMessage))
+	{
+		return;
+	}
+	m_Queue.Push(pMessage);
+}
+
+void CServerFileLogger::GlobalFinish()
+{
+	Finish();
+}
+
+void CServerFileLogger::ThreadFunc(void *pUser)
+{
+	CServerFileLogger *pSelf = static_cast<CServerFileLogger *>(pUser);
+	while(!pSelf->m_Shutdown.load())
+	{
+		if(pSelf->m_Queue.Empty())
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		else
+			pSelf->WritePending();
+	}
+}
+
+void CServerFileLogger::WritePending()
+{
+	m_Queue.Drain(FILE_LOG_QUEUE_SIZE, [this](const CLogRecord &Record) {
+		io_write(m_File, Record.m_aLine, Record.m_LineLength);
+		io_write_newline(m_File);
+	});
+
+	// note the gap in the file itself
+	const uint64_t Dropped = m_Queue.Dropped();
+	if(Dropped != m_ReportedDrops)
+	{
+		char aBuf[128];
+		str_format(aBuf, sizeof(aBuf), "[file logger] dropped %llu log lines, the queue was full", (unsigned long long)(Dropped - m_ReportedDrops));
+		io_write(m_File, aBuf, str_length(aBuf));
+		io_write_newline(m_File);
+		m_ReportedDrops = Dropped;
+	}
+	io_flush(m_File);
+}
+
+void CServerFileLogger::Finish()
+{
+	if(!m_pThread)
+		return;
+
+	m_Shutdown = true;
+	thread_wait(m_pThread);
+	m_pThread = nullptr;
+
+	// the writer is gone, this thread is the only consumer now
+	WritePending();
+	io_close(m_File);
+}
@@ -2,6 +2,9 @@
 #define ENGINE_SERVER_SERVER_LOGGER_H
 #include <base/logger.h>
 
+#include <engine/shared/log_queue.h>
+
+#include <atomic>
 #include <thread>
 
 class CServer;
@@ -9,19 +12,43 @@ class CServer;
 class CServerLogger : public ILogger
 {
 	CServer *m_pServer = nullptr;
-	CLock m_PendingLock;
-	std::vector<CLogMessage> m_vPending;
+	CLogQueue m_Queue;
 	std::thread::id m_MainThread;
+	CLogMessage m_Drained;
+	uint64_t m_ReportedDrops = 0;
+	int64_t m_LastDropReport = 0;
 
 public:
 	CServerLogger(CServer *pServer);
-	void Log(const CLogMessage *pMessage) override REQUIRES(!m_PendingLock);
+	void Log(const CLogMessage *pMessage) override;
 
-	// confusions, when working off the only logs from the thread
+	// main thread, sends the lines other threads logged to rcon and econ, a budget per call
 	void Update();
+	uint64_t Dropped() const { return m_Queue.Dropped(); }
 
 	// Must be called from the main thread!
 	void OnServerDeletion();
 };
 
+// writes the log file on a thread of its own, logging threads only copy into a queue
+class CServerFileLogger : public ILogger
+{
+	IOHANDLE m_File;
+	CLogQueue m_Queue;
+	void *m_pThread = nullptr;
+	std::atomic_bool m_Shutdown {false};
+	uint64_t m_ReportedDrops = 0;
+
+	static void ThreadFunc(void *pUser);
+	void WritePending();
+	void Finish();
+
+public:
+	CServerFileLogger(IOHANDLE File);
+	~CServerFileLogger() override;
+	void Log(const CLogMessage *pMessage) override;
+	void GlobalFinish() override;
+	uint64_t Dropped() const { return m_Queue.Dropped(); }
+};
+
 #endif // ENGINE_SERVER_SERVER_LOGGER_H
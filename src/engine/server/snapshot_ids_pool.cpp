@@ -1,5 +1,7 @@
 #include "snapshot_ids_pool.h"
 
+#include <base/system.h>
+
 CSnapIDPool::CSnapIDPool()
 {
 	Reset();
@@ -7,17 +9,27 @@ CSnapIDPool::CSnapIDPool()
 
 void CSnapIDPool::Reset()
 {
-	for(int i = 0; i < MAX_IDS; i++)
+	for(int i = 0; i < FIRST_BLOCK_ID; i++)
 	{
 		m_aIDs[i].m_Next = i + 1;
 		m_aIDs[i].m_State = 0;
 	}
-	m_aIDs[MAX_IDS - 1].m_Next = -1;
+	m_aIDs[FIRST_BLOCK_ID - 1].m_Next = -1;
 	m_FirstFree = 0;
 	m_FirstTimed = -1;
 	m_LastTimed = -1;
 	m_Usage = 0;
 	m_InUsage = 0;
+
+	// the whole block space starts as one free block
+	for(int i = 0; i < BLOCK_IDS; i++)
+		m_aBlocks[i].m_State = 0;
+	for(int& FirstFree : m_aFirstFreeBlock)
+		FirstFree = -1;
+	PushFreeBlock(0, MAX_BLOCK_ORDER);
+	m_FirstTimedBlock = -1;
+	m_LastTimedBlock = -1;
+	m_BlockUsage = 0;
 }
 
 void CSnapIDPool::RemoveFirstTimeout()
@@ -61,12 +73,15 @@ void CSnapIDPool::TimeoutIDs()
 	// process timed ids
 	while(m_FirstTimed != -1)
 		RemoveFirstTimeout();
+	while(m_FirstTimedBlock != -1)
+		RemoveFirstTimedBlock();
 }
 
 void CSnapIDPool::FreeID(int ID)
 {
 	if(ID < 0)
 		return;
+	dbg_assert(ID < FIRST_BLOCK_ID, "id belongs to a block");
 	dbg_assert(m_aIDs[ID].m_State == 1, "id is not allocated");
 
 	m_InUsage--;
@@ -84,4 +99,112 @@ void CSnapIDPool::FreeID(int ID)
 		m_FirstTimed = ID;
 		m_LastTimed = ID;
 	}
-}
\ No newline at end of file
+}
+
+void CSnapIDPool::PushFreeBlock(int Offset, int Order)
+{
+	CBlock& Block = m_aBlocks[Offset];
+	Block.m_Order = Order;
+	Block.m_State = 1;
+	Block.m_Prev = -1;
+	Block.m_Next = m_aFirstFreeBlock[Order];
+	if(Block.m_Next != -1)
+		m_aBlocks[Block.m_Next].m_Prev = Offset;
+	m_aFirstFreeBlock[Order] = Offset;
+}
+
+void CSnapIDPool::UnlinkFreeBlock(int Offset)
+{
+	CBlock& Block = m_aBlocks[Offset];
+	if(Block.m_Prev != -1)
+		m_aBlocks[Block.m_Prev].m_Next = Block.m_Next;
+	else
+		m_aFirstFreeBlock[Block.m_Order] = Block.m_Next;
+	if(Block.m_Next != -1)
+		m_aBlocks[Block.m_Next].m_Prev = Block.m_Prev;
+	Block.m_State = 0;
+}
+
+void CSnapIDPool::RemoveFirstTimedBlock()
+{
+	int Offset = m_FirstTimedBlock;
+	int Order = m_aBlocks[Offset].m_Order;
+
+	// remove it from the timed list
+	m_FirstTimedBlock = m_aBlocks[Offset].m_Next;
+	if(m_FirstTimedBlock == -1)
+		m_LastTimedBlock = -1;
+	m_aBlocks[Offset].m_State = 0;
+	m_BlockUsage -= 1 << Order;
+
+	// merge with the free buddy as long as there is one
+	while(Order < MAX_BLOCK_ORDER)
+	{
+		const int Buddy = Offset ^ (1 << Order);
+		if(m_aBlocks[Buddy].m_State != 1 || m_aBlocks[Buddy].m_Order != Order)
+			break;
+		UnlinkFreeBlock(Buddy);
+		Offset &= ~(1 << Order);
+		Order++;
+	}
+	PushFreeBlock(Offset, Order);
+}
+
+int CSnapIDPool::NewIDBlock(int Num)
+{
+	int Order = 0;
+	while(Order <= MAX_BLOCK_ORDER && (1 << Order) < Num)
+		Order++;
+	if(Num < 1 || Order > MAX_BLOCK_ORDER)
+		return -1;
+
+	int64_t Now = time_get();
+
+	// process timed blocks
+	while(m_FirstTimedBlock != -1 && m_aBlocks[m_FirstTimedBlock].m_Timeout < Now)
+		RemoveFirstTimedBlock();
+
+	// the smallest free block that fits, split down to the size asked for
+	int FreeOrder = Order;
+	while(FreeOrder <= MAX_BLOCK_ORDER && m_aFirstFreeBlock[FreeOrder] == -1)
+		FreeOrder++;
+	if(FreeOrder > MAX_BLOCK_ORDER)
+		return -1;
+
+	const int Offset = m_aFirstFreeBlock[FreeOrder];
+	UnlinkFreeBlock(Offset);
+	while(FreeOrder > Order)
+	{
+		FreeOrder--;
+		PushFreeBlock(Offset + (1 << FreeOrder), FreeOrder);
+	}
+
+	m_aBlocks[Offset].m_Order = Order;
+	m_aBlocks[Offset].m_State = 2;
+	m_BlockUsage += 1 << Order;
+	return FIRST_BLOCK_ID + Offset;
+}
+
+void CSnapIDPool::FreeIDBlock(int ID)
+{
+	if(ID < 0)
+		return;
+	const int Offset = ID - FIRST_BLOCK_ID;
+	dbg_assert(Offset >= 0 && Offset < BLOCK_IDS && m_aBlocks[Offset].m_State == 2, "id block is not allocated");
+
+	// blocks wait like single ids, clients may still have the old items
+	m_aBlocks[Offset].m_State = 3;
+	m_aBlocks[Offset].m_Timeout = time_get() + time_freq() * 5;
+	m_aBlocks[Offset].m_Next = -1;
+
+	if(m_LastTimedBlock != -1)
+	{
+		m_aBlocks[m_LastTimedBlock].m_Next = Offset;
+		m_LastTimedBlock = Offset;
+	}
+	else
+	{
+		m_FirstTimedBlock = Offset;
+		m_LastTimedBlock = Offset;
+	}
+}
@@ -1,13 +1,22 @@
 #ifndef ENGINE_SERVER_SNAPSHOT_IDS_POOL_CONTEXT_H
 #define ENGINE_SERVER_SNAPSHOT_IDS_POOL_CONTEXT_H
 
+#include <cstdint>
+
 class CSnapIDPool
 {
+public:
 	enum
 	{
 		MAX_IDS = 32 * 1024,
+
+		// the top of the ID space is handed out in contiguous blocks by a buddy allocator
+		MAX_BLOCK_ORDER = 13,
+		BLOCK_IDS = 1 << MAX_BLOCK_ORDER,
+		FIRST_BLOCK_ID = MAX_IDS - BLOCK_IDS,
 	};
 
+private:
 	class CID
 	{
 	public:
@@ -16,7 +25,18 @@ class CSnapIDPool
 		int m_Timeout;
 	};
 
-	CID m_aIDs[MAX_IDS];
+	class CBlock
+	{
+	public:
+		int m_Next; // free list of the order or the timed list
+		int m_Prev;
+		short m_Order;
+		short m_State; // 0 = inside a block, 1 = free, 2 = allocated, 3 = timed
+		int64_t m_Timeout;
+	};
+
+	CID m_aIDs[FIRST_BLOCK_ID];
+	CBlock m_aBlocks[BLOCK_IDS];
 
 	int m_FirstFree;
 	int m_FirstTimed;
@@ -24,6 +44,15 @@ class CSnapIDPool
 	int m_Usage;
 	int m_InUsage;
 
+	int m_aFirstFreeBlock[MAX_BLOCK_ORDER + 1];
+	int m_FirstTimedBlock;
+	int m_LastTimedBlock;
+	int m_BlockUsage;
+
+	void PushFreeBlock(int Offset, int Order);
+	void UnlinkFreeBlock(int Offset);
+	void RemoveFirstTimedBlock();
+
 public:
 	CSnapIDPool();
 
@@ -32,7 +61,13 @@ public:
 	int NewID();
 	void TimeoutIDs();
 	void FreeID(int ID);
+
+	// Num IDs starting at the returned one, -1 if no block of that size is left
+	int NewIDBlock(int Num);
+	void FreeIDBlock(int ID);
+
+	int BlockUsage() const { return m_BlockUsage; }
 };
 
 
-#endif
\ No newline at end of file
+#endif
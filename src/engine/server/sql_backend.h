@@ -0,0 +1,88 @@
+#ifndef ENGINE_SERVER_SQL_BACKEND_H
+#define ENGINE_SERVER_SQL_BACKEND_H
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+ * Database drivers behind CConectionPool. The result accessors keep the
+ * cppconn names the game code was written against.
+ */
+class CSqlException : public std::runtime_error
+{
+public:
+	using std::runtime_error::runtime_error;
+};
+
+class ISqlResult
+{
+public:
+	virtual ~ISqlResult() = default;
+
+	virtual bool next() = 0;
+	virtual size_t rowsCount() const = 0;
+	virtual size_t getRow() const = 0; // 1 for the first row, 0 before it
+
+	virtual int getInt(const std::string& Column) const = 0;
+	virtual int64_t getInt64(const std::string& Column) const = 0;
+	virtual double getDouble(const std::string& Column) const = 0;
+	virtual bool getBoolean(const std::string& Column) const = 0;
+	virtual std::string getString(const std::string& Column) const = 0;
+	virtual bool isNull(const std::string& Column) const = 0;
+};
+
+class ISqlStatement
+{
+public:
+	virtual ~ISqlStatement() = default;
+
+	// placeholder indices start at 1
+	virtual void SetInt(unsigned Index, int Value) = 0;
+	virtual void SetInt64(unsigned Index, int64_t Value) = 0;
+	virtual void SetDouble(unsigned Index, double Value) = 0;
+	virtual void SetString(unsigned Index, const std::string& Value) = 0;
+
+	virtual std::unique_ptr<ISqlResult> ExecuteQuery() = 0;
+	virtual void Execute() = 0;
+};
+
+class ISqlConnection
+{
+public:
+	virtual ~ISqlConnection() = default;
+
+	virtual bool IsClosed() = 0;
+	virtual void Close() = 0;
+
+	virtual std::unique_ptr<ISqlResult> ExecuteQuery(const std::string& Query) = 0;
+	virtual void Execute(const std::string& Query) = 0;
+	virtual std::unique_ptr<ISqlStatement> Prepare(const std::string& Query) = 0;
+};
+
+class ISqlBackend
+{
+public:
+	virtual ~ISqlBackend() = default;
+
+	virtual const char* Name() const = 0;
+	virtual ISqlConnection* Connect() = 0;
+
+	// called around every use of a connection from a worker thread
+	virtual void ThreadInit() {}
+	virtual void ThreadEnd() {}
+};
+
+// connections, statements and results throw CSqlException on errors
+ISqlBackend* CreateSqlBackendMySQL(const char* pHost, int Port, const char* pLogin, const char* pPassword, const char* pDatabase);
+
+// pFile empty opens a shared in-memory database, a new database is created from the mysql dump pSchemaFile
+// returns nullptr if the server was built without sqlite
+ISqlBackend* CreateSqlBackendSqlite(const char* pFile, const char* pSchemaFile);
+
+// converts a phpMyAdmin/mysqldump export into statements sqlite accepts
+std::vector<std::string> SqliteTranslateMySqlDump(const std::string& Dump);
+
+#endif
@@ -0,0 +1,147 @@
+#include <base/system.h>
+
+#include "sql_backend.h"
+
+// fix c++17 error with removed throw()
+#if __cplusplus >= 201703L
+	#define throw(...)
+	#include <cppconn/driver.h>
+	#include <cppconn/connection.h>
+	#include <cppconn/statement.h>
+	#include <cppconn/prepared_statement.h>
+	#include <cppconn/resultset.h>
+	#undef throw /* reset */
+#else
+	#include <cppconn/driver.h>
+	#include <cppconn/connection.h>
+	#include <cppconn/statement.h>
+	#include <cppconn/prepared_statement.h>
+	#include <cppconn/resultset.h>
+#endif
+
+// cppconn errors are rethrown as the backend independent exception
+#define MYSQL_TRY(x) \
+	try \
+	{ \
+		x; \
+	} \
+	catch(sql::SQLException & e) \
+	{ \
+		throw CSqlException(e.what()); \
+	}
+
+class CMySqlResult : public ISqlResult
+{
+	std::unique_ptr<sql::ResultSet> m_pResult;
+
+public:
+	explicit CMySqlResult(sql::ResultSet* pResult) : m_pResult(pResult) {}
+
+	bool next() override { MYSQL_TRY(return m_pResult->next()) }
+	size_t rowsCount() const override { MYSQL_TRY(return m_pResult->rowsCount()) }
+	size_t getRow() const override { MYSQL_TRY(return m_pResult->getRow()) }
+
+	int getInt(const std::string& Column) const override { MYSQL_TRY(return m_pResult->getInt(Column)) }
+	int64_t getInt64(const std::string& Column) const override { MYSQL_TRY(return m_pResult->getInt64(Column)) }
+	double getDouble(const std::string& Column) const override { MYSQL_TRY(return (double)m_pResult->getDouble(Column)) }
+	bool getBoolean(const std::string& Column) const override { MYSQL_TRY(return m_pResult->getBoolean(Column)) }
+	std::string getString(const std::string& Column) const override { MYSQL_TRY(return m_pResult->getString(Column).asStdString()) }
+	bool isNull(const std::string& Column) const override { MYSQL_TRY(return m_pResult->isNull(Column)) }
+};
+
+class CMySqlStatement : public ISqlStatement
+{
+	std::unique_ptr<sql::PreparedStatement> m_pStatement;
+
+public:
+	explicit CMySqlStatement(sql::PreparedStatement* pStatement) : m_pStatement(pStatement) {}
+
+	void SetInt(unsigned Index, int Value) override { MYSQL_TRY(m_pStatement->setInt(Index, Value)) }
+	void SetInt64(unsigned Index, int64_t Value) override { MYSQL_TRY(m_pStatement->setInt64(Index, Value)) }
+	void SetDouble(unsigned Index, double Value) override { MYSQL_TRY(m_pStatement->setDouble(Index, Value)) }
+	void SetString(unsigned Index, const std::string& Value) override { MYSQL_TRY(m_pStatement->setString(Index, Value)) }
+
+	std::unique_ptr<ISqlResult> ExecuteQuery() override { MYSQL_TRY(return std::make_unique<CMySqlResult>(m_pStatement->executeQuery())) }
+	void Execute() override { MYSQL_TRY(m_pStatement->execute()) }
+};
+
+class CMySqlConnection : public ISqlConnection
+{
+	std::unique_ptr<sql::Connection> m_pConnection;
+
+public:
+	explicit CMySqlConnection(sql::Connection* pConnection) : m_pConnection(pConnection) {}
+
+	bool IsClosed() override { MYSQL_TRY(return m_pConnection->isClosed()) }
+	void Close() override { MYSQL_TRY(m_pConnection->close()) }
+
+	std::unique_ptr<ISqlResult> ExecuteQuery(const std::string& Query) override
+	{
+		MYSQL_TRY(
+			const std::unique_ptr<sql::Statement> pStmt(m_pConnection->createStatement());
+			auto pResult = std::make_unique<CMySqlResult>(pStmt->executeQuery(Query));
+			pStmt->close();
+			return pResult;)
+	}
+
+	void Execute(const std::string& Query) override
+	{
+		MYSQL_TRY(
+			const std::unique_ptr<sql::Statement> pStmt(m_pConnection->createStatement());
+			pStmt->execute(Query);
+			pStmt->close();)
+	}
+
+	std::unique_ptr<ISqlStatement> Prepare(const std::string& Query) override
+	{
+		MYSQL_TRY(return std::make_unique<CMySqlStatement>(m_pConnection->prepareStatement(Query)))
+	}
+};
+
+class CMySqlBackend : public ISqlBackend
+{
+	sql::Driver* m_pDriver;
+	std::string m_Hostname;
+	std::string m_Login;
+	std::string m_Password;
+	std::string m_Database;
+
+public:
+	CMySqlBackend(const char* pHost, int Port, const char* pLogin, const char* pPassword, const char* pDatabase) :
+		m_Login(pLogin), m_Password(pPassword), m_Database(pDatabase)
+	{
+		m_Hostname = std::string(pHost) + ":" + std::to_string(Port);
+		MYSQL_TRY(m_pDriver = get_driver_instance())
+	}
+
+	const char* Name() const override { return "mysql"; }
+
+	ISqlConnection* Connect() override
+	{
+		sql::Connection* pConnection = nullptr;
+		try
+		{
+			pConnection = m_pDriver->connect(m_Hostname.c_str(), m_Login.c_str(), m_Password.c_str());
+			pConnection->setClientOption("OPT_CHARSET_NAME", "utf8mb4");
+			pConnection->setClientOption("OPT_CONNECT_TIMEOUT", "10");
+			pConnection->setClientOption("OPT_READ_TIMEOUT", "10");
+			pConnection->setClientOption("OPT_WRITE_TIMEOUT", "20");
+			pConnection->setClientOption("OPT_RECONNECT", "1");
+			pConnection->setSchema(m_Database.c_str());
+		}
+		catch(sql::SQLException& e)
+		{
+			delete pConnection;
+			throw CSqlException(e.what());
+		}
+		return new CMySqlConnection(pConnection);
+	}
+
+	void ThreadInit() override { m_pDriver->threadInit(); }
+	void ThreadEnd() override { m_pDriver->threadEnd(); }
+};
+
+ISqlBackend* CreateSqlBackendMySQL(const char* pHost, int Port, const char* pLogin, const char* pPassword, const char* pDatabase)
+{
+	return new CMySqlBackend(pHost, Port, pLogin, pPassword, pDatabase);
+}
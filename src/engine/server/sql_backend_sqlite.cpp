@@ -0,0 +1,823 @@
+#include <base/system.h>
+
+#include "sql_backend.h"
+
+#include <unordered_map>
+#include <vector>
+
+// mysql string literals use backslash escapes and may be double quoted, sqlite only knows '' inside '...'
+static std::string TranslateLiterals(const std::string& Query)
+{
+	if(Query.find_first_of("\\\"") == std::string::npos)
+		return Query;
+
+	std::string Result;
+	Result.reserve(Query.size());
+	char Quote = 0;
+	for(size_t i = 0; i < Query.size(); i++)
+	{
+		const char c = Query[i];
+		if(!Quote)
+		{
+			if(c == '\'' || c == '"')
+			{
+				Quote = c;
+				Result += '\'';
+			}
+			else
+			{
+				if(c == '`')
+				{
+					// identifiers are copied untouched
+					const size_t End = Query.find('`', i + 1);
+					const size_t Next = End == std::string::npos ? Query.size() : End + 1;
+					Result.append(Query, i, Next - i);
+					i = Next - 1;
+					continue;
+				}
+				Result += c;
+			}
+			continue;
+		}
+
+		if(c == '\\' && i + 1 < Query.size())
+		{
+			const char Escaped = Query[++i];
+			switch(Escaped)
+			{
+			case '0': break;
+			case 'n': Result += '\n'; break;
+			case 'r': Result += '\r'; break;
+			case 't': Result += '\t'; break;
+			case 'b': Result += '\b'; break;
+			case 'Z': Result += '\x1a'; break;
+			case '\'': Result += "''"; break;
+			case '%':
+			case '_':
+				Result += '\\';
+				Result += Escaped;
+				break;
+			default: Result += Escaped; break;
+			}
+		}
+		else if(c == Quote)
+		{
+			if(i + 1 < Query.size() && Query[i + 1] == Quote)
+			{
+				Result += Quote == '\'' ? "''" : "\"";
+				i++;
+			}
+			else
+			{
+				Quote = 0;
+				Result += '\'';
+			}
+		}
+		else if(c == '\'')
+		{
+			Result += "''";
+		}
+		else
+		{
+			Result += c;
+		}
+	}
+	return Result;
+}
+
+/*
+ * Dump translation
+ */
+static bool StartsWithNoCase(const std::string& Str, size_t Pos, const char* pPrefix)
+{
+	const size_t Length = str_length(pPrefix);
+	return Pos <= Str.size() && Str.size() - Pos >= Length && str_comp_nocase_num(Str.c_str() + Pos, pPrefix, Length) == 0;
+}
+
+static std::string Trim(const std::string& Str)
+{
+	const size_t Start = Str.find_first_not_of(" \t\r\n");
+	if(Start == std::string::npos)
+		return "";
+	const size_t End = Str.find_last_not_of(" \t\r\n");
+	return Str.substr(Start, End - Start + 1);
+}
+
+// skips a quoted string starting at Pos, returns the position after it
+static size_t SkipQuoted(const std::string& Str, size_t Pos)
+{
+	const char Quote = Str[Pos];
+	for(size_t i = Pos + 1; i < Str.size(); i++)
+	{
+		if(Str[i] == '\\' && Quote != '`')
+			i++;
+		else if(Str[i] == Quote && i + 1 < Str.size() && Str[i + 1] == Quote)
+			i++;
+		else if(Str[i] == Quote)
+			return i + 1;
+	}
+	return Str.size();
+}
+
+static std::vector<std::string> SplitStatements(const std::string& Dump)
+{
+	std::vector<std::string> vStatements;
+	std::string Current;
+	for(size_t i = 0; i < Dump.size(); i++)
+	{
+		const char c = Dump[i];
+		if(c == '\'' || c == '"' || c == '`')
+		{
+			const size_t End = SkipQuoted(Dump, i);
+			Current.append(Dump, i, End - i);
+			i = End - 1;
+		}
+		else if((c == '-' && Dump.compare(i, 2, "--") == 0 && (i + 2 >= Dump.size() || Dump[i + 2] <= ' ')) || c == '#')
+		{
+			const size_t End = Dump.find('\n', i);
+			i = End == std::string::npos ? Dump.size() : End;
+		}
+		else if(c == '/' && Dump.compare(i, 2, "/*") == 0)
+		{
+			// conditional /*!40101 ... */ comments only carry mysql session settings
+			const size_t End = Dump.find("*/", i + 2);
+			i = End == std::string::npos ? Dump.size() : End + 1;
+		}
+		else if(c == ';')
+		{
+			std::string Statement = Trim(Current);
+			if(!Statement.empty())
+				vStatements.push_back(std::move(Statement));
+			Current.clear();
+		}
+		else
+		{
+			Current += c;
+		}
+	}
+
+	std::string Statement = Trim(Current);
+	if(!Statement.empty())
+		vStatements.push_back(std::move(Statement));
+	return vStatements;
+}
+
+// splits on separators outside of quotes and parentheses
+static std::vector<std::string> SplitTopLevel(const std::string& Str, char Separator)
+{
+	std::vector<std::string> vParts;
+	int Depth = 0;
+	size_t Start = 0;
+	for(size_t i = 0; i < Str.size(); i++)
+	{
+		const char c = Str[i];
+		if(c == '\'' || c == '"' || c == '`')
+			i = SkipQuoted(Str, i) - 1;
+		else if(c == '(')
+			Depth++;
+		else if(c == ')')
+			Depth--;
+		else if(c == Separator && Depth == 0)
+		{
+			vParts.push_back(Trim(Str.substr(Start, i - Start)));
+			Start = i + 1;
+		}
+	}
+	vParts.push_back(Trim(Str.substr(Start)));
+	return vParts;
+}
+
+// reads a word, a quoted string or a word followed by a parenthesized group
+static std::string NextToken(const std::string& Str, size_t& Pos)
+{
+	while(Pos < Str.size() && (unsigned char)Str[Pos] <= ' ')
+		Pos++;
+	if(Pos >= Str.size())
+		return "";
+
+	const size_t Start = Pos;
+	if(Str[Pos] == '\'' || Str[Pos] == '"' || Str[Pos] == '`')
+	{
+		Pos = SkipQuoted(Str, Pos);
+		return Str.substr(Start, Pos - Start);
+	}
+
+	int Depth = 0;
+	while(Pos < Str.size() && (Depth > 0 || ((unsigned char)Str[Pos] > ' ' && Str[Pos] != ',')))
+	{
+		if(Str[Pos] == '\'' || Str[Pos] == '"')
+		{
+			Pos = SkipQuoted(Str, Pos);
+			continue;
+		}
+		if(Str[Pos] == '(')
+			Depth++;
+		else if(Str[Pos] == ')')
+			Depth--;
+		Pos++;
+	}
+	return Str.substr(Start, Pos - Start);
+}
+
+static std::string Unquote(const std::string& Identifier)
+{
+	if(Identifier.size() >= 2 && Identifier.front() == '`' && Identifier.back() == '`')
+		return Identifier.substr(1, Identifier.size() - 2);
+	return Identifier;
+}
+
+// `a`, `b`(10) -> `a`, `b`
+static std::string IndexColumns(const std::string& Group)
+{
+	const size_t Open = Group.find('(');
+	const size_t Close = Group.rfind(')');
+	if(Open == std::string::npos || Close == std::string::npos || Close <= Open)
+		return Group;
+
+	std::string Result;
+	for(const auto& Column : SplitTopLevel(Group.substr(Open + 1, Close - Open - 1), ','))
+	{
+		size_t Pos = 0;
+		const std::string Name = NextToken(Column, Pos);
+		if(!Result.empty())
+			Result += ", ";
+		Result += "`" + Unquote(Name.substr(0, Name[0] == '`' ? Name.size() : Name.find('('))) + "`";
+	}
+	return "(" + Result + ")";
+}
+
+static const char* SqliteType(const std::string& MySqlType)
+{
+	if(StartsWithNoCase(MySqlType, 0, "int") || StartsWithNoCase(MySqlType, 0, "tinyint") || StartsWithNoCase(MySqlType, 0, "smallint") ||
+		StartsWithNoCase(MySqlType, 0, "mediumint") || StartsWithNoCase(MySqlType, 0, "bigint") || StartsWithNoCase(MySqlType, 0, "bit") ||
+		StartsWithNoCase(MySqlType, 0, "bool"))
+		return "INTEGER";
+	if(StartsWithNoCase(MySqlType, 0, "float") || StartsWithNoCase(MySqlType, 0, "double") || StartsWithNoCase(MySqlType, 0, "real"))
+		return "REAL";
+	if(StartsWithNoCase(MySqlType, 0, "decimal") || StartsWithNoCase(MySqlType, 0, "numeric"))
+		return "NUMERIC";
+	if(StartsWithNoCase(MySqlType, 0, "blob") || StartsWithNoCase(MySqlType, 0, "longblob") || StartsWithNoCase(MySqlType, 0, "binary") ||
+		StartsWithNoCase(MySqlType, 0, "varbinary"))
+		return "BLOB";
+	return "TEXT";
+}
+
+class CDumpTable
+{
+public:
+	class CColumn
+	{
+	public:
+		std::string m_Name;
+		std::string m_Type;
+		std::string m_Constraints;
+	};
+
+	std::vector<CColumn> m_vColumns;
+	std::string m_PrimaryKey; // column group
+	std::string m_AutoIncrement; // column name
+	std::vector<std::string> m_vIndices;
+};
+
+static std::string TranslateColumnConstraints(const std::string& Definition, size_t Pos, bool* pAutoIncrement)
+{
+	std::string Result;
+	while(true)
+	{
+		const std::string Token = NextToken(Definition, Pos);
+		if(Token.empty())
+			break;
+
+		if(StartsWithNoCase(Token, 0, "unsigned") || StartsWithNoCase(Token, 0, "zerofill"))
+			continue;
+		if(str_comp_nocase(Token.c_str(), "AUTO_INCREMENT") == 0)
+		{
+			*pAutoIncrement = true;
+			continue;
+		}
+		if(str_comp_nocase(Token.c_str(), "CHARACTER") == 0)
+		{
+			NextToken(Definition, Pos); // SET
+			NextToken(Definition, Pos);
+			continue;
+		}
+		if(str_comp_nocase(Token.c_str(), "CHARSET") == 0 || str_comp_nocase(Token.c_str(), "COLLATE") == 0 || str_comp_nocase(Token.c_str(), "COMMENT") == 0)
+		{
+			NextToken(Definition, Pos);
+			continue;
+		}
+		if(str_comp_nocase(Token.c_str(), "CHECK") == 0)
+		{
+			// mariadb json columns check json_valid(), sqlite is stricter about raw control characters
+			NextToken(Definition, Pos);
+			continue;
+		}
+		if(str_comp_nocase(Token.c_str(), "ON") == 0)
+		{
+			NextToken(Definition, Pos); // UPDATE
+			NextToken(Definition, Pos);
+			continue;
+		}
+
+		if(!Result.empty())
+			Result += ' ';
+		if(StartsWithNoCase(Token, 0, "current_timestamp") || StartsWithNoCase(Token, 0, "now()"))
+			Result += "CURRENT_TIMESTAMP";
+		else if(Token[0] == '\'' || Token[0] == '"')
+			Result += TranslateLiterals(Token);
+		else
+			Result += Token;
+	}
+	return Result;
+}
+
+static void ParseCreateTable(const std::string& Statement, std::vector<std::string>* pOrder, std::unordered_map<std::string, CDumpTable>* pTables)
+{
+	size_t Pos = 0;
+	NextToken(Statement, Pos); // CREATE
+	NextToken(Statement, Pos); // TABLE
+	std::string Name = NextToken(Statement, Pos);
+	if(str_comp_nocase(Name.c_str(), "IF") == 0)
+	{
+		NextToken(Statement, Pos); // NOT
+		NextToken(Statement, Pos); // EXISTS
+		Name = NextToken(Statement, Pos);
+	}
+	Name = Unquote(Name);
+
+	const size_t Open = Statement.find('(', Pos);
+	size_t Close = Open;
+	for(int Depth = 0; Close < Statement.size(); Close++)
+	{
+		if(Statement[Close] == '\'' || Statement[Close] == '"' || Statement[Close] == '`')
+			Close = SkipQuoted(Statement, Close) - 1;
+		else if(Statement[Close] == '(')
+			Depth++;
+		else if(Statement[Close] == ')' && --Depth == 0)
+			break;
+	}
+	if(Open == std::string::npos || Close >= Statement.size())
+		return;
+
+	CDumpTable& Table = (*pTables)[Name];
+	pOrder->push_back(Name);
+	for(const auto& Definition : SplitTopLevel(Statement.substr(Open + 1, Close - Open - 1), ','))
+	{
+		size_t DefPos = 0;
+		const std::string First = NextToken(Definition, DefPos);
+		if(str_comp_nocase(First.c_str(), "PRIMARY") == 0)
+		{
+			NextToken(Definition, DefPos); // KEY
+			Table.m_PrimaryKey = IndexColumns(Definition.substr(DefPos));
+		}
+		else if(str_comp_nocase(First.c_str(), "UNIQUE") == 0 || str_comp_nocase(First.c_str(), "KEY") == 0 || str_comp_nocase(First.c_str(), "INDEX") == 0)
+		{
+			const bool Unique = str_comp_nocase(First.c_str(), "UNIQUE") == 0;
+			std::string IndexName = NextToken(Definition, DefPos);
+			if(Unique && (str_comp_nocase(IndexName.c_str(), "KEY") == 0 || str_comp_nocase(IndexName.c_str(), "INDEX") == 0))
+				IndexName = NextToken(Definition, DefPos);
+			Table.m_vIndices.push_back(std::string(Unique ? "CREATE UNIQUE INDEX " : "CREATE INDEX ") + "`" + Name + "_" + Unquote(IndexName) + "` ON `" + Name + "` " + IndexColumns(Definition.substr(DefPos)));
+		}
+		else if(str_comp_nocase(First.c_str(), "CONSTRAINT") == 0 || str_comp_nocase(First.c_str(), "FOREIGN") == 0 ||
+			str_comp_nocase(First.c_str(), "FULLTEXT") == 0 || str_comp_nocase(First.c_str(), "SPATIAL") == 0)
+		{
+			// foreign keys are not enforced by the test database
+		}
+		else if(!First.empty())
+		{
+			CDumpTable::CColumn Column;
+			Column.m_Name = Unquote(First);
+			Column.m_Type = SqliteType(NextToken(Definition, DefPos));
+			bool AutoIncrement = false;
+			Column.m_Constraints = TranslateColumnConstraints(Definition, DefPos, &AutoIncrement);
+			if(AutoIncrement)
+				Table.m_AutoIncrement = Column.m_Name;
+			Table.m_vColumns.push_back(std::move(Column));
+		}
+	}
+}
+
+static void ParseAlterTable(const std::string& Statement, std::unordered_map<std::string, CDumpTable>* pTables)
+{
+	size_t Pos = 0;
+	NextToken(Statement, Pos); // ALTER
+	NextToken(Statement, Pos); // TABLE
+	const std::string Name = Unquote(NextToken(Statement, Pos));
+	auto Iter = pTables->find(Name);
+	if(Iter == pTables->end())
+		return;
+
+	CDumpTable& Table = Iter->second;
+	for(const auto& Clause : SplitTopLevel(Statement.substr(Pos), ','))
+	{
+		size_t ClausePos = 0;
+		const std::string Action = NextToken(Clause, ClausePos);
+		if(str_comp_nocase(Action.c_str(), "ADD") == 0)
+		{
+			// the remainder is a table constraint, parsed like one inside CREATE TABLE
+			std::vector<std::string> vDummy;
+			std::unordered_map<std::string, CDumpTable> Parsed;
+			ParseCreateTable("CREATE TABLE `" + Name + "` (" + Clause.substr(ClausePos) + ")", &vDummy, &Parsed);
+			CDumpTable& Added = Parsed[Name];
+			if(!Added.m_PrimaryKey.empty())
+				Table.m_PrimaryKey = Added.m_PrimaryKey;
+			Table.m_vIndices.insert(Table.m_vIndices.end(), Added.m_vIndices.begin(), Added.m_vIndices.end());
+		}
+		else if(str_comp_nocase(Action.c_str(), "MODIFY") == 0 || str_comp_nocase(Action.c_str(), "CHANGE") == 0)
+		{
+			std::string Column = NextToken(Clause, ClausePos);
+			if(str_comp_nocase(Column.c_str(), "COLUMN") == 0)
+				Column = NextToken(Clause, ClausePos);
+			if(str_comp_nocase(Action.c_str(), "CHANGE") == 0)
+				NextToken(Clause, ClausePos); // new name
+			NextToken(Clause, ClausePos); // type
+
+			bool AutoIncrement = false;
+			TranslateColumnConstraints(Clause, ClausePos, &AutoIncrement);
+			if(AutoIncrement)
+				Table.m_AutoIncrement = Unquote(Column);
+		}
+	}
+}
+
+static std::string RenderCreateTable(const std::string& Name, const CDumpTable& Table)
+{
+	// a single integer primary key becomes the rowid, with AUTOINCREMENT if mysql had it
+	std::string RowidColumn;
+	if(!Table.m_PrimaryKey.empty() && Table.m_PrimaryKey.find(',') == std::string::npos)
+	{
+		const std::string Column = Unquote(Table.m_PrimaryKey.substr(1, Table.m_PrimaryKey.size() - 2));
+		for(const auto& Def : Table.m_vColumns)
+		{
+			if(Def.m_Name == Column && Def.m_Type == std::string("INTEGER"))
+				RowidColumn = Column;
+		}
+	}
+
+	std::string Result = "CREATE TABLE `" + Name + "` (";
+	for(size_t i = 0; i < Table.m_vColumns.size(); i++)
+	{
+		const auto& Column = Table.m_vColumns[i];
+		Result += i ? ",\n  `" : "\n  `";
+		Result += Column.m_Name + "` " + Column.m_Type;
+		if(Column.m_Name == RowidColumn)
+		{
+			Result += " PRIMARY KEY";
+			if(Table.m_AutoIncrement == RowidColumn)
+				Result += " AUTOINCREMENT";
+		}
+		if(!Column.m_Constraints.empty())
+			Result += " " + Column.m_Constraints;
+	}
+	if(!Table.m_PrimaryKey.empty() && RowidColumn.empty())
+		Result += ",\n  PRIMARY KEY " + Table.m_PrimaryKey;
+	Result += "\n)";
+	return Result;
+}
+
+std::vector<std::string> SqliteTranslateMySqlDump(const std::string& Dump)
+{
+	const std::vector<std::string> vStatements = SplitStatements(Dump);
+
+	// keys and auto increments are added by ALTER TABLE at the end of a dump, sqlite needs them up front
+	std::vector<std::string> vOrder;
+	std::unordered_map<std::string, CDumpTable> Tables;
+	for(const auto& Statement : vStatements)
+	{
+		if(StartsWithNoCase(Statement, 0, "CREATE TABLE"))
+			ParseCreateTable(Statement, &vOrder, &Tables);
+		else if(StartsWithNoCase(Statement, 0, "ALTER TABLE"))
+			ParseAlterTable(Statement, &Tables);
+	}
+
+	std::vector<std::string> vResult;
+	size_t NextTable = 0;
+	for(const auto& Statement : vStatements)
+	{
+		if(StartsWithNoCase(Statement, 0, "CREATE TABLE"))
+		{
+			const std::string& Name = vOrder[NextTable++];
+			vResult.push_back(RenderCreateTable(Name, Tables[Name]));
+		}
+		else if(StartsWithNoCase(Statement, 0, "INSERT") || StartsWithNoCase(Statement, 0, "REPLACE") ||
+			StartsWithNoCase(Statement, 0, "DROP") || StartsWithNoCase(Statement, 0, "CREATE VIEW"))
+		{
+			vResult.push_back(TranslateLiterals(Statement));
+		}
+		// SET, START TRANSACTION, COMMIT, LOCK and ALTER TABLE have no sqlite counterpart or were merged above
+	}
+
+	// indices last, filling indexed tables is slower
+	for(const auto& Name : vOrder)
+		vResult.insert(vResult.end(), Tables[Name].m_vIndices.begin(), Tables[Name].m_vIndices.end());
+	return vResult;
+}
+
+#if defined(CONF_SQLITE)
+#include <sqlite3.h>
+
+/*
+ * Result
+ */
+class CSqliteResult : public ISqlResult
+{
+	class CCell
+	{
+	public:
+		int m_Type;
+		int64_t m_Int;
+		double m_Double;
+		std::string m_Text;
+	};
+
+	std::vector<std::string> m_vColumns;
+	std::unordered_map<std::string, int> m_ColumnIndex;
+	std::vector<std::vector<CCell>> m_vRows;
+	int m_Row = -1;
+
+	const CCell& Cell(const std::string& Column) const
+	{
+		if(m_Row < 0 || m_Row >= (int)m_vRows.size())
+			throw CSqlException("no current row");
+
+		auto Iter = m_ColumnIndex.find(Column);
+		if(Iter != m_ColumnIndex.end())
+			return m_vRows[m_Row][Iter->second];
+
+		// mysql column labels are case insensitive
+		for(size_t i = 0; i < m_vColumns.size(); i++)
+		{
+			if(str_comp_nocase(m_vColumns[i].c_str(), Column.c_str()) == 0)
+				return m_vRows[m_Row][i];
+		}
+		throw CSqlException("unknown column " + Column);
+	}
+
+public:
+	// reads all rows, so the statement can be reset or finalized right after
+	explicit CSqliteResult(sqlite3* pDb, sqlite3_stmt* pStmt)
+	{
+		const int NumColumns = sqlite3_column_count(pStmt);
+		for(int i = 0; i < NumColumns; i++)
+		{
+			m_vColumns.emplace_back(sqlite3_column_name(pStmt, i));
+			m_ColumnIndex.emplace(m_vColumns.back(), i);
+		}
+
+		int Result;
+		while((Result = sqlite3_step(pStmt)) == SQLITE_ROW)
+		{
+			auto& vRow = m_vRows.emplace_back(NumColumns);
+			for(int i = 0; i < NumColumns; i++)
+			{
+				CCell& Cell = vRow[i];
+				Cell.m_Type = sqlite3_column_type(pStmt, i);
+				Cell.m_Int = sqlite3_column_int64(pStmt, i);
+				Cell.m_Double = sqlite3_column_double(pStmt, i);
+				if(Cell.m_Type == SQLITE_TEXT || Cell.m_Type == SQLITE_BLOB)
+					Cell.m_Text.assign((const char*)sqlite3_column_text(pStmt, i), sqlite3_column_bytes(pStmt, i));
+			}
+		}
+		if(Result != SQLITE_DONE)
+			throw CSqlException(sqlite3_errmsg(pDb));
+	}
+
+	bool next() override
+	{
+		if(m_Row < (int)m_vRows.size())
+			m_Row++;
+		return m_Row < (int)m_vRows.size();
+	}
+	size_t rowsCount() const override { return m_vRows.size(); }
+	size_t getRow() const override { return m_Row >= 0 && m_Row < (int)m_vRows.size() ? m_Row + 1 : 0; }
+
+	int getInt(const std::string& Column) const override { return (int)getInt64(Column); }
+	int64_t getInt64(const std::string& Column) const override
+	{
+		const CCell& Value = Cell(Column);
+		return Value.m_Type == SQLITE_FLOAT ? (int64_t)Value.m_Double : Value.m_Int;
+	}
+	double getDouble(const std::string& Column) const override { return Cell(Column).m_Double; }
+	bool getBoolean(const std::string& Column) const override { return getInt64(Column) != 0; }
+	std::string getString(const std::string& Column) const override
+	{
+		const CCell& Value = Cell(Column);
+		if(Value.m_Type == SQLITE_INTEGER)
+			return std::to_string(Value.m_Int);
+		if(Value.m_Type == SQLITE_FLOAT)
+		{
+			char aBuf[64];
+			str_format(aBuf, sizeof(aBuf), "%g", Value.m_Double);
+			return aBuf;
+		}
+		return Value.m_Text;
+	}
+	bool isNull(const std::string& Column) const override { return Cell(Column).m_Type == SQLITE_NULL; }
+};
+
+/*
+ * Statement
+ */
+class CSqliteStatement : public ISqlStatement
+{
+	sqlite3* m_pDb;
+	sqlite3_stmt* m_pStmt;
+
+	void Check(int Result) const
+	{
+		if(Result != SQLITE_OK)
+			throw CSqlException(sqlite3_errmsg(m_pDb));
+	}
+
+public:
+	CSqliteStatement(sqlite3* pDb, sqlite3_stmt* pStmt) : m_pDb(pDb), m_pStmt(pStmt) {}
+	~CSqliteStatement() override { sqlite3_finalize(m_pStmt); }
+
+	void SetInt(unsigned Index, int Value) override { Check(sqlite3_bind_int(m_pStmt, Index, Value)); }
+	void SetInt64(unsigned Index, int64_t Value) override { Check(sqlite3_bind_int64(m_pStmt, Index, Value)); }
+	void SetDouble(unsigned Index, double Value) override { Check(sqlite3_bind_double(m_pStmt, Index, Value)); }
+	void SetString(unsigned Index, const std::string& Value) override { Check(sqlite3_bind_text(m_pStmt, Index, Value.c_str(), (int)Value.size(), SQLITE_TRANSIENT)); }
+
+	std::unique_ptr<ISqlResult> ExecuteQuery() override
+	{
+		sqlite3_reset(m_pStmt);
+		try
+		{
+			auto pResult = std::make_unique<CSqliteResult>(m_pDb, m_pStmt);
+			sqlite3_reset(m_pStmt);
+			return pResult;
+		}
+		catch(CSqlException&)
+		{
+			sqlite3_reset(m_pStmt);
+			throw;
+		}
+	}
+
+	void Execute() override
+	{
+		sqlite3_reset(m_pStmt);
+		int Result;
+		while((Result = sqlite3_step(m_pStmt)) == SQLITE_ROW) {}
+		sqlite3_reset(m_pStmt);
+		if(Result != SQLITE_DONE)
+			throw CSqlException(sqlite3_errmsg(m_pDb));
+	}
+};
+
+/*
+ * Connection
+ */
+class CSqliteConnection : public ISqlConnection
+{
+	sqlite3* m_pDb;
+
+	sqlite3_stmt* Compile(const std::string& Query) const
+	{
+		if(!m_pDb)
+			throw CSqlException("connection is closed");
+
+		sqlite3_stmt* pStmt = nullptr;
+		const std::string Translated = TranslateLiterals(Query);
+		if(sqlite3_prepare_v2(m_pDb, Translated.c_str(), (int)Translated.size(), &pStmt, nullptr) != SQLITE_OK)
+		{
+			sqlite3_finalize(pStmt);
+			throw CSqlException(std::string(sqlite3_errmsg(m_pDb)) + " in: " + Query.substr(0, 256));
+		}
+		return pStmt;
+	}
+
+public:
+	explicit CSqliteConnection(sqlite3* pDb) : m_pDb(pDb) {}
+	~CSqliteConnection() override { Close(); }
+
+	bool IsClosed() override { return m_pDb == nullptr; }
+	void Close() override
+	{
+		if(m_pDb)
+			sqlite3_close_v2(m_pDb);
+		m_pDb = nullptr;
+	}
+
+	std::unique_ptr<ISqlResult> ExecuteQuery(const std::string& Query) override
+	{
+		CSqliteStatement Statement(m_pDb, Compile(Query));
+		return Statement.ExecuteQuery();
+	}
+
+	void Execute(const std::string& Query) override { ExecuteRaw(TranslateLiterals(Query)); }
+
+	// runs statements that already use sqlite syntax
+	void ExecuteRaw(const std::string& Query)
+	{
+		if(!m_pDb)
+			throw CSqlException("connection is closed");
+
+		char* pError = nullptr;
+		if(sqlite3_exec(m_pDb, Query.c_str(), nullptr, nullptr, &pError) != SQLITE_OK)
+		{
+			std::string Error = pError ? pError : "unknown error";
+			sqlite3_free(pError);
+			throw CSqlException(Error + " in: " + Query.substr(0, 256));
+		}
+	}
+
+	std::unique_ptr<ISqlStatement> Prepare(const std::string& Query) override
+	{
+		return std::make_unique<CSqliteStatement>(m_pDb, Compile(Query));
+	}
+};
+
+/*
+ * Backend
+ */
+class CSqliteBackend : public ISqlBackend
+{
+	std::string m_Uri;
+	CSqliteConnection* m_pKeeper = nullptr; // keeps a shared in-memory database alive
+
+	void LoadSchema(const char* pSchemaFile)
+	{
+		IOHANDLE File = io_open(pSchemaFile, IOFLAG_READ);
+		if(!File)
+		{
+			dbg_msg("sqlite", "schema '%s' not found, starting with an empty database", pSchemaFile);
+			return;
+		}
+
+		std::string Dump(io_length(File), '\0');
+		io_read(File, Dump.data(), Dump.size());
+		io_close(File);
+
+		// statements are run one by one so a single unsupported one doesn't stop the import
+		int Failed = 0;
+		m_pKeeper->Execute("BEGIN");
+		for(const auto& Statement : SqliteTranslateMySqlDump(Dump))
+		{
+			try
+			{
+				m_pKeeper->ExecuteRaw(Statement);
+			}
+			catch(CSqlException& e)
+			{
+				dbg_msg("sqlite", "%s", e.what());
+				Failed++;
+			}
+		}
+		m_pKeeper->Execute("COMMIT");
+		dbg_msg("sqlite", "imported schema '%s' (%d statements failed)", pSchemaFile, Failed);
+	}
+
+public:
+	CSqliteBackend(const char* pFile, const char* pSchemaFile)
+	{
+		if(pFile[0])
+		{
+			m_Uri = std::string("file:") + pFile;
+		}
+		else
+		{
+			char aBuf[64];
+			str_format(aBuf, sizeof(aBuf), "file:mrpg_%p?mode=memory&cache=shared", (void*)this);
+			m_Uri = aBuf;
+		}
+
+		m_pKeeper = Open();
+		auto pTables = m_pKeeper->ExecuteQuery("SELECT COUNT(*) AS Num FROM sqlite_master WHERE type = 'table'");
+		if(pTables->next() && pTables->getInt("Num") == 0 && pSchemaFile && pSchemaFile[0])
+			LoadSchema(pSchemaFile);
+	}
+
+	~CSqliteBackend() override { delete m_pKeeper; }
+
+	const char* Name() const override { return "sqlite"; }
+
+	ISqlConnection* Connect() override { return Open(); }
+
+	CSqliteConnection* Open()
+	{
+		sqlite3* pDb = nullptr;
+		if(sqlite3_open_v2(m_Uri.c_str(), &pDb, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI, nullptr) != SQLITE_OK)
+		{
+			std::string Error = pDb ? sqlite3_errmsg(pDb) : "out of memory";
+			sqlite3_close_v2(pDb);
+			throw CSqlException(Error);
+		}
+		sqlite3_busy_timeout(pDb, 5000);
+		return new CSqliteConnection(pDb);
+	}
+};
+
+ISqlBackend* CreateSqlBackendSqlite(const char* pFile, const char* pSchemaFile)
+{
+	return new CSqliteBackend(pFile, pSchemaFile);
+}
+
+#else
+
+ISqlBackend* CreateSqlBackendSqlite(const char* pFile, const char* pSchemaFile)
+{
+	return nullptr;
+}
+
+#endif
@@ -29,13 +29,28 @@ std::atomic_flag g_atomic_lock;
 // #####################################################
 CConectionPool::CConectionPool()
 {
+	m_pProfileCallback = CProfiler::Get()->Entry("sql/callback");
+
 	try
 	{
-		m_pDriver = get_driver_instance();
+		if(str_comp_nocase(g_Config.m_SvSqlBackend, "sqlite") == 0)
+		{
+			m_pBackend.reset(CreateSqlBackendSqlite(g_Config.m_SvSqliteFile, g_Config.m_SvSqliteSchema));
+			if(!m_pBackend)
+			{
+				dbg_msg("Sql Exception", "the server was built without sqlite support");
+				exit(0);
+			}
+		}
+		else
+		{
+			m_pBackend.reset(CreateSqlBackendMySQL(g_Config.m_SvMySqlHost, g_Config.m_SvMySqlPort, g_Config.m_SvMySqlLogin, g_Config.m_SvMySqlPassword, g_Config.m_SvMySqlDatabase));
+		}
+
 		for(int i = 0; i < g_Config.m_SvMySqlPoolSize; ++i)
 			this->CreateConnection();
 	}
-	catch (SQLException& e)
+	catch (CSqlException& e)
 	{
 		dbg_msg("Sql Exception", "%s", e.what());
 		exit(0);
@@ -45,7 +60,7 @@ CConectionPool::CConectionPool()
 CConectionPool::~CConectionPool()
 {
 	DisconnectConnectionHeap();
-	m_pDriver = nullptr;
+	m_pBackend.reset();
 }
 
 void CConectionPool::DisconnectConnectionHeap()
@@ -53,17 +68,18 @@ void CConectionPool::DisconnectConnectionHeap()
 	g_atomic_lock.test_and_set(std::memory_order_acquire);
 	while(!m_ConnList.empty())
 	{
-		Connection* pConnection = m_ConnList.front();
+		ISqlConnection* pConnection = m_ConnList.front();
 		m_ConnList.pop_front();
 
+		ReleasePreparedStatements(pConnection);
 		try
 		{
 			if(pConnection)
 			{
-				pConnection->close();
+				pConnection->Close();
 			}
 		}
-		catch(SQLException& e)
+		catch(CSqlException& e)
 		{
 			dbg_msg("Sql Exception", "%s", e.what());
 		}
@@ -73,28 +89,18 @@ void CConectionPool::DisconnectConnectionHeap()
 	g_atomic_lock.clear(std::memory_order_release);
 }
 
-Connection* CConectionPool::CreateConnection()
+ISqlConnection* CConectionPool::CreateConnection()
 {
-	Connection* pConnection = nullptr;
+	ISqlConnection* pConnection = nullptr;
 	while (pConnection == nullptr)
 	{
 		try
 		{
-			std::string Hostname(g_Config.m_SvMySqlHost);
-			Hostname.append(":" + std::to_string(g_Config.m_SvMySqlPort));
-
-			pConnection = m_pDriver->connect(Hostname.c_str(), g_Config.m_SvMySqlLogin, g_Config.m_SvMySqlPassword);
-			pConnection->setClientOption("OPT_CHARSET_NAME", "utf8mb4");
-			pConnection->setClientOption("OPT_CONNECT_TIMEOUT", "10");
-			pConnection->setClientOption("OPT_READ_TIMEOUT", "10");
-			pConnection->setClientOption("OPT_WRITE_TIMEOUT", "20");
-			pConnection->setClientOption("OPT_RECONNECT", "1");
-			pConnection->setSchema(g_Config.m_SvMySqlDatabase);
+			pConnection = m_pBackend->Connect();
 		}
-		catch (SQLException& e)
+		catch (CSqlException& e)
 		{
 			dbg_msg("Sql Exception", "%s", e.what());
-			DisconnectConnection(pConnection);
 		}
 	}
 
@@ -104,9 +110,9 @@ Connection* CConectionPool::CreateConnection()
 	return pConnection;
 }
 
-Connection* CConectionPool::GetConnection()
+ISqlConnection* CConectionPool::GetConnection()
 {
-	Connection* pConnection;
+	ISqlConnection* pConnection;
 	if(m_ConnList.empty())
 	{
 		pConnection = CreateConnection();
@@ -118,8 +124,9 @@ Connection* CConectionPool::GetConnection()
 	m_ConnList.pop_front();
 	g_atomic_lock.clear(std::memory_order_relaxed);
 
-	if (pConnection->isClosed())
+	if (pConnection->IsClosed())
 	{
+		ReleasePreparedStatements(pConnection);
 		delete pConnection;
 		pConnection = CreateConnection();
 	}
@@ -127,7 +134,7 @@ Connection* CConectionPool::GetConnection()
 	return pConnection;
 }
 
-void CConectionPool::ReleaseConnection(Connection* pConnection)
+void CConectionPool::ReleaseConnection(ISqlConnection* pConnection)
 {
 	if(pConnection)
 	{
@@ -137,16 +144,17 @@ void CConectionPool::ReleaseConnection(Connection* pConnection)
 	}
 }
 
-void CConectionPool::DisconnectConnection(Connection* pConnection)
+void CConectionPool::DisconnectConnection(ISqlConnection* pConnection)
 {
+	ReleasePreparedStatements(pConnection);
 	try
 	{
 		if(pConnection)
 		{
-			pConnection->close();
+			pConnection->Close();
 		}
 	}
-	catch (SQLException& e)
+	catch (CSqlException& e)
 	{
 		dbg_msg("Sql Exception", "%s", e.what());
 	}
@@ -155,4 +163,124 @@ void CConectionPool::DisconnectConnection(Connection* pConnection)
 	m_ConnList.remove(pConnection);
 	delete pConnection;
 	g_atomic_lock.clear(std::memory_order_release);
-}
\ No newline at end of file
+}
+
+ISqlStatement* CConectionPool::GetPreparedStatement(ISqlConnection* pConnection, int ID, const std::string& Query)
+{
+	auto& vSlots = m_PreparedStatements[pConnection];
+	if(ID >= (int)vSlots.size())
+		vSlots.resize(ID + 1);
+
+	// the same id with another query text replaces the cached statement
+	CPreparedSlot& Slot = vSlots[ID];
+	if(!Slot.m_pStatement || Slot.m_Query != Query)
+	{
+		Slot.m_pStatement.reset();
+		Slot.m_pStatement = pConnection->Prepare(Query);
+		Slot.m_Query = Query;
+	}
+	return Slot.m_pStatement.get();
+}
+
+void CConectionPool::ReleasePreparedStatements(ISqlConnection* pConnection)
+{
+	g_SqlThreadRecursiveLock.lock();
+	auto Iter = m_PreparedStatements.find(pConnection);
+	if(Iter != m_PreparedStatements.end())
+	{
+		try
+		{
+			Iter->second.clear();
+		}
+		catch(CSqlException& e)
+		{
+			dbg_msg("Sql Exception", "%s", e.what());
+		}
+		m_PreparedStatements.erase(Iter);
+	}
+	g_SqlThreadRecursiveLock.unlock();
+}
+
+bool CConectionPool::CResultPrepared::Run(int ID, const std::string& Query, const std::vector<BindValue>& vBinds, const CallbackResultPtr& pCallbackResult)
+{
+	bool Success = true;
+
+	g_SqlThreadRecursiveLock.lock();
+	Database->m_pBackend->ThreadInit();
+	ISqlConnection* pConnection = Database->GetConnection();
+	try
+	{
+		ISqlStatement* pStmt = Database->GetPreparedStatement(pConnection, ID, Query);
+		for(unsigned i = 0; i < vBinds.size(); i++)
+		{
+			const unsigned Index = i + 1;
+			std::visit([pStmt, Index](const auto& Value)
+			{
+				using T = std::decay_t<decltype(Value)>;
+				if constexpr(std::is_same_v<T, int>)
+					pStmt->SetInt(Index, Value);
+				else if constexpr(std::is_same_v<T, int64_t>)
+					pStmt->SetInt64(Index, Value);
+				else if constexpr(std::is_same_v<T, double>)
+					pStmt->SetDouble(Index, Value);
+				else
+					pStmt->SetString(Index, Value);
+			}, vBinds[i]);
+		}
+
+		if(pCallbackResult)
+		{
+			// the result set reads from the statement buffers, so it is consumed before the connection is released
+			ResultPtr pResult = pStmt->ExecuteQuery();
+			PROFILE_SCOPE(Database->m_pProfileCallback);
+			pCallbackResult(std::move(pResult));
+		}
+		else
+		{
+			pStmt->Execute();
+		}
+	}
+	catch(CSqlException& e)
+	{
+		// a failed statement may belong to a dropped session, prepare it again next time
+		dbg_msg("SQL", "%s", e.what());
+		Database->ReleasePreparedStatements(pConnection);
+		Success = false;
+	}
+	Database->ReleaseConnection(pConnection);
+	Database->m_pBackend->ThreadEnd();
+	g_SqlThreadRecursiveLock.unlock();
+	return Success;
+}
+
+bool CConectionPool::ExecuteTransaction(const std::function<void(ISqlConnection*)>& pCallback)
+{
+	bool Success = true;
+
+	g_SqlThreadRecursiveLock.lock();
+	Database->m_pBackend->ThreadInit();
+	ISqlConnection* pConnection = Database->GetConnection();
+	try
+	{
+		pConnection->Execute("BEGIN");
+		pCallback(pConnection);
+		pConnection->Execute("COMMIT");
+	}
+	catch(CSqlException& e)
+	{
+		dbg_msg("SQL", "%s", e.what());
+		try
+		{
+			pConnection->Execute("ROLLBACK");
+		}
+		catch(CSqlException&)
+		{
+			// the session is gone, the server has dropped the transaction with it
+		}
+		Success = false;
+	}
+	Database->ReleaseConnection(pConnection);
+	Database->m_pBackend->ThreadEnd();
+	g_SqlThreadRecursiveLock.unlock();
+	return Success;
+}
@@ -1,22 +1,14 @@
 #ifndef ENGINE_SERVER_SQL_CONNECT_POOL_H
 #define ENGINE_SERVER_SQL_CONNECT_POOL_H
 
-// fix c++17 error with removed throw()
-#if __cplusplus >= 201703L
-	#define throw(...)
-	#include <cppconn/driver.h>
-	#include <cppconn/statement.h>
-	#include <cppconn/resultset.h>
-	#undef throw /* reset */
-#else
-	#include <cppconn/driver.h>
-	#include <cppconn/statement.h>
-	#include <cppconn/resultset.h>
-#endif
+#include "sql_backend.h"
 
-#include <cstdarg>
+#include <engine/shared/profiler.h>
 
-using namespace sql;
+#include <cstdarg>
+#include <unordered_map>
+#include <variant>
+#include <vector>
 
 /*
  * enums
@@ -50,7 +42,7 @@ inline std::recursive_mutex g_SqlThreadRecursiveLock;
 /*
  * using typename
  */
-using ResultPtr = std::unique_ptr<ResultSet>;
+using ResultPtr = std::unique_ptr<ISqlResult>;
 using CallbackResultPtr = std::function<void(ResultPtr)>;
 using CallbackUpdatePtr = std::function<void()>;
 
@@ -78,19 +70,31 @@ public:
 private:
 	CConectionPool();
 
-	Connection* CreateConnection();
-	Connection* GetConnection();
-	void ReleaseConnection(Connection* pConnection);
-	void DisconnectConnection(Connection* pConnection);
+	ISqlConnection* CreateConnection();
+	ISqlConnection* GetConnection();
+	void ReleaseConnection(ISqlConnection* pConnection);
+	void DisconnectConnection(ISqlConnection* pConnection);
+
+	std::list< ISqlConnection* > m_ConnList;
+	std::unique_ptr<ISqlBackend> m_pBackend;
+	CProfileEntry* m_pProfileCallback {};
 
-	std::list< Connection* > m_ConnList;
-	Driver* m_pDriver;
+	// prepared statements of each connection indexed by statement id, guarded by g_SqlThreadRecursiveLock
+	struct CPreparedSlot
+	{
+		std::string m_Query;
+		std::unique_ptr<ISqlStatement> m_pStatement;
+	};
+	std::unordered_map<ISqlConnection*, std::vector<CPreparedSlot>> m_PreparedStatements;
+	ISqlStatement* GetPreparedStatement(ISqlConnection* pConnection, int ID, const std::string& Query);
+	void ReleasePreparedStatements(ISqlConnection* pConnection);
 
 public:
 	~CConectionPool();
 
 	// functions
 	void DisconnectConnectionHeap();
+	const char* GetBackendName() const { return m_pBackend->Name(); }
 
 	// database extraction function
 private:
@@ -117,28 +121,26 @@ private:
 
 		[[nodiscard]] ResultPtr Execute() const
 		{
-			const char* pError = nullptr;
+			std::string Error;
 
 			g_SqlThreadRecursiveLock.lock();
-			Database->m_pDriver->threadInit();
-			Connection* pConnection = Database->GetConnection();
+			Database->m_pBackend->ThreadInit();
+			ISqlConnection* pConnection = Database->GetConnection();
 			ResultPtr pResult = nullptr;
 			try
 			{
-				const std::unique_ptr<Statement> pStmt(pConnection->createStatement());
-				pResult.reset(pStmt->executeQuery(m_Query.c_str()));
-				pStmt->close();
+				pResult = pConnection->ExecuteQuery(m_Query);
 			}
-			catch (SQLException& e)
+			catch (CSqlException& e)
 			{
-				pError = e.what();
+				Error = e.what();
 			}
 			Database->ReleaseConnection(std::move(pConnection));
-			Database->m_pDriver->threadEnd();
+			Database->m_pBackend->ThreadEnd();
 			g_SqlThreadRecursiveLock.unlock();
 
-			if (pError != nullptr)
-				dbg_msg("SQL", "%s", pError);
+			if (!Error.empty())
+				dbg_msg("SQL", "%s", Error.c_str());
 
 			return std::move(pResult);
 		}
@@ -147,31 +149,30 @@ private:
 		{
 			auto Item = [pCallbackResult](const std::string Query)
 			{
-				const char* pError = nullptr;
+				std::string Error;
 
 				g_SqlThreadRecursiveLock.lock();
-				Database->m_pDriver->threadInit();
-				Connection* pConnection = Database->GetConnection();
+				Database->m_pBackend->ThreadInit();
+				ISqlConnection* pConnection = Database->GetConnection();
 				try
 				{
-					const std::unique_ptr<Statement> pStmt(pConnection->createStatement());
-					ResultPtr pResult(pStmt->executeQuery(Query.c_str()));
+					ResultPtr pResult = pConnection->ExecuteQuery(Query);
 					if(pCallbackResult)
 					{
+						PROFILE_SCOPE(Database->m_pProfileCallback);
 						pCallbackResult(std::move(pResult));
 					}
-					pStmt->close();
 				}
-				catch (SQLException& e)
+				catch (CSqlException& e)
 				{
-					pError = e.what();
+					Error = e.what();
 				}
 				Database->ReleaseConnection(std::move(pConnection));
-				Database->m_pDriver->threadEnd();
+				Database->m_pBackend->ThreadEnd();
 				g_SqlThreadRecursiveLock.unlock();
 
-				if (pError != nullptr)
-					dbg_msg("SQL", "%s", pError);
+				if (!Error.empty())
+					dbg_msg("SQL", "%s", Error.c_str());
 			};
 			std::thread(Item, m_Query).detach();
 		}
@@ -201,31 +202,30 @@ private:
 				if (Milliseconds > 0)
 					std::this_thread::sleep_for(std::chrono::milliseconds(Milliseconds));
 
-				const char* pError = nullptr;
+				std::string Error;
 
 				g_SqlThreadRecursiveLock.lock();
-				Database->m_pDriver->threadInit();
-				Connection* pConnection = Database->GetConnection();
+				Database->m_pBackend->ThreadInit();
+				ISqlConnection* pConnection = Database->GetConnection();
 				try
 				{
-					const std::unique_ptr<Statement> pStmt(pConnection->createStatement());
-					pStmt->execute(Query.c_str());
+					pConnection->Execute(Query);
 					if(pCallbackResult)
 					{
+						PROFILE_SCOPE(Database->m_pProfileCallback);
 						pCallbackResult();
 					}
-					pStmt->close();
 				}
-				catch (SQLException& e)
+				catch (CSqlException& e)
 				{
-					pError = e.what();
+					Error = e.what();
 				}
 				Database->ReleaseConnection(std::move(pConnection));
-				Database->m_pDriver->threadEnd();
+				Database->m_pBackend->ThreadEnd();
 				g_SqlThreadRecursiveLock.unlock();
 
-				if (pError != nullptr)
-					dbg_msg("SQL", "%s", pError);
+				if (!Error.empty())
+					dbg_msg("SQL", "%s", Error.c_str());
 			};
 			std::thread(Item, m_Query, DelayMilliseconds).detach();
 		}
@@ -244,6 +244,50 @@ private:
 		}
 	};
 
+	class CResultPrepared : public CResultBase
+	{
+		friend class CConectionPool;
+		using BindValue = std::variant<int, int64_t, double, std::string>;
+
+		int m_ID {};
+		std::vector<BindValue> m_vBinds;
+
+		// runs the statement on a pool connection, the result set is only valid inside the callback
+		static bool Run(int ID, const std::string& Query, const std::vector<BindValue>& vBinds, const CallbackResultPtr& pCallbackResult);
+
+	public:
+		// values are bound to the placeholders in the order of the calls
+		CResultPrepared& Bind(int Value) { m_vBinds.emplace_back(Value); return *this; }
+		CResultPrepared& Bind(int64_t Value) { m_vBinds.emplace_back(Value); return *this; }
+		CResultPrepared& Bind(double Value) { m_vBinds.emplace_back(Value); return *this; }
+		CResultPrepared& Bind(const char* pValue) { m_vBinds.emplace_back(std::string(pValue)); return *this; }
+		CResultPrepared& Bind(const std::string& Value) { m_vBinds.emplace_back(Value); return *this; }
+
+		bool ExecuteSelect(const CallbackResultPtr& pCallbackResult) const { return Run(m_ID, m_Query, m_vBinds, pCallbackResult); }
+
+		void AtExecuteSelect(const CallbackResultPtr& pCallbackResult)
+		{
+			std::thread(Run, m_ID, m_Query, m_vBinds, pCallbackResult).detach();
+		}
+
+		void AtExecute(const CallbackUpdatePtr& pCallbackResult, int DelayMilliseconds = 0)
+		{
+			auto Item = [pCallbackResult](int ID, const std::string Query, const std::vector<BindValue> vBinds, const int Milliseconds)
+			{
+				if(Milliseconds > 0)
+					std::this_thread::sleep_for(std::chrono::milliseconds(Milliseconds));
+
+				if(Run(ID, Query, vBinds, nullptr) && pCallbackResult)
+				{
+					PROFILE_SCOPE(Database->m_pProfileCallback);
+					pCallbackResult();
+				}
+			};
+			std::thread(Item, m_ID, m_Query, m_vBinds, DelayMilliseconds).detach();
+		}
+		void Execute(int DelayMilliseconds = 0) { return AtExecute(nullptr, DelayMilliseconds); }
+	};
+
 	// - - - - - - - - - - - - - - - -
 	// select
 	// - - - - - - - - - - - - - - - -
@@ -277,6 +321,23 @@ public:
 		return PrepareQuerySelect(T, pSelect, pTable, strQuery)->Execute();
 	}
 
+	// - - - - - - - - - - - - - - - -
+	// prepared : parsed once per connection, arguments bound instead of formatted
+	// - - - - - - - - - - - - - - - -
+	static std::unique_ptr<CResultPrepared> Prepare(int ID, const char* pQuery)
+	{
+		auto pData = std::make_unique<CResultPrepared>();
+		pData->m_ID = ID;
+		pData->m_Query = pQuery;
+		pData->m_TypeQuery = DB::OTHER;
+		return pData;
+	}
+
+	// - - - - - - - - - - - - - - - -
+	// transaction : the statements of the callback run on one connection and are committed together
+	// - - - - - - - - - - - - - - - -
+	static bool ExecuteTransaction(const std::function<void(ISqlConnection*)>& pCallback);
+
 	// - - - - - - - - - - - - - - - -
 	// custom
 	// - - - - - - - - - - - - - - - -
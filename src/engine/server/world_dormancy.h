@@ -0,0 +1,74 @@
+#ifndef ENGINE_SERVER_WORLD_DORMANCY_H
+#define ENGINE_SERVER_WORLD_DORMANCY_H
+
+/*
+ * A world without players is ticked for a while and then put to sleep.
+ * While dormant nothing in it runs, so countdown timers stay where they
+ * were, and the skipped ticks are handed to the catch-up on wake.
+ */
+class CWorldDormancy
+{
+public:
+	enum EState
+	{
+		STATE_ACTIVE = 0,
+		STATE_EMPTY, // no players, still ticking until the delay passed
+		STATE_DORMANT,
+	};
+
+	// called once per server tick, returns whether the world is ticked, DelayTicks <= 0 never sleeps
+	bool Update(int Tick, bool HasPlayers, int DelayTicks)
+	{
+		if(HasPlayers || DelayTicks <= 0)
+		{
+			Wake(Tick);
+			return true;
+		}
+
+		if(m_State == STATE_ACTIVE)
+		{
+			m_State = STATE_EMPTY;
+			m_EmptySince = Tick;
+		}
+		if(m_State == STATE_EMPTY && Tick - m_EmptySince >= DelayTicks)
+		{
+			m_State = STATE_DORMANT;
+			m_DormantSince = Tick;
+		}
+		return m_State != STATE_DORMANT;
+	}
+
+	// a player is about to enter, the skipped ticks wait in TakeCatchUp
+	void Wake(int Tick)
+	{
+		if(m_State == STATE_DORMANT)
+		{
+			m_PendingCatchUp += Tick - m_DormantSince;
+			m_FrozenTicks += Tick - m_DormantSince;
+		}
+		m_State = STATE_ACTIVE;
+	}
+
+	// ticks skipped since the last catch-up, 0 if the world did not sleep
+	int TakeCatchUp()
+	{
+		const int Ticks = m_PendingCatchUp;
+		m_PendingCatchUp = 0;
+		return Ticks;
+	}
+
+	void Reset() { *this = CWorldDormancy(); }
+
+	EState State() const { return m_State; }
+	bool IsDormant() const { return m_State == STATE_DORMANT; }
+	int FrozenTicks() const { return m_FrozenTicks; }
+
+private:
+	EState m_State = STATE_ACTIVE;
+	int m_EmptySince = 0;
+	int m_DormantSince = 0;
+	int m_FrozenTicks = 0;
+	int m_PendingCatchUp = 0;
+};
+
+#endif
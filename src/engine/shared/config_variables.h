@@ -151,6 +151,12 @@ MACRO_CONFIG_INT(SvIpv4Only, sv_ipv4only, 0, 0, 1, CFGFLAG_SERVER, "Whether to b
 MACRO_CONFIG_INT(SvPort, sv_port, 0, 0, 0, CFGFLAG_SERVER, "Port to use for the server (Only ports 8303-8310 work in LAN server browser, 0 to automatically find a free port in 8303-8310)")
 MACRO_CONFIG_STR(SvMap, sv_map, 128, "Multiworlds", CFGFLAG_SERVER, "Map name to use on the server")
 MACRO_CONFIG_INT(SvMaxClientsPerIP, sv_max_clients_per_ip, 4, 1, MAX_CLIENTS, CFGFLAG_SERVER, "Maximum number of clients with the same IP that can connect to the server")
+MACRO_CONFIG_INT(SvNetBatching, sv_net_batching, 1, 0, 1, CFGFLAG_SERVER, "Queue outgoing packets and send them once per server loop with a single sendmmsg call (Linux only, requires a restart)")
+MACRO_CONFIG_INT(SvNetThread, sv_net_thread, 0, 0, 1, CFGFLAG_SERVER, "Receive and classify packets on a separate network thread (requires a restart)")
+MACRO_CONFIG_INT(SvProfileDump, sv_profile_dump, 0, 0, 86400, CFGFLAG_SERVER, "Append the tick profiler report to sv_profile_file every this many seconds (0 = off, requires TICK_PROFILER)")
+MACRO_CONFIG_INT(SvLogDrainBudget, sv_log_drain_budget, 256, 1, 65536, CFGFLAG_SERVER, "Maximum number of log lines from other threads sent to rcon and econ per server loop")
+MACRO_CONFIG_STR(SvProfileFile, sv_profile_file, 128, "profile.txt", CFGFLAG_SERVER, "File the tick profiler report is appended to")
+MACRO_CONFIG_INT(SvWorldDormancy, sv_world_dormancy, 60, 0, 3600, CFGFLAG_SERVER, "Seconds a world without players keeps ticking before it goes dormant (0 = never)")
 MACRO_CONFIG_INT(SvHighBandwidth, sv_high_bandwidth, 0, 0, 1, CFGFLAG_SERVER, "Use high bandwidth mode. Doubles the bandwidth required for the server. LAN use only")
 MACRO_CONFIG_STR(SvRegister, sv_register, 16, "1", CFGFLAG_SERVER, "Register server with master server for public listing, can also accept a comma-separated list of protocols to register on, like 'ipv4,ipv6'")
 MACRO_CONFIG_STR(SvRegisterExtra, sv_register_extra, 256, "", CFGFLAG_SERVER, "Extra headers to send to the register endpoint, comma separated 'Header: Value' pairs")
@@ -18,9 +18,22 @@ static char EscapeJsonChar(char c)
 	}
 }
 
-CJsonWriter::CJsonWriter()
+CJsonWriter::CJsonWriter() :
+	CJsonWriter(false)
+{
+}
+
+CJsonWriter::CJsonWriter(bool Compact)
 {
 	m_Indentation = 0;
+	m_Compact = Compact;
+}
+
+void CJsonWriter::ResetState()
+{
+	while(!m_States.empty())
+		m_States.pop();
+	m_Indentation = 0;
 }
 
 void CJsonWriter::BeginObject()
@@ -62,7 +75,7 @@ void CJsonWriter::WriteAttribute(const char *pName)
 	dbg_assert(TopState()->m_Kind == STATE_OBJECT, "Cannot write attribute here");
 	WriteIndent(false);
 	WriteInternalEscaped(pName);
-	WriteInternal(": ");
+	WriteInternal(m_Compact ? ":" : ": ");
 	PushState(STATE_ATTRIBUTE);
 }
 
@@ -153,6 +166,9 @@ void CJsonWriter::WriteIndent(bool EndElement)
 	if(NotRootOrAttribute && !TopState()->m_Empty && !EndElement)
 		WriteInternal(",");
 
+	if(m_Compact)
+		return;
+
 	if(NotRootOrAttribute || EndElement)
 		WriteInternal("\n");
 
@@ -232,3 +248,19 @@ std::string &&CJsonStringWriter::GetOutputString()
 	m_RetrievedOutput = true; // prevent further usage of this writer
 	return std::move(m_OutputString);
 }
+
+CJsonBufferWriter::CJsonBufferWriter() :
+	CJsonWriter(true)
+{
+}
+
+void CJsonBufferWriter::Clear()
+{
+	ResetState();
+	m_Buffer.clear();
+}
+
+void CJsonBufferWriter::WriteInternal(const char *pStr, int Length)
+{
+	m_Buffer.append(pStr, Length < 0 ? str_length(pStr) : Length);
+}
@@ -6,6 +6,8 @@
 #include <base/system.h>
 
 #include <stack>
+#include <string>
+#include <vector>
 
 /**
  * JSON writer with abstract writing function.
@@ -30,8 +32,9 @@ class CJsonWriter
 		}
 	};
 
-	std::stack<SState> m_States;
+	std::stack<SState, std::vector<SState>> m_States;
 	int m_Indentation;
+	bool m_Compact;
 
 	bool CanWriteDatatype();
 	void WriteInternalEscaped(const char *pStr);
@@ -45,6 +48,11 @@ protected:
 	// String must be zero-terminated when Length is -1.
 	virtual void WriteInternal(const char *pStr, int Length = -1) = 0;
 
+	// Compact output leaves out all whitespace.
+	CJsonWriter(bool Compact);
+	// Forget the current document to begin a new root.
+	void ResetState();
+
 public:
 	CJsonWriter();
 	virtual ~CJsonWriter() = default;
@@ -114,4 +122,22 @@ public:
 	std::string &&GetOutputString();
 };
 
+/**
+ * Writes compact JSON into a buffer that is kept for the next document.
+ */
+class CJsonBufferWriter : public CJsonWriter
+{
+	std::string m_Buffer;
+
+protected:
+	void WriteInternal(const char *pStr, int Length = -1) override;
+
+public:
+	CJsonBufferWriter();
+	// Begin a new document, the buffer keeps its capacity.
+	void Clear();
+	const char *GetOutput() const { return m_Buffer.c_str(); }
+	int GetOutputLength() const { return (int)m_Buffer.size(); }
+};
+
 #endif
@@ -0,0 +1,51 @@
+#include "log_queue.h"
+
+#include <base/math.h>
+#include <base/system.h>
+
+void CLogRecord::Set(const CLogMessage *pMessage)
+{
+	m_Level = pMessage->m_Level;
+	m_HaveColor = pMessage->m_HaveColor;
+	m_Color = pMessage->m_Color;
+	str_copy(m_aSystem, pMessage->m_aSystem, sizeof(m_aSystem));
+	m_TimestampLength = pMessage->m_TimestampLength;
+	m_SystemLength = pMessage->m_SystemLength;
+	m_LineMessageOffset = pMessage->m_LineMessageOffset;
+	if(pMessage->m_LineLength < (int)sizeof(m_aLine))
+	{
+		mem_copy(m_aLine, pMessage->m_aLine, pMessage->m_LineLength + 1);
+		m_LineLength = pMessage->m_LineLength;
+	}
+	else
+	{
+		m_LineLength = str_copy(m_aLine, pMessage->m_aLine, sizeof(m_aLine));
+		m_LineMessageOffset = minimum(m_LineMessageOffset, m_LineLength);
+	}
+}
+
+void CLogRecord::Get(CLogMessage *pMessage) const
+{
+	pMessage->m_Level = m_Level;
+	pMessage->m_HaveColor = m_HaveColor;
+	pMessage->m_Color = m_Color;
+	str_copy(pMessage->m_aSystem, m_aSystem, sizeof(pMessage->m_aSystem));
+	str_truncate(pMessage->m_aTimestamp, sizeof(pMessage->m_aTimestamp), m_aLine, m_TimestampLength);
+	pMessage->m_TimestampLength = m_TimestampLength;
+	pMessage->m_SystemLength = m_SystemLength;
+	mem_copy(pMessage->m_aLine, m_aLine, m_LineLength + 1);
+	pMessage->m_LineLength = m_LineLength;
+	pMessage->m_LineMessageOffset = m_LineMessageOffset;
+}
+
+void CLogQueue::Init(unsigned Capacity)
+{
+	dbg_assert(Capacity && (Capacity & (Capacity - 1)) == 0, "log queue capacity must be a power of two");
+	m_pSlots = std::make_unique<CSlot[]>(Capacity);
+	for(unsigned i = 0; i < Capacity; i++)
+		m_pSlots[i].m_Sequence.store(i, std::memory_order_relaxed);
+	m_Mask = Capacity - 1;
+	m_Head.store(0);
+	m_Tail = 0;
+	m_Dropped.store(0);
+}
@@ -0,0 +1,104 @@
+#ifndef ENGINE_SHARED_LOG_QUEUE_H
+#define ENGINE_SHARED_LOG_QUEUE_H
+
+#include <base/logger.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// fixed size copy of a log message, longer lines are cut
+class CLogRecord
+{
+public:
+	enum
+	{
+		MAX_LINE_LENGTH = 1024,
+	};
+
+	LEVEL m_Level;
+	bool m_HaveColor;
+	LOG_COLOR m_Color;
+	char m_aSystem[32];
+	int m_TimestampLength;
+	int m_SystemLength;
+	int m_LineLength;
+	int m_LineMessageOffset;
+	char m_aLine[MAX_LINE_LENGTH];
+
+	void Set(const CLogMessage *pMessage);
+	void Get(CLogMessage *pMessage) const;
+};
+
+// bounded multi producer single consumer queue of log records
+// every slot carries a sequence number telling whose turn it is, producers claim a slot
+// with one compare exchange and never wait for each other or for the consumer
+class CLogQueue
+{
+	struct CSlot
+	{
+		std::atomic<uint64_t> m_Sequence;
+		CLogRecord m_Record;
+	};
+
+	std::unique_ptr<CSlot[]> m_pSlots;
+	uint64_t m_Mask = 0;
+	alignas(64) std::atomic<uint64_t> m_Head {0}; // claimed by the producers
+	alignas(64) uint64_t m_Tail = 0; // consumer only
+	alignas(64) std::atomic<uint64_t> m_Dropped {0};
+
+public:
+	void Init(unsigned Capacity); // power of two
+
+	// any thread, a full queue drops the message and counts it
+	bool Push(const CLogMessage *pMessage)
+	{
+		uint64_t Pos = m_Head.load(std::memory_order_relaxed);
+		while(true)
+		{
+			CSlot &Slot = m_pSlots[Pos & m_Mask];
+			const int64_t Diff = (int64_t)(Slot.m_Sequence.load(std::memory_order_acquire) - Pos);
+			if(Diff == 0)
+			{
+				if(m_Head.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+				{
+					Slot.m_Record.Set(pMessage);
+					Slot.m_Sequence.store(Pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if(Diff < 0)
+			{
+				m_Dropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			else
+			{
+				Pos = m_Head.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// consumer only, hands Fn(const CLogRecord &) at most Budget records in order, returns how many
+	template<typename F>
+	int Drain(int Budget, F &&Fn)
+	{
+		int Num = 0;
+		for(; Num < Budget; Num++)
+		{
+			CSlot &Slot = m_pSlots[m_Tail & m_Mask];
+			if(Slot.m_Sequence.load(std::memory_order_acquire) != m_Tail + 1)
+				break;
+			Fn(Slot.m_Record);
+			Slot.m_Sequence.store(m_Tail + m_Mask + 1, std::memory_order_release);
+			m_Tail++;
+		}
+		return Num;
+	}
+
+	// consumer only
+	bool Empty() const { return m_pSlots[m_Tail & m_Mask].m_Sequence.load(std::memory_order_acquire) != m_Tail + 1; }
+	uint64_t Dropped() const { return m_Dropped.load(std::memory_order_relaxed); }
+};
+
+#endif
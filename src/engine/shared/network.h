@@ -11,6 +11,7 @@
 
 class CHuffman;
 class CNetBan;
+class CNetRecvThread;
 class CPacker;
 
 /*
@@ -263,6 +264,10 @@ public:
 	int Feed(CNetPacketConstruct *pPacket, NETADDR *pAddr, SECURITY_TOKEN SecurityToken = NET_SECURITY_TOKEN_UNSUPPORTED);
 	int QueueChunk(int Flags, int DataSize, const void *pData);
 
+	// unreliable chunk written straight into the packet construct
+	unsigned char *QueueChunkBegin(int MaxDataSize);
+	void QueueChunkEnd(int DataSize);
+
 	const char *ErrorString();
 	void SignalResend();
 	int State() const { return m_State; }
@@ -383,6 +388,7 @@ class CNetServer
 	CSpamConn m_aSpamConns[NET_CONNLIMIT_IPS];
 
 	CNetRecvUnpacker m_RecvUnpacker;
+	CNetRecvThread *m_pRecvThread;
 
 	void OnTokenCtrlMsg(NETADDR &Addr, int ControlMsg, const CNetPacketConstruct &Packet);
 	void OnPreConnMsg(NETADDR &Addr, CNetPacketConstruct &Packet);
@@ -407,6 +413,10 @@ public:
 	//
 	int Recv(CNetChunk *pChunk, SECURITY_TOKEN *pResponseToken);
 	int Send(CNetChunk *pChunk);
+	unsigned char *SendBegin(int ClientID, int MaxDataSize);
+	void SendEnd(int ClientID, int DataSize, int Flags);
+	int Flush();
+	bool Wait(int Microseconds);
 	int Update();
 
 	//
@@ -420,6 +430,7 @@ public:
 	CNetBan *NetBan() const { return m_pNetBan; }
 	int NetType() const { return net_socket_type(m_Socket); }
 	int MaxClients() const { return m_MaxClients; }
+	const CNetRecvThread *RecvThread() const { return m_pRecvThread; }
 
 	//
 	void SetMaxClientsPerIP(int Max);
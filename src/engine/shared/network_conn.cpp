@@ -163,6 +163,31 @@ int CNetConnection::QueueChunk(int Flags, int DataSize, const void *pData)
 	return QueueChunkEx(Flags, DataSize, pData, m_Sequence);
 }
 
+unsigned char *CNetConnection::QueueChunkBegin(int MaxDataSize)
+{
+	if(m_State == NET_CONNSTATE_OFFLINE || m_State == NET_CONNSTATE_ERROR)
+		return nullptr;
+
+	// check if we have space for it, if not, flush the connection
+	if(m_Construct.m_DataSize + MaxDataSize + NET_MAX_CHUNKHEADERSIZE > (int)sizeof(m_Construct.m_aChunkData) - (int)sizeof(SECURITY_TOKEN))
+		Flush();
+
+	// the header of a non vital chunk is always two bytes, the payload follows it
+	return &m_Construct.m_aChunkData[m_Construct.m_DataSize + 2];
+}
+
+void CNetConnection::QueueChunkEnd(int DataSize)
+{
+	CNetChunkHeader Header;
+	Header.m_Flags = 0;
+	Header.m_Size = DataSize;
+	Header.m_Sequence = m_Sequence;
+	unsigned char *pChunkData = Header.Pack(&m_Construct.m_aChunkData[m_Construct.m_DataSize], 4);
+
+	m_Construct.m_NumChunks++;
+	m_Construct.m_DataSize = (int)(pChunkData + DataSize - m_Construct.m_aChunkData);
+}
+
 void CNetConnection::SendConnect()
 {
 	// send the connect message
@@ -6,6 +6,7 @@
 #include "config.h"
 #include "netban.h"
 #include "network.h"
+#include "network_thread.h"
 #include <engine/shared/compression.h>
 #include <engine/shared/packer.h>
 #include <engine/shared/protocol.h>
@@ -69,6 +70,18 @@ bool CNetServer::Open(NETADDR BindAddr, CNetBan *pNetBan, int MaxClients, int Ma
 	for(auto &Slot : m_aSlots)
 		Slot.m_Connection.Init(m_Socket, true);
 
+	net_udp_set_send_batching(m_Socket, g_Config.m_SvNetBatching);
+
+	if(g_Config.m_SvNetThread)
+	{
+		m_pRecvThread = new CNetRecvThread();
+		if(!m_pRecvThread->Start(m_Socket))
+		{
+			dbg_msg("net", "failed to start the network thread, receiving on the server thread");
+			delete m_pRecvThread;
+			m_pRecvThread = nullptr;
+		}
+	}
 	return true;
 }
 
@@ -94,9 +107,24 @@ int CNetServer::Close()
 {
 	if(!m_Socket)
 		return 0;
+	delete m_pRecvThread;
+	m_pRecvThread = nullptr;
+	net_udp_flush(m_Socket);
 	return net_udp_close(m_Socket);
 }
 
+int CNetServer::Flush()
+{
+	return net_udp_flush(m_Socket);
+}
+
+bool CNetServer::Wait(int Microseconds)
+{
+	if(m_pRecvThread)
+		return m_pRecvThread->Wait(Microseconds);
+	return net_socket_read_wait(m_Socket, Microseconds);
+}
+
 int CNetServer::Drop(int ClientID, const char *pReason)
 {
 	// TODO: insert lots of checks here
@@ -585,7 +613,7 @@ int CNetServer::Recv(CNetChunk *pChunk, SECURITY_TOKEN *pResponseToken)
 
 		// TODO: empty the recvinfo
 		unsigned char *pData;
-		int Bytes = net_udp_recv(m_Socket, &Addr, &pData);
+		int Bytes = m_pRecvThread ? m_pRecvThread->Recv(&Addr, &pData) : net_udp_recv(m_Socket, &Addr, &pData);
 
 		// no more packets for now
 		if(Bytes <= 0)
@@ -697,6 +725,27 @@ int CNetServer::Send(CNetChunk *pChunk)
 	return 0;
 }
 
+unsigned char *CNetServer::SendBegin(int ClientID, int MaxDataSize)
+{
+	dbg_assert(ClientID >= 0 && ClientID < MaxClients(), "erroneous client id");
+	if(MaxDataSize >= NET_MAX_PAYLOAD)
+	{
+		dbg_msg("netserver", "packet payload too big. %d. dropping packet", MaxDataSize);
+		return nullptr;
+	}
+
+	return m_aSlots[ClientID].m_Connection.QueueChunkBegin(MaxDataSize);
+}
+
+void CNetServer::SendEnd(int ClientID, int DataSize, int Flags)
+{
+	dbg_assert(!(Flags & (NETSENDFLAG_VITAL | NETSENDFLAG_CONNLESS)), "only unreliable chunks can be written in place");
+
+	m_aSlots[ClientID].m_Connection.QueueChunkEnd(DataSize);
+	if(Flags & NETSENDFLAG_FLUSH)
+		m_aSlots[ClientID].m_Connection.Flush();
+}
+
 void CNetServer::SetMaxClientsPerIP(int Max)
 {
 	// clamp
@@ -0,0 +1,147 @@
+#include "network_thread.h"
+
+#include "masterserver.h"
+
+void CNetDatagramRing::Init(unsigned Capacity)
+{
+	dbg_assert(Capacity && (Capacity & (Capacity - 1)) == 0, "ring capacity must be a power of two");
+	m_pSlots = std::make_unique<CNetDatagram[]>(Capacity);
+	m_Mask = Capacity - 1;
+	m_Head.store(0);
+	m_Tail.store(0);
+}
+
+bool CNetRecvThread::Start(NETSOCKET Socket)
+{
+	m_Socket = Socket;
+	m_Shutdown = false;
+	m_PendingPop = -1;
+	m_aRings[CLASS_CLIENT].Init(2048);
+	m_aRings[CLASS_CONNLESS].Init(512);
+	m_aRings[CLASS_BROWSER].Init(512);
+
+	m_pThread = thread_init(ThreadFunc, this, "network receive");
+	return m_pThread != nullptr;
+}
+
+void CNetRecvThread::Stop()
+{
+	if(!m_pThread)
+		return;
+
+	m_Shutdown = true;
+	thread_wait(m_pThread);
+	m_pThread = nullptr;
+}
+
+const char *CNetRecvThread::ClassName(int Class)
+{
+	switch(Class)
+	{
+	case CLASS_CLIENT: return "client";
+	case CLASS_CONNLESS: return "connless";
+	case CLASS_BROWSER: return "browser";
+	}
+	return "unknown";
+}
+
+int CNetRecvThread::Classify(const unsigned char *pData, int Size)
+{
+	if(Size < NET_PACKETHEADERSIZE || !((pData[0] >> 2) & NET_PACKETFLAG_CONNLESS))
+		return CLASS_CLIENT;
+
+	// server browser requests start right after the connless header
+	const int Offset = 6;
+	if(Size >= Offset + SERVERBROWSE_SIZE + 1 &&
+		(mem_comp(pData + Offset, SERVERBROWSE_GETINFO, SERVERBROWSE_SIZE) == 0 ||
+			mem_comp(pData + Offset, SERVERBROWSE_GETINFO_64_LEGACY, SERVERBROWSE_SIZE) == 0))
+		return CLASS_BROWSER;
+	return CLASS_CONNLESS;
+}
+
+void CNetRecvThread::ThreadFunc(void *pUser)
+{
+	static_cast<CNetRecvThread *>(pUser)->Run();
+}
+
+void CNetRecvThread::Run()
+{
+	while(!m_Shutdown)
+	{
+		if(!net_socket_read_wait(m_Socket, 100000))
+			continue;
+
+		bool Pushed = false;
+		NETADDR Addr;
+		unsigned char *pData;
+		int Bytes;
+		while((Bytes = net_udp_recv(m_Socket, &Addr, &pData)) > 0)
+		{
+			const int Class = Classify(pData, Bytes);
+			CNetDatagram *pSlot = m_aRings[Class].BeginPush();
+			if(!pSlot)
+			{
+				m_aDropped[Class]++;
+				continue;
+			}
+
+			pSlot->m_Addr = Addr;
+			pSlot->m_RecvTime = time_get();
+			pSlot->m_Size = minimum(Bytes, (int)sizeof(pSlot->m_aData));
+			mem_copy(pSlot->m_aData, pData, pSlot->m_Size);
+			m_aRings[Class].EndPush();
+			Pushed = true;
+		}
+
+		if(Pushed)
+		{
+			// taking the lock makes sure a waiting game thread can't miss the notify
+			{
+				std::lock_guard<std::mutex> Lock(m_WaitMutex);
+			}
+			m_WaitCond.notify_one();
+		}
+	}
+}
+
+int CNetRecvThread::Recv(NETADDR *pAddr, unsigned char **ppData)
+{
+	if(m_PendingPop != -1)
+	{
+		m_aRings[m_PendingPop].Pop();
+		m_PendingPop = -1;
+	}
+
+	// client traffic first, browser requests last
+	for(int Class = 0; Class < NUM_CLASSES; Class++)
+	{
+		const CNetDatagram *pDatagram = m_aRings[Class].Front();
+		if(!pDatagram)
+			continue;
+
+		const int64_t Waited = (time_get() - pDatagram->m_RecvTime) * 1000000 / time_freq();
+		int Bucket = 0;
+		while(Bucket < NUM_LATENCY_BUCKETS - 1 && (int64_t(1) << Bucket) <= Waited)
+			Bucket++;
+		m_aaLatency[Class][Bucket]++;
+
+		*pAddr = pDatagram->m_Addr;
+		*ppData = const_cast<unsigned char *>(pDatagram->m_aData);
+		m_PendingPop = Class;
+		return pDatagram->m_Size;
+	}
+	return 0;
+}
+
+bool CNetRecvThread::Wait(int Microseconds)
+{
+	auto HasPending = [this]() {
+		for(const auto &Ring : m_aRings)
+			if(!Ring.Empty())
+				return true;
+		return false;
+	};
+
+	std::unique_lock<std::mutex> Lock(m_WaitMutex);
+	return m_WaitCond.wait_for(Lock, std::chrono::microseconds(Microseconds), HasPending);
+}
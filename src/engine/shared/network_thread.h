@@ -0,0 +1,100 @@
+#ifndef ENGINE_SHARED_NETWORK_THREAD_H
+#define ENGINE_SHARED_NETWORK_THREAD_H
+
+#include <base/system.h>
+
+#include "network.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+class CNetDatagram
+{
+public:
+	NETADDR m_Addr;
+	int64_t m_RecvTime;
+	int m_Size;
+	unsigned char m_aData[NET_MAX_PACKETSIZE];
+};
+
+// single producer single consumer queue of received datagrams
+class CNetDatagramRing
+{
+	std::unique_ptr<CNetDatagram[]> m_pSlots;
+	unsigned m_Mask = 0;
+	alignas(64) std::atomic<unsigned> m_Head {0}; // advanced by the producer
+	alignas(64) std::atomic<unsigned> m_Tail {0}; // advanced by the consumer
+
+public:
+	void Init(unsigned Capacity); // power of two
+
+	CNetDatagram *BeginPush()
+	{
+		const unsigned Head = m_Head.load(std::memory_order_relaxed);
+		if(Head - m_Tail.load(std::memory_order_acquire) > m_Mask)
+			return nullptr;
+		return &m_pSlots[Head & m_Mask];
+	}
+	void EndPush() { m_Head.store(m_Head.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+	const CNetDatagram *Front() const
+	{
+		const unsigned Tail = m_Tail.load(std::memory_order_relaxed);
+		if(Tail == m_Head.load(std::memory_order_acquire))
+			return nullptr;
+		return &m_pSlots[Tail & m_Mask];
+	}
+	void Pop() { m_Tail.store(m_Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+	bool Empty() const { return m_Tail.load(std::memory_order_relaxed) == m_Head.load(std::memory_order_acquire); }
+};
+
+// receives datagrams off the game thread and sorts them by class
+class CNetRecvThread
+{
+public:
+	enum
+	{
+		CLASS_CLIENT = 0,
+		CLASS_CONNLESS,
+		CLASS_BROWSER,
+		NUM_CLASSES,
+
+		NUM_LATENCY_BUCKETS = 16, // power of two microsecond buckets, the last one collects the rest
+	};
+
+	CNetRecvThread() = default;
+	~CNetRecvThread() { Stop(); }
+	CNetRecvThread(const CNetRecvThread &) = delete;
+
+	bool Start(NETSOCKET Socket);
+	void Stop();
+
+	// game thread, the returned data stays valid until the next call
+	int Recv(NETADDR *pAddr, unsigned char **ppData);
+	bool Wait(int Microseconds);
+
+	uint64_t Dropped(int Class) const { return m_aDropped[Class].load(); }
+	uint64_t LatencyCount(int Class, int Bucket) const { return m_aaLatency[Class][Bucket]; }
+	static const char *ClassName(int Class);
+	static int Classify(const unsigned char *pData, int Size);
+
+private:
+	static void ThreadFunc(void *pUser);
+	void Run();
+
+	NETSOCKET m_Socket = nullptr;
+	void *m_pThread = nullptr;
+	std::atomic_bool m_Shutdown {false};
+
+	CNetDatagramRing m_aRings[NUM_CLASSES];
+	std::atomic<uint64_t> m_aDropped[NUM_CLASSES] {};
+	uint64_t m_aaLatency[NUM_CLASSES][NUM_LATENCY_BUCKETS] {};
+	int m_PendingPop = -1;
+
+	std::mutex m_WaitMutex;
+	std::condition_variable m_WaitCond;
+};
+
+#endif
@@ -0,0 +1,105 @@
+#include "profiler.h"
+
+#include <base/math.h>
+
+#include <algorithm>
+#include <vector>
+
+void CProfileEntry::Reset()
+{
+	m_Count.store(0, std::memory_order_relaxed);
+	m_Total.store(0, std::memory_order_relaxed);
+	m_Max.store(0, std::memory_order_relaxed);
+	for(auto &Bucket : m_aBuckets)
+		Bucket.store(0, std::memory_order_relaxed);
+}
+
+int64_t CProfileEntry::Percentile(int Percent) const
+{
+	uint64_t aBuckets[NUM_BUCKETS];
+	uint64_t Count = 0;
+	for(int i = 0; i < NUM_BUCKETS; i++)
+	{
+		aBuckets[i] = m_aBuckets[i].load(std::memory_order_relaxed);
+		Count += aBuckets[i];
+	}
+	if(Count == 0)
+		return 0;
+
+	const uint64_t Wanted = (Count * Percent + 99) / 100;
+	uint64_t Seen = 0;
+	for(int i = 0; i < NUM_BUCKETS - 1; i++)
+	{
+		Seen += aBuckets[i];
+		if(Seen >= Wanted)
+			return minimum((int64_t)2 << i, Max());
+	}
+	return Max();
+}
+
+CProfiler *CProfiler::Get()
+{
+	static CProfiler s_Profiler;
+	return &s_Profiler;
+}
+
+CProfileEntry *CProfiler::Entry(const char *pName)
+{
+	std::lock_guard<std::mutex> Lock(m_Mutex);
+	for(auto &Entry : m_Entries)
+	{
+		if(str_comp(Entry.Name(), pName) == 0)
+			return &Entry;
+	}
+	return &m_Entries.emplace_back(pName);
+}
+
+void CProfiler::Reset()
+{
+	std::lock_guard<std::mutex> Lock(m_Mutex);
+	for(auto &Entry : m_Entries)
+		Entry.Reset();
+}
+
+void CProfiler::Report(const char *pFilter, const std::function<void(const char *pLine)> &fnPrint)
+{
+	std::vector<const CProfileEntry *> vpEntries;
+	{
+		std::lock_guard<std::mutex> Lock(m_Mutex);
+		for(const auto &Entry : m_Entries)
+		{
+			if(Entry.Count() > 0 && (!pFilter || !pFilter[0] || str_find_nocase(Entry.Name(), pFilter)))
+				vpEntries.push_back(&Entry);
+		}
+	}
+	std::sort(vpEntries.begin(), vpEntries.end(), [](const CProfileEntry *pA, const CProfileEntry *pB) { return pA->Total() > pB->Total(); });
+
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "%-40s %10s %10s %9s %9s %9s %9s", "scope", "calls", "total ms", "avg us", "p50 us", "p99 us", "max us");
+	fnPrint(aBuf);
+	for(const CProfileEntry *pEntry : vpEntries)
+	{
+		const uint64_t Count = maximum<uint64_t>(pEntry->Count(), 1);
+		str_format(aBuf, sizeof(aBuf), "%-40s %10llu %10.2f %9.2f %9.2f %9.2f %9.2f", pEntry->Name(), (unsigned long long)pEntry->Count(),
+			pEntry->Total() / 1000000.0, pEntry->Total() / 1000.0 / Count, pEntry->Percentile(50) / 1000.0,
+			pEntry->Percentile(99) / 1000.0, pEntry->Max() / 1000.0);
+		fnPrint(aBuf);
+	}
+}
+
+bool CProfiler::Dump(IOHANDLE File)
+{
+	if(!File)
+		return false;
+
+	char aTimestamp[32];
+	str_timestamp(aTimestamp, sizeof(aTimestamp));
+	io_write(File, aTimestamp, str_length(aTimestamp));
+	io_write_newline(File);
+	Report(nullptr, [File](const char *pLine) {
+		io_write(File, pLine, str_length(pLine));
+		io_write_newline(File);
+	});
+	io_write_newline(File);
+	return true;
+}
@@ -0,0 +1,97 @@
+#ifndef ENGINE_SHARED_PROFILER_H
+#define ENGINE_SHARED_PROFILER_H
+
+#include <base/system.h>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+// timing histogram of one profiled scope, safe to update from any thread
+class CProfileEntry
+{
+public:
+	enum
+	{
+		NUM_BUCKETS = 32, // power of two nanosecond buckets, the last one collects the rest
+	};
+
+	explicit CProfileEntry(const char *pName) { str_copy(m_aName, pName, sizeof(m_aName)); }
+
+	void Add(int64_t Nanoseconds)
+	{
+		int Bucket = 0;
+		while(Bucket < NUM_BUCKETS - 1 && (Nanoseconds >> (Bucket + 1)) > 0)
+			Bucket++;
+
+		m_Count.fetch_add(1, std::memory_order_relaxed);
+		m_Total.fetch_add(Nanoseconds, std::memory_order_relaxed);
+		m_aBuckets[Bucket].fetch_add(1, std::memory_order_relaxed);
+		int64_t Max = m_Max.load(std::memory_order_relaxed);
+		while(Nanoseconds > Max && !m_Max.compare_exchange_weak(Max, Nanoseconds, std::memory_order_relaxed))
+			;
+	}
+
+	void Reset();
+
+	const char *Name() const { return m_aName; }
+	uint64_t Count() const { return m_Count.load(std::memory_order_relaxed); }
+	int64_t Total() const { return m_Total.load(std::memory_order_relaxed); }
+	int64_t Max() const { return m_Max.load(std::memory_order_relaxed); }
+	int64_t Percentile(int Percent) const; // upper bound of the bucket, in nanoseconds
+
+private:
+	char m_aName[64];
+	std::atomic<uint64_t> m_Count {0};
+	std::atomic<int64_t> m_Total {0};
+	std::atomic<int64_t> m_Max {0};
+	std::atomic<uint64_t> m_aBuckets[NUM_BUCKETS] {};
+};
+
+// process wide registry of profiled scopes, entries are never freed so pointers to them stay valid
+class CProfiler
+{
+	std::mutex m_Mutex;
+	std::deque<CProfileEntry> m_Entries;
+
+public:
+	static CProfiler *Get();
+
+	CProfileEntry *Entry(const char *pName);
+	void Reset();
+
+	// one line per entry matching pFilter, sorted by total time
+	void Report(const char *pFilter, const std::function<void(const char *pLine)> &fnPrint);
+	bool Dump(IOHANDLE File);
+};
+
+class CProfileScope
+{
+	CProfileEntry *m_pEntry;
+	std::chrono::steady_clock::time_point m_Start;
+
+public:
+	explicit CProfileScope(CProfileEntry *pEntry) :
+		m_pEntry(pEntry), m_Start(std::chrono::steady_clock::now()) {}
+	~CProfileScope()
+	{
+		if(m_pEntry)
+			m_pEntry->Add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Start).count());
+	}
+};
+
+// the timers are only compiled in with the TICK_PROFILER cmake option
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+#if defined(CONF_PROFILER)
+#define PROFILE_SCOPE(pEntry) CProfileScope PROFILE_CONCAT(ProfileScope, __LINE__)(pEntry)
+#else
+#define PROFILE_SCOPE(pEntry) \
+	do \
+	{ \
+	} while(0)
+#endif
+
+#endif
@@ -10,6 +10,10 @@
 #include <base/math.h>
 #include <base/system.h>
 
+#if defined(CONF_ARCH_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 
 // CSnapshot
 
@@ -147,61 +151,55 @@ bool CSnapshot::IsValid(size_t ActualSize) const
 
 // CSnapshotDelta
 
-enum
-{
-	HASHLIST_SIZE = 256,
-	HASHLIST_BUCKET_SIZE = 64,
-};
-
-struct CItemList
-{
-	int m_Num;
-	int m_aKeys[HASHLIST_BUCKET_SIZE];
-	int m_aIndex[HASHLIST_BUCKET_SIZE];
-};
-
-inline size_t CalcHashID(int Key)
+CSnapshotKeyIndex::CSnapshotKeyIndex()
 {
-	// djb2 (http://www.cse.yorku.ca/~oz/hash.html)
-	unsigned Hash = 5381;
-	for(unsigned Shift = 0; Shift < sizeof(int); Shift++)
-		Hash = ((Hash << 5) + Hash) + ((Key >> (Shift * 8)) & 0xFF);
-	return Hash % HASHLIST_SIZE;
+	mem_zero(m_aStamp, sizeof(m_aStamp));
+	m_Stamp = 0;
 }
 
-static void GenerateHash(CItemList *pHashlist, const CSnapshot *pSnapshot)
+void CSnapshotKeyIndex::Build(const CSnapshot *pSnapshot)
 {
-	for(int i = 0; i < HASHLIST_SIZE; i++)
-		pHashlist[i].m_Num = 0;
-
-	for(int i = 0; i < pSnapshot->NumItems(); i++)
+	// a new stamp invalidates all slots without clearing the table
+	if(++m_Stamp == 0)
 	{
-		int Key = pSnapshot->GetItem(i)->Key();
-		size_t HashID = CalcHashID(Key);
-		if(pHashlist[HashID].m_Num < HASHLIST_BUCKET_SIZE)
-		{
-			pHashlist[HashID].m_aIndex[pHashlist[HashID].m_Num] = i;
-			pHashlist[HashID].m_aKeys[pHashlist[HashID].m_Num] = Key;
-			pHashlist[HashID].m_Num++;
-		}
+		mem_zero(m_aStamp, sizeof(m_aStamp));
+		m_Stamp = 1;
 	}
-}
 
-static int GetItemIndexHashed(int Key, const CItemList *pHashlist)
-{
-	size_t HashID = CalcHashID(Key);
-	for(int i = 0; i < pHashlist[HashID].m_Num; i++)
+	const int NumItems = minimum(pSnapshot->NumItems(), (int)TABLE_SIZE - 1);
+	for(int Index = 0; Index < NumItems; Index++)
 	{
-		if(pHashlist[HashID].m_aKeys[i] == Key)
-			return pHashlist[HashID].m_aIndex[i];
+		const int Key = pSnapshot->GetItem(Index)->Key();
+		unsigned i = Slot(Key);
+		while(m_aStamp[i] == m_Stamp && m_aKeys[i] != Key)
+			i = (i + 1) & TABLE_MASK;
+
+		// first item with a given key wins, same as a linear search
+		if(m_aStamp[i] == m_Stamp)
+			continue;
+
+		m_aStamp[i] = m_Stamp;
+		m_aKeys[i] = Key;
+		m_aIndex[i] = Index;
 	}
-
-	return -1;
 }
 
 int CSnapshotDelta::DiffItem(const int *pPast, const int *pCurrent, int *pOut, int Size)
 {
 	int Needed = 0;
+#if defined(CONF_ARCH_AMD64) || defined(__SSE2__)
+	// four ints per step, the wrapping subtraction is the same as the scalar one
+	__m128i NeededVec = _mm_setzero_si128();
+	for(; Size >= 4; Size -= 4, pPast += 4, pCurrent += 4, pOut += 4)
+	{
+		const __m128i Diff = _mm_sub_epi32(_mm_loadu_si128((const __m128i *)pCurrent), _mm_loadu_si128((const __m128i *)pPast));
+		_mm_storeu_si128((__m128i *)pOut, Diff);
+		NeededVec = _mm_or_si128(NeededVec, Diff);
+	}
+	NeededVec = _mm_or_si128(NeededVec, _mm_shuffle_epi32(NeededVec, _MM_SHUFFLE(1, 0, 3, 2)));
+	NeededVec = _mm_or_si128(NeededVec, _mm_shuffle_epi32(NeededVec, _MM_SHUFFLE(2, 3, 0, 1)));
+	Needed = _mm_cvtsi128_si32(NeededVec);
+#endif
 	while(Size)
 	{
 		// subtraction with wrapping by casting to unsigned
@@ -267,7 +265,6 @@ const CSnapshotDelta::CData *CSnapshotDelta::EmptyDelta() const
 	return &m_Empty;
 }
 
-// TODO: OPT: this should be made much faster
 int CSnapshotDelta::CreateDelta(const CSnapshot *pFrom, CSnapshot *pTo, void *pDstData)
 {
 	CData *pDelta = (CData *)pDstData;
@@ -277,14 +274,13 @@ int CSnapshotDelta::CreateDelta(const CSnapshot *pFrom, CSnapshot *pTo, void *pD
 	pDelta->m_NumUpdateItems = 0;
 	pDelta->m_NumTempItems = 0;
 
-	CItemList aHashlist[HASHLIST_SIZE];
-	GenerateHash(aHashlist, pTo);
+	m_ToIndex.Build(pTo);
 
 	// pack deleted stuff
 	for(int i = 0; i < pFrom->NumItems(); i++)
 	{
 		const CSnapshotItem *pFromItem = pFrom->GetItem(i);
-		if(GetItemIndexHashed(pFromItem->Key(), aHashlist) == -1)
+		if(m_ToIndex.Find(pFromItem->Key()) == -1)
 		{
 			// deleted
 			pDelta->m_NumDeletedItems++;
@@ -293,7 +289,7 @@ int CSnapshotDelta::CreateDelta(const CSnapshot *pFrom, CSnapshot *pTo, void *pD
 		}
 	}
 
-	GenerateHash(aHashlist, pFrom);
+	m_FromIndex.Build(pFrom);
 
 	// fetch previous indices
 	// we do this as a separate pass because it helps the cache
@@ -301,8 +297,8 @@ int CSnapshotDelta::CreateDelta(const CSnapshot *pFrom, CSnapshot *pTo, void *pD
 	const int NumItems = pTo->NumItems();
 	for(int i = 0; i < NumItems; i++)
 	{
-		const CSnapshotItem *pCurItem = pTo->GetItem(i); // O(1) .. O(n)
-		aPastIndices[i] = GetItemIndexHashed(pCurItem->Key(), aHashlist); // O(n) .. O(n^n)
+		const CSnapshotItem *pCurItem = pTo->GetItem(i);
+		aPastIndices[i] = m_FromIndex.Find(pCurItem->Key());
 	}
 
 	for(int i = 0; i < NumItems; i++)
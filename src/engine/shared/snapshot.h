@@ -63,6 +63,39 @@ public:
 	static const CSnapshot *EmptySnapshot() { return &ms_EmptySnapshot; }
 };
 
+// CSnapshotKeyIndex
+
+class CSnapshotKeyIndex
+{
+	enum
+	{
+		TABLE_BITS = 11,
+		TABLE_SIZE = 1 << TABLE_BITS, // twice CSnapshot::MAX_ITEMS, keeps probe chains short
+		TABLE_MASK = TABLE_SIZE - 1,
+	};
+
+	int m_aKeys[TABLE_SIZE];
+	int m_aIndex[TABLE_SIZE];
+	unsigned m_aStamp[TABLE_SIZE];
+	unsigned m_Stamp;
+
+	static unsigned Slot(int Key) { return ((unsigned)Key * 2654435761u) >> (32 - TABLE_BITS); }
+
+public:
+	CSnapshotKeyIndex();
+	void Build(const CSnapshot *pSnapshot);
+	int Find(int Key) const
+	{
+		for(unsigned i = Slot(Key);; i = (i + 1) & TABLE_MASK)
+		{
+			if(m_aStamp[i] != m_Stamp)
+				return -1;
+			if(m_aKeys[i] == Key)
+				return m_aIndex[i];
+		}
+	}
+};
+
 // CSnapshotDelta
 
 class CSnapshotDelta
@@ -86,6 +119,8 @@ private:
 	int m_aSnapshotDataRate[CSnapshot::MAX_TYPE + 1];
 	int m_aSnapshotDataUpdates[CSnapshot::MAX_TYPE + 1];
 	CData m_Empty;
+	CSnapshotKeyIndex m_FromIndex;
+	CSnapshotKeyIndex m_ToIndex;
 
 	static void UndiffItem(const int *pPast, const int *pDiff, int *pOut, int Size, int *pDataRate);
 
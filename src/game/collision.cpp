@@ -39,9 +39,14 @@ CCollision::CCollision()
 void CCollision::Init(class CLayers *pLayers)
 {
 	m_pLayers = pLayers;
-	m_Width = m_pLayers->GameLayer()->m_Width;
-	m_Height = m_pLayers->GameLayer()->m_Height;
-	m_pTiles = static_cast<CTile *>(m_pLayers->Map()->GetData(m_pLayers->GameLayer()->m_Data));
+	Init(static_cast<CTile *>(m_pLayers->Map()->GetData(m_pLayers->GameLayer()->m_Data)), m_pLayers->GameLayer()->m_Width, m_pLayers->GameLayer()->m_Height);
+}
+
+void CCollision::Init(class CTile *pTiles, int Width, int Height)
+{
+	m_Width = Width;
+	m_Height = Height;
+	m_pTiles = pTiles;
 
 	for(int i = 0; i < m_Width*m_Height; i++)
 	{
@@ -85,6 +90,82 @@ void CCollision::Init(class CLayers *pLayers)
 			m_pTiles[i].m_Reserved = static_cast< char >(Index);
 		}
 	}
+
+	InitRaycast();
+}
+
+// the flags the distance field is built over, raycasts for any subset of them can use it
+static constexpr int RAYCAST_FLAGS = CCollision::COLFLAG_SOLID | CCollision::COLFLAG_DISALLOW_MOVE;
+
+void CCollision::InitRaycast()
+{
+	const int NumTiles = m_Width * m_Height;
+	m_vSolidBits.assign((NumTiles + 31) / 32, 0);
+
+	// two pass chamfer transform, with unit weights on all 8 neighbours it is the exact chebyshev distance
+	std::vector<int> vDistance(NumTiles);
+	for(int y = 0; y < m_Height; y++)
+	{
+		for(int x = 0; x < m_Width; x++)
+		{
+			const int i = y * m_Width + x;
+			const int Flags = GetTile(x * 32, y * 32);
+			if(Flags & COLFLAG_SOLID)
+				m_vSolidBits[i / 32] |= 1u << (i % 32);
+
+			if(Flags & RAYCAST_FLAGS)
+			{
+				vDistance[i] = 0;
+				continue;
+			}
+
+			int Dist = NumTiles;
+			if(x > 0)
+				Dist = minimum(Dist, vDistance[i - 1] + 1);
+			if(y > 0)
+			{
+				Dist = minimum(Dist, vDistance[i - m_Width] + 1);
+				if(x > 0)
+					Dist = minimum(Dist, vDistance[i - m_Width - 1] + 1);
+				if(x < m_Width - 1)
+					Dist = minimum(Dist, vDistance[i - m_Width + 1] + 1);
+			}
+			vDistance[i] = Dist;
+		}
+	}
+
+	m_vSolidDistance.resize(NumTiles);
+	for(int y = m_Height - 1; y >= 0; y--)
+	{
+		for(int x = m_Width - 1; x >= 0; x--)
+		{
+			const int i = y * m_Width + x;
+			int Dist = vDistance[i];
+			if(x < m_Width - 1)
+				Dist = minimum(Dist, vDistance[i + 1] + 1);
+			if(y < m_Height - 1)
+			{
+				Dist = minimum(Dist, vDistance[i + m_Width] + 1);
+				if(x < m_Width - 1)
+					Dist = minimum(Dist, vDistance[i + m_Width + 1] + 1);
+				if(x > 0)
+					Dist = minimum(Dist, vDistance[i + m_Width - 1] + 1);
+			}
+			vDistance[i] = Dist;
+			m_vSolidDistance[i] = static_cast<unsigned char>(minimum(Dist, 255));
+		}
+	}
+}
+
+int CCollision::ClampedTile(int TileX, int TileY) const
+{
+	return clamp(TileY, 0, m_Height - 1) * m_Width + clamp(TileX, 0, m_Width - 1);
+}
+
+bool CCollision::IsSolidBit(int TileX, int TileY) const
+{
+	const int Index = ClampedTile(TileX, TileY);
+	return m_vSolidBits[Index / 32] & (1u << (Index % 32));
 }
 
 int CCollision::GetTile(int x, int y) const
@@ -119,6 +200,22 @@ unsigned short CCollision::GetParseTile(int x, int y) const
 }
 
 int CCollision::IntersectLine(vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *pOutBeforeCollision) const
+{
+	return TraceLine(Pos0, Pos1, pOutCollision, pOutBeforeCollision, COLFLAG_SOLID);
+}
+
+bool CCollision::IntersectLineColFlag(vec2 Pos0, vec2 Pos1, vec2* pOutCollision, vec2* pOutBeforeCollision, int ColFlag) const
+{
+	return TraceLine(Pos0, Pos1, pOutCollision, pOutBeforeCollision, ColFlag) != 0;
+}
+
+/*
+ * Walks the tiles the line passes through and returns the first one having ColFlag, 0 if none.
+ * The walk itself is kept step by step so the results stay bit-exact, the distance field only
+ * lets it skip the tile tests: a tile at distance D proves the next D - 1 steps are free, and if
+ * the rest of the line fits into that radius it is done right away.
+ */
+int CCollision::TraceLine(vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *pOutBeforeCollision, int ColFlag) const
 {
 	const int Tile0X = round_to_int(Pos0.x)/32;
 	const int Tile0Y = round_to_int(Pos0.y)/32;
@@ -150,92 +247,37 @@ int CCollision::IntersectLine(vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *p
 			Error -= DeltaTileY;
 	}
 
-	while(CurTileX != Tile1X || CurTileY != Tile1Y)
+	// other flags are not covered by the distance field
+	const bool UseDistance = (ColFlag & ~RAYCAST_FLAGS) == 0;
+	auto IsHit = [&]() {
+		return ColFlag == COLFLAG_SOLID ? IsSolidBit(CurTileX, CurTileY) : IsTile(CurTileX*32, CurTileY*32, ColFlag);
+	};
+
+	// steps, counting the current tile, known to be free
+	int FreeSteps = 0;
+	bool Hit = false;
+	while(true)
 	{
-		if(IsTile(CurTileX*32,CurTileY*32, COLFLAG_SOLID))
-			break;
-		if(CurTileY != Tile1Y && (CurTileX == Tile1X || Error > 0))
-		{
-			CurTileY += DeltaTileY;
-			Error -= 1;
-			Vertical = false;
-		}
+		if(FreeSteps > 0)
+			FreeSteps--;
 		else
 		{
-			CurTileX += DeltaTileX;
-			Error += DeltaError;
-			Vertical = true;
-		}
-	}
-	if(IsTile(CurTileX*32,CurTileY*32, COLFLAG_SOLID))
-	{
-		if(CurTileX != Tile0X || CurTileY != Tile0Y)
-		{
-			if(Vertical)
+			const int Distance = UseDistance ? m_vSolidDistance[ClampedTile(CurTileX, CurTileY)] : 0;
+			if(Distance == 0)
 			{
-				Pos.x = 32 * (CurTileX + ((Tile0X < Tile1X) ? 0 : 1));
-				Pos.y = (Pos.x * (Pos1.y - Pos0.y) - DetPos) / (Pos1.x - Pos0.x);
-			}
-			else
-			{
-				Pos.y = 32 * (CurTileY + ((Tile0Y < Tile1Y) ? 0 : 1));
-				Pos.x = (Pos.y * (Pos1.x - Pos0.x) + DetPos) / (Pos1.y - Pos0.y);
+				if(IsHit())
+				{
+					Hit = true;
+					break;
+				}
 			}
-		}
-		if(pOutCollision)
-			*pOutCollision = Pos;
-		if(pOutBeforeCollision)
-		{
-			vec2 Dir = normalize(Pos1-Pos0);
-			if(Vertical)
-				Dir *= 0.5f / absolute(Dir.x) + 1.f;
+			else if(maximum(absolute(Tile1X - CurTileX), absolute(Tile1Y - CurTileY)) < Distance)
+				break;
 			else
-				Dir *= 0.5f / absolute(Dir.y) + 1.f;
-			*pOutBeforeCollision = Pos - Dir;
+				FreeSteps = Distance - 1;
 		}
-		return  GetTile(CurTileX*32,CurTileY*32);
-	}
-	if(pOutCollision)
-		*pOutCollision = Pos1;
-	if(pOutBeforeCollision)
-		*pOutBeforeCollision = Pos1;
-	return 0;
-}
-
-bool CCollision::IntersectLineColFlag(vec2 Pos0, vec2 Pos1, vec2* pOutCollision, vec2* pOutBeforeCollision, int ColFlag) const
-{
-	const int Tile0X = round_to_int(Pos0.x) / 32;
-	const int Tile0Y = round_to_int(Pos0.y) / 32;
-	const int Tile1X = round_to_int(Pos1.x) / 32;
-	const int Tile1Y = round_to_int(Pos1.y) / 32;
-
-	const float Ratio = (Tile0X == Tile1X) ? 1.f : (Pos1.y - Pos0.y) / (Pos1.x - Pos0.x);
-	const float DetPos = Pos0.x * Pos1.y - Pos0.y * Pos1.x;
-
-	const int DeltaTileX = (Tile0X <= Tile1X) ? 1 : -1;
-	const int DeltaTileY = (Tile0Y <= Tile1Y) ? 1 : -1;
-
-	const float DeltaError = DeltaTileY * DeltaTileX * Ratio;
-
-	int CurTileX = Tile0X;
-	int CurTileY = Tile0Y;
-	vec2 Pos = Pos0;
-
-	bool Vertical = false;
 
-	float Error = 0;
-	if(Tile0Y != Tile1Y && Tile0X != Tile1X)
-	{
-		Error = (CurTileX * Ratio - CurTileY - DetPos / (32 * (Pos1.x - Pos0.x))) * DeltaTileY;
-		if(Tile0X < Tile1X)
-			Error += Ratio * DeltaTileY;
-		if(Tile0Y < Tile1Y)
-			Error -= DeltaTileY;
-	}
-
-	while(CurTileX != Tile1X || CurTileY != Tile1Y)
-	{
-		if(IsTile(CurTileX * 32, CurTileY * 32, ColFlag))
+		if(CurTileX == Tile1X && CurTileY == Tile1Y)
 			break;
 		if(CurTileY != Tile1Y && (CurTileX == Tile1X || Error > 0))
 		{
@@ -250,7 +292,7 @@ bool CCollision::IntersectLineColFlag(vec2 Pos0, vec2 Pos1, vec2* pOutCollision,
 			Vertical = true;
 		}
 	}
-	if(IsTile(CurTileX * 32, CurTileY * 32, ColFlag))
+	if(Hit)
 	{
 		if(CurTileX != Tile0X || CurTileY != Tile0Y)
 		{
@@ -269,20 +311,20 @@ bool CCollision::IntersectLineColFlag(vec2 Pos0, vec2 Pos1, vec2* pOutCollision,
 			*pOutCollision = Pos;
 		if(pOutBeforeCollision)
 		{
-			vec2 Dir = normalize(Pos1 - Pos0);
+			vec2 Dir = normalize(Pos1-Pos0);
 			if(Vertical)
 				Dir *= 0.5f / absolute(Dir.x) + 1.f;
 			else
 				Dir *= 0.5f / absolute(Dir.y) + 1.f;
 			*pOutBeforeCollision = Pos - Dir;
 		}
-		return true;
+		return GetTile(CurTileX*32, CurTileY*32);
 	}
 	if(pOutCollision)
 		*pOutCollision = Pos1;
 	if(pOutBeforeCollision)
 		*pOutBeforeCollision = Pos1;
-	return false;
+	return 0;
 }
 
 /* another */
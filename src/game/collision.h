@@ -5,6 +5,8 @@
 
 #include <base/vmath.h>
 
+#include <vector>
+
 enum
 {
 	CANTMOVE_LEFT = 1 << 0,
@@ -28,6 +30,15 @@ class CCollision
 	bool IsTile(int x, int y, int Flag=COLFLAG_SOLID) const;
 	int GetTile(int x, int y) const;
 
+	// raycast acceleration, built once at map load: one bit per solid tile and the
+	// chebyshev distance in tiles to the nearest solid or invisible wall tile
+	std::vector<unsigned> m_vSolidBits;
+	std::vector<unsigned char> m_vSolidDistance;
+	void InitRaycast();
+	int ClampedTile(int TileX, int TileY) const;
+	bool IsSolidBit(int TileX, int TileY) const;
+	int TraceLine(vec2 Pos0, vec2 Pos1, vec2* pOutCollision, vec2* pOutBeforeCollision, int ColFlag) const;
+
 public:
 	enum
 	{
@@ -40,6 +51,7 @@ public:
 
 	CCollision();
 	void Init(class CLayers *pLayers);
+	void Init(class CTile *pTiles, int Width, int Height);
 	bool CheckPoint(float x, float y, int Flag=COLFLAG_SOLID) const { return IsTile(round_to_int(x), round_to_int(y), Flag); }
 	bool CheckPoint(vec2 Pos, int Flag=COLFLAG_SOLID) const { return CheckPoint(Pos.x, Pos.y, Flag); }
 	int GetCollisionAt(float x, float y) const { return GetTile(round_to_int(x), round_to_int(y)); }
@@ -0,0 +1,49 @@
+/* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
+/* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#ifndef GAME_SERVER_BOT_LOD_H
+#define GAME_SERVER_BOT_LOD_H
+
+// how often the AI of a bot thinks, by the distance to the nearest player
+enum class BotLod
+{
+	FULL = 0, // every tick
+	REDUCED, // every 4th tick
+	MINIMAL, // every 25th tick, without hook probing or path requests
+};
+
+class CBotLodScheduler
+{
+public:
+	enum
+	{
+		REDUCED_INTERVAL = 4,
+		MINIMAL_INTERVAL = 25,
+	};
+
+	static BotLod Classify(float NearestPlayerDistance, float FullDistance, float ReducedDistance)
+	{
+		if(NearestPlayerDistance < FullDistance)
+			return BotLod::FULL;
+		if(NearestPlayerDistance < ReducedDistance)
+			return BotLod::REDUCED;
+		return BotLod::MINIMAL;
+	}
+
+	static int Interval(BotLod Lod)
+	{
+		switch(Lod)
+		{
+		case BotLod::REDUCED: return REDUCED_INTERVAL;
+		case BotLod::MINIMAL: return MINIMAL_INTERVAL;
+		default: return 1;
+		}
+	}
+
+	// the client id spreads the bots of a tier over the ticks of its interval
+	static bool IsThinkTick(BotLod Lod, int Tick, int ClientID)
+	{
+		return (Tick + ClientID) % Interval(Lod) == 0;
+	}
+};
+
+#endif
@@ -15,6 +15,19 @@ class GroupData;
 class CGuildData;
 class CGuildMemberData;
 
+// columns of tw_accounts_mining and tw_accounts_farming, in the order of JobAccountStats
+struct CJobFieldsSchema
+{
+	static constexpr DBSchema<int, int, int> ms_Schema
+	{
+		DBFieldInfo<int> { "Level", "Level", 1 },
+		DBFieldInfo<int> { "Exp", "Experience", 0 },
+		DBFieldInfo<int> { "Upgrade", "Upgrades", 0 },
+	};
+};
+using CJobFields = DBFieldContainer<CJobFieldsSchema>;
+static_assert(CJobFields::NUM_FIELDS == NUM_JOB_ACCOUNTS_STATS);
+
 class CAccountData
 {
 	ska::unordered_set< int > m_aAetherLocation {};
@@ -116,19 +129,8 @@ public:
 	CTeeInfo m_TeeInfos {};
 	int m_Team {};
 
-	DBFieldContainer m_MiningData
-	{
-		{ DBField<int>(JOB_LEVEL, "Level", "Miner level") },
-		{ DBField<int>(JOB_EXPERIENCE, "Exp", "Miner experience") },
-		{ DBField<int>(JOB_UPGRADES, "Upgrade", "Miner upgrades") }
-	};
-
-	DBFieldContainer m_FarmingData
-	{
-		{ DBField<int>(JOB_LEVEL, "Level", "Farmer level") },
-		{ DBField<int>(JOB_EXPERIENCE, "Exp", "Farmer experience") },
-		{ DBField<int>(JOB_UPGRADES, "Upgrade", "Farmer upgrades") }
-	};
+	CJobFields m_MiningData {};
+	CJobFields m_FarmingData {};
 
 	static std::map < int, CAccountData > ms_aData;
 };
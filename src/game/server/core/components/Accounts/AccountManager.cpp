@@ -302,21 +302,20 @@ bool CAccountManager::OnHandleMenulist(CPlayer* pPlayer, int Menulist)
 		// game settings
 		CVoteWrapper VMainSettings(ClientID, VWF_SEPARATE_OPEN, "\u2699 Main settings");
 		VMainSettings.AddMenu(MENU_SETTINGS_LANGUAGE_SELECT, "Settings language");
-		for(const auto& [ItemID, ItemData] : CPlayerItem::Data()[ClientID])
+		auto& aItems = CPlayerItem::Data()[ClientID];
+		for(int ItemID : CPlayerItem::Index(ClientID).Held((int)ItemType::TYPE_SETTINGS))
 		{
-			if(ItemData.Info()->IsType(ItemType::TYPE_SETTINGS) && ItemData.HasItem())
-				VMainSettings.AddOption("ISETTINGS", ItemID, "[{STR}] {STR}", (ItemData.GetSettings() ? "Enabled" : "Disabled"), ItemData.Info()->GetName());
+			const CPlayerItem& ItemData = aItems[ItemID];
+			VMainSettings.AddOption("ISETTINGS", ItemID, "[{STR}] {STR}", (ItemData.GetSettings() ? "Enabled" : "Disabled"), ItemData.Info()->GetName());
 		}
 		CVoteWrapper::AddLine(ClientID);
 
 		// equipment modules
 		CVoteWrapper VModulesSettings(ClientID, VWF_SEPARATE_OPEN, "\u2694 Modules settings");
-		for(auto& iter : CPlayerItem::Data()[ClientID])
+		for(int ItemID : CPlayerItem::Index(ClientID).Held((int)ItemType::TYPE_MODULE))
 		{
-			CPlayerItem* pPlayerItem = &iter.second;
+			CPlayerItem* pPlayerItem = &aItems[ItemID];
 			CItemDescription* pItemInfo = pPlayerItem->Info();
-			if(!pItemInfo->IsType(ItemType::TYPE_MODULE) || !pPlayerItem->HasItem())
-				continue;
 
 			char aAttributesInfo[128];
 			if(pItemInfo->HasAttributes())
@@ -27,14 +27,11 @@ void CAccountMinerManager::OnInitAccount(CPlayer* pPlayer)
 	ResultPtr pRes = Database->Execute<DB::SELECT>("*", "tw_accounts_mining", "WHERE UserID = '%d'", pPlayer->Account()->GetID());
 	if (pRes->next())
 	{
-		pPlayer->Account()->m_MiningData.initFields(&pRes);
-		dbg_msg("test", "%s", pPlayer->Account()->m_MiningData.getUpdateField().c_str());
+		pPlayer->Account()->m_MiningData.InitFields(&pRes);
 		return;
 	}
 
-	pPlayer->Account()->m_MiningData(JOB_LEVEL, 1).m_Value = 1;
-	pPlayer->Account()->m_MiningData(JOB_EXPERIENCE, 0).m_Value = 0;
-	pPlayer->Account()->m_MiningData(JOB_UPGRADES, 0).m_Value = 0;
+	pPlayer->Account()->m_MiningData.Reset();
 	Database->Execute<DB::INSERT>("tw_accounts_mining", "(UserID) VALUES ('%d')", pPlayer->Account()->GetID());
 }
 
@@ -62,9 +59,9 @@ int CAccountMinerManager::GetOreHealth(vec2 Pos) const
 //void CAccountMinerManager::ShowMenu(CPlayer *pPlayer) const
 //{
 //	const int ClientID = pPlayer->GetCID();
-//	const int JobLevel = pPlayer->AccountManager()->m_MiningData(JOB_LEVEL, 0).m_Value;
-//	const int JobExperience = pPlayer->AccountManager()->m_MiningData(JOB_EXPERIENCE, 0).m_Value;
-//	const int JobUpgrades = pPlayer->AccountManager()->m_MiningData(JOB_UPGRADES, 0).m_Value;
+//	const int JobLevel = pPlayer->AccountManager()->m_MiningData.Get<JOB_LEVEL>();
+//	const int JobExperience = pPlayer->AccountManager()->m_MiningData.Get<JOB_EXPERIENCE>();
+//	const int JobUpgrades = pPlayer->AccountManager()->m_MiningData.Get<JOB_UPGRADES>();
 //	const int ExperienceNeed = computeExperience(JobLevel);
 //
 //	GS()->AVM(ClientID, "null", NOPE, TAB_UPGR_JOB, "Miner Point: {INT} :: Level: {INT} Exp: {INT}/{INT}", JobUpgrades, JobLevel, JobExperience, ExperienceNeed);
@@ -109,14 +106,14 @@ void CAccountMinerManager::Work(CPlayer *pPlayer, int Level)
 {
 	const int ClientID = pPlayer->GetCID();
 	const int MultiplierExperience = maximum(1, (int)computeExperience(Level) / g_Config.m_SvMiningIncreaseLevel);
-	pPlayer->Account()->m_MiningData(JOB_EXPERIENCE, 0).m_Value += MultiplierExperience;
+	pPlayer->Account()->m_MiningData.Get<JOB_EXPERIENCE>() += MultiplierExperience;
 
-	int ExperienceNeed = computeExperience(pPlayer->Account()->m_MiningData(JOB_LEVEL, 0).m_Value);
-	for( ; pPlayer->Account()->m_MiningData(JOB_EXPERIENCE, 0).m_Value >= ExperienceNeed; )
+	int ExperienceNeed = computeExperience(pPlayer->Account()->m_MiningData.Get<JOB_LEVEL>());
+	for( ; pPlayer->Account()->m_MiningData.Get<JOB_EXPERIENCE>() >= ExperienceNeed; )
 	{
-		pPlayer->Account()->m_MiningData(JOB_EXPERIENCE, 0).m_Value -= ExperienceNeed;
-		pPlayer->Account()->m_MiningData(JOB_LEVEL, 0).m_Value++;
-		pPlayer->Account()->m_MiningData(JOB_UPGRADES, 0).m_Value++;
+		pPlayer->Account()->m_MiningData.Get<JOB_EXPERIENCE>() -= ExperienceNeed;
+		pPlayer->Account()->m_MiningData.Get<JOB_LEVEL>()++;
+		pPlayer->Account()->m_MiningData.Get<JOB_UPGRADES>()++;
 
 		if(pPlayer->GetCharacter() && pPlayer->GetCharacter()->IsAlive())
 		{
@@ -125,12 +122,12 @@ void CAccountMinerManager::Work(CPlayer *pPlayer, int Level)
 			GS()->CreateText(pPlayer->GetCharacter(), false, vec2(0, -40), vec2(0, -1), 40, "miner up");
 		}
 
-		const int NewLevel = pPlayer->Account()->m_MiningData(JOB_LEVEL, 0).m_Value;
+		const int NewLevel = pPlayer->Account()->m_MiningData.Get<JOB_LEVEL>();
 		ExperienceNeed = computeExperience(NewLevel);
 		GS()->Chat(ClientID, "Miner Level UP. Now Level {INT}!", NewLevel);
 	}
 
-	pPlayer->ProgressBar("Miner", pPlayer->Account()->m_MiningData(JOB_LEVEL, 0).m_Value, pPlayer->Account()->m_MiningData(JOB_EXPERIENCE, 0).m_Value, ExperienceNeed, MultiplierExperience);
+	pPlayer->ProgressBar("Miner", pPlayer->Account()->m_MiningData.Get<JOB_LEVEL>(), pPlayer->Account()->m_MiningData.Get<JOB_EXPERIENCE>(), ExperienceNeed, MultiplierExperience);
 	Core()->SaveAccount(pPlayer, SAVE_MINER_DATA);
 }
 
@@ -140,7 +137,8 @@ bool CAccountMinerManager::OnHandleVoteCommands(CPlayer* pPlayer, const char* CM
 	const int ClientID = pPlayer->GetCID();
 	if (PPSTR(CMD, "MINERUPGRADE") == 0)
 	{
-		if (pPlayer->Upgrade(Get, &pPlayer->Account()->m_MiningData(VoteID, 0).m_Value, &pPlayer->Account()->m_MiningData(JOB_UPGRADES, 0).m_Value, VoteID2, 3))
+		int* pUpgrade = pPlayer->Account()->m_MiningData.At(VoteID);
+		if (pUpgrade && pPlayer->Upgrade(Get, pUpgrade, &pPlayer->Account()->m_MiningData.Get<JOB_UPGRADES>(), VoteID2, 3))
 		{
 			GS()->Core()->SaveAccount(pPlayer, SAVE_MINER_DATA);
 			pPlayer->m_VotesData.UpdateVotesIf(MENU_UPGRADES);
@@ -29,13 +29,11 @@ void CAccountPlantManager::OnInitAccount(CPlayer *pPlayer)
 	ResultPtr pRes = Database->Execute<DB::SELECT>("*", "tw_accounts_farming", "WHERE UserID = '%d'", pPlayer->Account()->GetID());
 	if(pRes->next())
 	{
-		pPlayer->Account()->m_FarmingData.initFields(&pRes);
+		pPlayer->Account()->m_FarmingData.InitFields(&pRes);
 		return;
 	}
 
-	pPlayer->Account()->m_FarmingData(JOB_LEVEL, 1).m_Value = 1;
-	pPlayer->Account()->m_FarmingData(JOB_EXPERIENCE, 0).m_Value = 0;
-	pPlayer->Account()->m_FarmingData(JOB_UPGRADES, 0).m_Value = 0;
+	pPlayer->Account()->m_FarmingData.Reset();
 	Database->Execute<DB::INSERT>("tw_accounts_farming", "(UserID) VALUES ('%d')", pPlayer->Account()->GetID());
 }
 
@@ -63,10 +61,10 @@ int CAccountPlantManager::GetPlantHealth(vec2 Pos) const
 //void CAccountPlantManager::ShowMenu(CPlayer* pPlayer) const
 //{
 //	const int ClientID = pPlayer->GetCID();
-//	const int JobLevel = pPlayer->AccountManager()->m_FarmingData(JOB_LEVEL, 0).m_Value;
-//	const int JobExperience = pPlayer->AccountManager()->m_FarmingData(JOB_EXPERIENCE, 0).m_Value;
-//	const int JobUpgrades = pPlayer->AccountManager()->m_FarmingData(JOB_UPGRADES, 0).m_Value;
-//	const int JobUpgrQuantity = pPlayer->AccountManager()->m_FarmingData(JOB_UPGR_QUANTITY, 0).m_Value;
+//	const int JobLevel = pPlayer->AccountManager()->m_FarmingData.Get<JOB_LEVEL>();
+//	const int JobExperience = pPlayer->AccountManager()->m_FarmingData.Get<JOB_EXPERIENCE>();
+//	const int JobUpgrades = pPlayer->AccountManager()->m_FarmingData.Get<JOB_UPGRADES>();
+//	const int JobUpgrQuantity = pPlayer->AccountManager()->m_FarmingData.Get<JOB_UPGR_QUANTITY>();
 //	const int ExperienceNeed = computeExperience(JobLevel);
 //
 //	GS()->AVM(ClientID, "null", NOPE, TAB_UPGR_JOB, "Plants Point: {INT} :: Level: {INT} Exp: {INT}/{INT}", JobUpgrades, JobLevel, JobExperience, ExperienceNeed);
@@ -111,14 +109,14 @@ void CAccountPlantManager::Work(CPlayer* pPlayer, int Level)
 {
 	const int ClientID = pPlayer->GetCID();
 	const int MultiplierExperience = maximum(1, (int)computeExperience(Level) / g_Config.m_SvPlantingIncreaseLevel);
-	pPlayer->Account()->m_FarmingData(JOB_EXPERIENCE, 0).m_Value += MultiplierExperience;
+	pPlayer->Account()->m_FarmingData.Get<JOB_EXPERIENCE>() += MultiplierExperience;
 
-	int ExperienceNeed = computeExperience(pPlayer->Account()->m_FarmingData(JOB_LEVEL, 0).m_Value);
-	for (; pPlayer->Account()->m_FarmingData(JOB_EXPERIENCE, 0).m_Value >= ExperienceNeed; )
+	int ExperienceNeed = computeExperience(pPlayer->Account()->m_FarmingData.Get<JOB_LEVEL>());
+	for (; pPlayer->Account()->m_FarmingData.Get<JOB_EXPERIENCE>() >= ExperienceNeed; )
 	{
-		pPlayer->Account()->m_FarmingData(JOB_EXPERIENCE, 0).m_Value -= ExperienceNeed;
-		pPlayer->Account()->m_FarmingData(JOB_LEVEL, 0).m_Value++;
-		pPlayer->Account()->m_FarmingData(JOB_UPGRADES, 0).m_Value++;
+		pPlayer->Account()->m_FarmingData.Get<JOB_EXPERIENCE>() -= ExperienceNeed;
+		pPlayer->Account()->m_FarmingData.Get<JOB_LEVEL>()++;
+		pPlayer->Account()->m_FarmingData.Get<JOB_UPGRADES>()++;
 
 		if(pPlayer->GetCharacter() && pPlayer->GetCharacter()->IsAlive())
 		{
@@ -127,11 +125,11 @@ void CAccountPlantManager::Work(CPlayer* pPlayer, int Level)
 			GS()->CreateText(pPlayer->GetCharacter(), false, vec2(0, -40), vec2(0, -1), 40, "plants up");
 		}
 
-		ExperienceNeed = computeExperience(pPlayer->Account()->m_FarmingData(JOB_LEVEL, 0).m_Value);
-		GS()->Chat(ClientID, "Plants Level UP. Now Level {INT}!", pPlayer->Account()->m_FarmingData(JOB_LEVEL, 0).m_Value);
+		ExperienceNeed = computeExperience(pPlayer->Account()->m_FarmingData.Get<JOB_LEVEL>());
+		GS()->Chat(ClientID, "Plants Level UP. Now Level {INT}!", pPlayer->Account()->m_FarmingData.Get<JOB_LEVEL>());
 	}
 
-	pPlayer->ProgressBar("Plants", pPlayer->Account()->m_FarmingData(JOB_LEVEL, 0).m_Value, pPlayer->Account()->m_FarmingData(JOB_EXPERIENCE, 0).m_Value, ExperienceNeed, MultiplierExperience);
+	pPlayer->ProgressBar("Plants", pPlayer->Account()->m_FarmingData.Get<JOB_LEVEL>(), pPlayer->Account()->m_FarmingData.Get<JOB_EXPERIENCE>(), ExperienceNeed, MultiplierExperience);
 	Core()->SaveAccount(pPlayer, SAVE_PLANT_DATA);
 }
 
@@ -140,7 +138,8 @@ bool CAccountPlantManager::OnHandleVoteCommands(CPlayer *pPlayer, const char *CM
 	const int ClientID = pPlayer->GetCID();
 	if(PPSTR(CMD, "PLANTUPGRADE") == 0)
 	{
-		if(pPlayer->Upgrade(Get, &pPlayer->Account()->m_FarmingData(VoteID, 0).m_Value, &pPlayer->Account()->m_FarmingData(JOB_UPGRADES, 0).m_Value, VoteID2, 3))
+		int* pUpgrade = pPlayer->Account()->m_FarmingData.At(VoteID);
+		if(pUpgrade && pPlayer->Upgrade(Get, pUpgrade, &pPlayer->Account()->m_FarmingData.Get<JOB_UPGRADES>(), VoteID2, 3))
 		{
 			GS()->Core()->SaveAccount(pPlayer, SAVE_PLANT_DATA);
 			pPlayer->m_VotesData.UpdateVotesIf(MENU_UPGRADES);
@@ -3,6 +3,8 @@
 #ifndef GAME_SERVER_COMPONENT_DUNGEON_DATA_H
 #define GAME_SERVER_COMPONENT_DUNGEON_DATA_H
 
+#include <game/server/core/tools/dungeon_records.h>
+
 struct CPlayerDungeonRecord
 {
 	CPlayerDungeonRecord()
@@ -31,6 +33,7 @@ struct CDungeonData
 	int m_Progress;
 	int m_State;
 	bool m_IsStory;
+	CDungeonRecords m_Records;
 
 	bool IsDungeonPlaying() const { return m_State > 1; }
 
@@ -22,6 +22,15 @@ void CDungeonManager::OnInit()
 		CDungeonData::ms_aDungeon[ID].m_WorldID = pRes->getInt("WorldID");
 		CDungeonData::ms_aDungeon[ID].m_IsStory = pRes->getBoolean("Story");
 	}
+
+	// records are read once, the leaderboards are kept up to date in memory
+	ResultPtr pResRecords = Database->Execute<DB::SELECT>("UserID, DungeonID, Seconds, PassageHelp", "tw_dungeons_records");
+	while(pResRecords->next())
+	{
+		auto Iter = CDungeonData::ms_aDungeon.find(pResRecords->getInt("DungeonID"));
+		if(Iter != CDungeonData::ms_aDungeon.end())
+			Iter->second.m_Records.Submit(pResRecords->getInt("UserID"), pResRecords->getInt("Seconds"), pResRecords->getInt("PassageHelp"));
+	}
 }
 
 bool CDungeonManager::OnHandleMenulist(CPlayer* pPlayer, int Menulist)
@@ -142,35 +151,49 @@ bool CDungeonManager::IsDungeonWorld(int WorldID)
 		[WorldID](const std::pair<int, CDungeonData>& pDungeon) { return pDungeon.second.m_WorldID == WorldID; }) != CDungeonData::ms_aDungeon.end();
 }
 
-void CDungeonManager::SaveDungeonRecord(CPlayer* pPlayer, int DungeonID, CPlayerDungeonRecord* pPlayerDungeonRecord)
+void CDungeonManager::SaveDungeonRecords(int DungeonID, const std::vector<CDungeonRecords::CRecord>& vRecords)
 {
-	const int Seconds = pPlayerDungeonRecord->m_Time;
-	const float PassageHelp = pPlayerDungeonRecord->m_PassageHelp;
+	auto Iter = CDungeonData::ms_aDungeon.find(DungeonID);
+	if(Iter == CDungeonData::ms_aDungeon.end())
+		return;
 
-	ResultPtr pRes = Database->Execute<DB::SELECT>("*", "tw_dungeons_records", "WHERE UserID = '%d' AND DungeonID = '%d'", pPlayer->Account()->GetID(), DungeonID);
-	if(pRes->next())
+	// only new bests have to be written
+	std::string Rows;
+	for(const auto& Record : vRecords)
 	{
-		if(pRes->getInt("Seconds") > Seconds && pRes->getInt("PassageHelp") < PassageHelp)
-			Database->Execute<DB::UPDATE>("tw_dungeons_records", "Seconds = '%d', PassageHelp = '%f' WHERE UserID = '%d' AND DungeonID = '%d'",
-				Seconds, PassageHelp, pPlayer->Account()->GetID(), DungeonID);
-		return;
+		if(!Iter->second.m_Records.Submit(Record.m_UserID, Record.m_Seconds, Record.m_PassageHelp))
+			continue;
+
+		char aRow[96];
+		str_format(aRow, sizeof(aRow), "%s('%d', '%d', '%d', '%d')", Rows.empty() ? "" : ", ", Record.m_UserID, DungeonID, Record.m_Seconds, Record.m_PassageHelp);
+		Rows += aRow;
 	}
-	Database->Execute<DB::INSERT>("tw_dungeons_records", "(UserID, DungeonID, Seconds, PassageHelp) VALUES ('%d', '%d', '%d', '%f')", pPlayer->Account()->GetID(), DungeonID, Seconds, PassageHelp);
+	if(Rows.empty())
+		return;
+
+	// one statement for the whole group, a row keeps the faster passage and its passage help
+	const bool Sqlite = str_comp(Database->GetBackendName(), "sqlite") == 0;
+	const char* pConflict = Sqlite ? "ON CONFLICT(UserID, DungeonID) DO UPDATE SET" : "ON DUPLICATE KEY UPDATE";
+	const char* pNewSeconds = Sqlite ? "excluded.Seconds" : "VALUES(Seconds)";
+	const char* pNewHelp = Sqlite ? "excluded.PassageHelp" : "VALUES(PassageHelp)";
+	const char* pLeast = Sqlite ? "MIN" : "LEAST";
+	Database->Execute<DB::OTHER>("INSERT INTO tw_dungeons_records (UserID, DungeonID, Seconds, PassageHelp) VALUES %s %s "
+		"PassageHelp = CASE WHEN %s < Seconds THEN %s ELSE PassageHelp END, Seconds = %s(Seconds, %s)",
+		Rows.c_str(), pConflict, pNewSeconds, pNewHelp, pLeast, pNewSeconds);
 }
 
 void CDungeonManager::InsertVotesDungeonTop(int DungeonID, CVoteWrapper* pWrapper) const
 {
-	ResultPtr pRes = Database->Execute<DB::SELECT>("*", "tw_dungeons_records", "WHERE DungeonID = '%d' ORDER BY Seconds ASC LIMIT 5", DungeonID);
-	while(pRes->next())
+	auto Iter = CDungeonData::ms_aDungeon.find(DungeonID);
+	if(Iter == CDungeonData::ms_aDungeon.end())
+		return;
+
+	int Rank = 0;
+	for(const auto& Record : Iter->second.m_Records.Top())
 	{
-		const int Rank = pRes->getRow();
-		const int UserID = pRes->getInt("UserID");
-		const int BaseSeconds = pRes->getInt("Seconds");
-		const int BasePassageHelp = pRes->getInt("PassageHelp");
-
-		const int Minutes = BaseSeconds / 60;
-		const int Seconds = BaseSeconds - (BaseSeconds / 60 * 60);
-		pWrapper->Add("{INT}. {STR} | {INT}:{INT}min | {VAL}P", Rank, Server()->GetAccountNickname(UserID), Minutes, Seconds, BasePassageHelp);
+		const int Minutes = Record.m_Seconds / 60;
+		const int Seconds = Record.m_Seconds - (Record.m_Seconds / 60 * 60);
+		pWrapper->Add("{INT}. {STR} | {INT}:{INT}min | {VAL}P", ++Rank, Server()->GetAccountNickname(Record.m_UserID), Minutes, Seconds, Record.m_PassageHelp);
 	}
 }
 
@@ -19,7 +19,7 @@ class CDungeonManager : public MmoComponent
 
 public:
 	static bool IsDungeonWorld(int WorldID);
-	static void SaveDungeonRecord(CPlayer* pPlayer, int DungeonID, CPlayerDungeonRecord *pPlayerDungeonRecord);
+	static void SaveDungeonRecords(int DungeonID, const std::vector<CDungeonRecords::CRecord>& vRecords);
 	void InsertVotesDungeonTop(int DungeonID, class CVoteWrapper* pWrapper) const;
 	bool ShowDungeonsList(CPlayer* pPlayer, bool Story) const;
 	void NotifyUnlockedDungeonsByQuest(CPlayer* pPlayer, int QuestID) const;
@@ -95,14 +95,10 @@ std::pair<int, int> CEidolonManager::GetEidolonsSize(int ClientID) const
 	int Collect = 0;
 	int Max = static_cast<int>(CEidolonInfoData::Data().size());
 
-	if(CPlayerItem::Data().find(ClientID) != CPlayerItem::Data().end())
+	for(int ItemID : CPlayerItem::Index(ClientID).HeldInSlot(EQUIP_EIDOLON))
 	{
-		for(auto& p : CPlayerItem::Data()[ClientID])
-		{
-			if(p.second.HasItem() && p.second.Info()->IsType(ItemType::TYPE_EQUIP) && p.second.Info()->IsFunctional(
-				EQUIP_EIDOLON))
-				Collect++;
-		}
+		if(CItemDescription::Data()[ItemID].IsType(ItemType::TYPE_EQUIP))
+			Collect++;
 	}
 
 	return std::make_pair(Collect, Max);
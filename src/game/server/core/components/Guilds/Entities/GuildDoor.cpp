@@ -14,12 +14,14 @@ CEntityGuildDoor::CEntityGuildDoor(CGameWorld* pGameWorld, vec2 Pos, CGuildHouse
 	GS()->Collision()->Wallline(32, vec2(0, -1), &m_Pos, &m_PosTo, false);
 	m_PosControll = Pos;
 	m_State = CLOSED;
+	m_BlockerID = GameWorld()->DoorBlockers()->AddSegment(m_Pos, m_PosTo, m_pHouse);
 	GS()->CreateLaserOrbite(this, 4, EntLaserOrbiteType::DEFAULT, 0.f, 16.f, LASERTYPE_DOOR);
 	GameWorld()->InsertEntity(this);
 }
 
 CEntityGuildDoor::~CEntityGuildDoor()
 {
+	GameWorld()->DoorBlockers()->RemoveSegment(m_BlockerID);
 }
 
 void CEntityGuildDoor::Tick()
@@ -52,29 +54,28 @@ void CEntityGuildDoor::Tick()
 				GS()->Broadcast(ClientID, BroadcastPriority::GAME_INFORMATION, 10, "You do not have access to '{STR}' door!", m_pDoorInfo->GetName());
 			}
 		}
+	}
 
-		// Check if the door is closed
-		if(m_State == CLOSED)
+	// Check if the door is closed
+	if(m_State == CLOSED)
+	{
+		// Only the characters within the door hit radius
+		CGameWorld::CDoorHit aHits[MAX_CLIENTS];
+		const int NumHits = GameWorld()->FindDoorHits(m_BlockerID, (float)g_Config.m_SvDoorRadiusHit, aHits);
+		for(int i = 0; i < NumHits; i++)
 		{
-			// Find the closest point on the line segment defined by m_Pos and m_PosTo to pChar's position
-			vec2 IntersectPos;
-			if(closest_point_on_line(m_Pos, m_PosTo, pChar->m_Core.m_Pos, IntersectPos))
+			// Check if both the door's guild and pChar's guild exist and have the same ID, shared by all doors of the house
+			CCharacter* pChar = aHits[i].m_pChar;
+			const bool Member = GameWorld()->DoorBlockers()->HasAccess(m_BlockerID, pChar->GetPlayer()->GetCID(), [&]()
 			{
-				// Check if the distance is within the door hit radius
-				const float Distance = distance(IntersectPos, pChar->m_Core.m_Pos);
-				if(Distance <= g_Config.m_SvDoorRadiusHit)
-				{
-					// Check if both the door's guild and pChar's guild exist and have the same ID
-					CGuildData* pCharGuild = pChar->GetPlayer()->Account()->GetGuild();
-					if(pCharGuild && m_pHouse->GetGuild() && pCharGuild->GetID() == m_pHouse->GetGuild()->GetID())
-					{
-						continue;
-					}
+				CGuildData* pCharGuild = pChar->GetPlayer()->Account()->GetGuild();
+				return pCharGuild && m_pHouse->GetGuild() && pCharGuild->GetID() == m_pHouse->GetGuild()->GetID();
+			});
+			if(Member)
+				continue;
 
-					// Set pChar's DoorHit flag to true
-					pChar->m_DoorHit = true;
-				}
-			}
+			// Set pChar's DoorHit flag to true
+			pChar->m_DoorHit = true;
 		}
 	}
 }
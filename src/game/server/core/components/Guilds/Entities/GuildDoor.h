@@ -19,6 +19,7 @@ class CEntityGuildDoor : public CEntity
 	CGuildHouseDoor* m_pDoorInfo {};
 	int m_State {};
 	vec2 m_PosControll {};
+	int m_BlockerID {};
 
 public:
 	CEntityGuildDoor(CGameWorld* pGameWorld, vec2 Pos, CGuildHouseDoor* pDoorInfo, CGuildHouseData* pHouse);
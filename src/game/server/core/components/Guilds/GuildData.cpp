@@ -22,8 +22,8 @@ bool CGuildData::Upgrade(int Type)
 		return false;
 
 	// Check if the type is UPGRADE_AVAILABLE_SLOTS and the value of the first upgrade data is greater than or equal to MAX_GUILD_SLOTS
-	auto* pUpgradeData = &m_UpgradesData(Type, 0);
-	if(Type == UPGRADE_AVAILABLE_SLOTS && m_UpgradesData(Type, 0).m_Value >= MAX_GUILD_SLOTS)
+	int* pUpgradeValue = m_UpgradesData.At(Type);
+	if(Type == UPGRADE_AVAILABLE_SLOTS && *pUpgradeValue >= MAX_GUILD_SLOTS)
 		return false;
 
 	// Get a pointer to the upgrade data and price for the specified Type
@@ -33,12 +33,12 @@ bool CGuildData::Upgrade(int Type)
 	if(m_pBank->Spend(Price))
 	{
 		// Increase the value of the upgrade by 1
-		pUpgradeData->m_Value += 1;
-		Database->Execute<DB::UPDATE>(TW_GUILDS_TABLE, "%s = '%d' WHERE ID = '%d'", pUpgradeData->getFieldName(), pUpgradeData->m_Value, m_ID);
+		*pUpgradeValue += 1;
+		Database->Execute<DB::UPDATE>(TW_GUILDS_TABLE, "%s = '%d' WHERE ID = '%d'", CGuildUpgrades::GetFieldName(Type), *pUpgradeValue, m_ID);
 
 		// Add and send a history entry for the upgrade
-		m_pLogger->Add(LOGFLAG_UPGRADES_CHANGES, "'%s' upgraded to %d level", pUpgradeData->getDescription(), pUpgradeData->m_Value);
-		GS()->ChatGuild(m_ID, "'{STR}' upgraded to {VAL} level", pUpgradeData->getDescription(), pUpgradeData->m_Value);
+		m_pLogger->Add(LOGFLAG_UPGRADES_CHANGES, "'%s' upgraded to %d level", CGuildUpgrades::GetDescription(Type), *pUpgradeValue);
+		GS()->ChatGuild(m_ID, "'{STR}' upgraded to {VAL} level", CGuildUpgrades::GetDescription(Type), *pUpgradeValue);
 		return true;
 	}
 
@@ -233,7 +233,7 @@ int CGuildData::GetUpgradePrice(int Type)
 		return 0;
 
 	// Return the calculated price
-	return m_UpgradesData(Type, 0).m_Value * (Type == UPGRADE_AVAILABLE_SLOTS ? g_Config.m_SvPriceUpgradeGuildSlot : g_Config.m_SvPriceUpgradeGuildAnother);
+	return GetUpgradeValue(Type) * (Type == UPGRADE_AVAILABLE_SLOTS ? g_Config.m_SvPriceUpgradeGuildSlot : g_Config.m_SvPriceUpgradeGuildAnother);
 }
 
 bool CGuildData::IsAccountMemberGuild(int AccountID)
@@ -32,6 +32,17 @@ enum class GUILD_RESULT : int
 	SUCCESSFUL                             // The guild operation was successful
 };
 
+// upgrade columns of tw_guilds, in the order of CGuildData::UPGRADE_*
+struct CGuildUpgradesSchema
+{
+	static constexpr DBSchema<int, int> ms_Schema
+	{
+		DBFieldInfo<int> { "AvailableSlots", "Available slots", DEFAULT_GUILD_AVAILABLE_SLOTS },
+		DBFieldInfo<int> { "ChairExperience", "Chair experience", DEFAULT_GUILD_CHAIR },
+	};
+};
+using CGuildUpgrades = DBFieldContainer<CGuildUpgradesSchema>;
+
 class CGuildData : public MultiworldIdentifiableStaticData< std::deque < CGuildData* > >
 {
 public:
@@ -48,11 +59,7 @@ private:
 	int m_Experience {};
 	int m_Score {};
 
-	DBFieldContainer m_UpgradesData
-	{
-		DBField<int> { UPGRADE_AVAILABLE_SLOTS, "AvailableSlots", "Available slots", DEFAULT_GUILD_AVAILABLE_SLOTS },
-		DBField<int> { UPGRADE_CHAIR_EXPERIENCE, "ChairExperience", "Chair experience", DEFAULT_GUILD_CHAIR },
-	};
+	CGuildUpgrades m_UpgradesData {};
 
 	CGuildWarData* m_pWar {};
 	CGuildBankManager* m_pBank {};
@@ -86,7 +93,7 @@ public:
 		m_Level = Level;
 		m_Experience = Experience;
 		m_Score = Score;
-		m_UpgradesData.initFields(pRes);
+		m_UpgradesData.InitFields(pRes);
 
 		// components init
 		m_pLogger = new CGuildLoggerManager(this, Logflag);
@@ -103,7 +110,8 @@ public:
 	CGuildRanksManager* GetRanks() const { return m_pRanks; }
 	CGuildHouseData* GetHouse() const { return m_pHouse; }
 	CGuildMembersManager* GetMembers() const { return m_pMembers; }
-	DBField<int>* GetUpgrades(int Type) { return &m_UpgradesData(Type, 0); }
+	int GetUpgradeValue(int Type) const { const int* pValue = m_UpgradesData.At(Type); return pValue ? *pValue : 0; }
+	const char* GetUpgradeDescription(int Type) const { return CGuildUpgrades::GetDescription(Type); }
 	const char* GetName() const { return m_Name.c_str(); }
 	int GetLeaderUID() const { return m_LeaderUID; }
 	int GetLevel() const { return m_Level; }
@@ -127,5 +135,6 @@ public:
 	// global functions
 	static bool IsAccountMemberGuild(int AccountID);
 };
+static_assert(CGuildUpgrades::NUM_FIELDS == CGuildData::NUM_GUILD_UPGRADES);
 
 #endif
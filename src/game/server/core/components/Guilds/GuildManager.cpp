@@ -103,7 +103,7 @@ bool CGuildManager::OnHandleTile(CCharacter* pChr, int IndexCollision)
 			//if(HouseID <= 0 || GuildID <= 0)
 			//	return true;
 
-			//const int Exp = CGuildData::ms_aGuild[GuildID].m_UpgradesData(CGuildData::CHAIR_EXPERIENCE, 0).m_Value;
+			//const int Exp = CGuildData::ms_aGuild[GuildID].GetUpgradeValue(CGuildData::UPGRADE_CHAIR_EXPERIENCE);
 			//pPlayer->AccountManager()->AddExperience(Exp);
 		}
 		return true;
@@ -1090,7 +1090,7 @@ void CGuildManager::ShowMenu(int ClientID) const
 	bool HasHouse = pGuild->HasHouse();
 	int ExpNeed = computeExperience(pGuild->GetLevel());
 	const int MemberUsedSlots = pGuild->GetMembers()->GetContainer().size();
-	const int MemberMaxSlots = pGuild->GetUpgrades(CGuildData::UPGRADE_AVAILABLE_SLOTS)->m_Value;
+	const int MemberMaxSlots = pGuild->GetUpgradeValue(CGuildData::UPGRADE_AVAILABLE_SLOTS);
 
 	// Guild information
 	CVoteWrapper VInfo(ClientID, VWF_SEPARATE_OPEN|VWF_STYLE_SIMPLE, "\u2747 Information about {STR}", pGuild->GetName());
@@ -1174,9 +1174,9 @@ void CGuildManager::ShowMenu(int ClientID) const
 		if(i == CGuildData::UPGRADE_CHAIR_EXPERIENCE && !HasHouse)
 			continue;
 
-		const auto* pUpgrade = pGuild->GetUpgrades(i);
-		int Price = pUpgrade->m_Value * (i == CGuildData::UPGRADE_AVAILABLE_SLOTS ? g_Config.m_SvPriceUpgradeGuildSlot : g_Config.m_SvPriceUpgradeGuildAnother);
-		VUpgrades.AddOption("GUILD_UPGRADE", i, "Upgrade {STR} ({INT}) {VAL}gold", pUpgrade->getDescription(), pUpgrade->m_Value, Price);
+		const int Value = pGuild->GetUpgradeValue(i);
+		int Price = Value * (i == CGuildData::UPGRADE_AVAILABLE_SLOTS ? g_Config.m_SvPriceUpgradeGuildSlot : g_Config.m_SvPriceUpgradeGuildAnother);
+		VUpgrades.AddOption("GUILD_UPGRADE", i, "Upgrade {STR} ({INT}) {VAL}gold", pGuild->GetUpgradeDescription(i), Value, Price);
 	}
 
 	// Add backpage
@@ -6,6 +6,7 @@
 #include <game/server/gamecontext.h>
 
 #include <game/server/core/components/Guilds/GuildData.h>
+#include <game/server/core/entities/tools/loltext.h>
 
 CGS* CGuildHouseData::GS() const { return (CGS*)Instance::GameServer(m_WorldID); }
 
@@ -113,10 +114,15 @@ void CGuildHouseData::TextUpdate(int LifeTime)
 	if(IsPurchased())
 		Name = m_pGuild->GetName();
 
-	// Create a text object with the given parameters
-	if(GS()->CreateText(nullptr, false, m_TextPosition, {}, LifeTime - 5, Name.c_str()))
+	// The text stays in the world and is only rewritten when the owner changes
+	if(GS()->m_World.ExistEntity(m_pText))
+		m_pText->SetText(Name.c_str());
+	else
+		m_pText = GS()->CreateText(nullptr, false, m_TextPosition, {}, 0, Name.c_str());
+
+	if(m_pText)
 	{
-		// Update the value of "m_LastTickTextUpdated" to the current server tick plus the lifetime of the text object
+		// Check the owner again after the given number of ticks
 		m_LastTickTextUpdated = Server()->Tick() + LifeTime;
 	}
 }
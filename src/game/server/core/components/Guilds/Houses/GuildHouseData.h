@@ -29,6 +29,7 @@ class CGuildHouseData : public MultiworldIdentifiableStaticData< std::deque < CG
 	int m_Price {};
 	int m_WorldID{};
 	int m_LastTickTextUpdated {};
+	class CWorldText* m_pText {};
 
 	CGuildHouseDoorManager* m_pDoors {};
 	CGuildHouseDecorationManager* m_pDecorations {};
@@ -3,33 +3,26 @@
 #include "GuildBankManager.h"
 
 #include <game/server/gamecontext.h>
+#include <game/server/core/tools/bank_ledger.h>
 #include "../GuildData.h"
 
 CGS* CGuildBankManager::GS() const { return m_pGuild->GS(); }
 
-// Set the bank value to the given Value and update the database
-void CGuildBankManager::Set(int Value)
+// Add the given Value to the guild's bank
+void CGuildBankManager::Add(int Value)
 {
-	m_Bank = Value;
-	Database->Execute<DB::UPDATE>(TW_GUILDS_TABLE, "Bank = '%d' WHERE ID = '%d'", m_Bank, m_pGuild->GetID());
+	m_Bank += Value;
+	CBankLedger::Get().Record(CBankLedger::KIND_GUILD, m_pGuild->GetID(), Value);
 }
 
 // Spend the given Value from the guild's bank
 bool CGuildBankManager::Spend(int Value)
 {
-	// Retrieve the current bank value from the database
-	ResultPtr pRes = Database->Execute<DB::SELECT>("Bank", TW_GUILDS_TABLE, "WHERE ID = '%d'", m_pGuild->GetID());
-	if(pRes->next())
-	{
-		int Bank = pRes->getInt("Bank");
-		if(Bank >= Value)
-		{
-			// Update the bank value and update the database
-			m_Bank = Bank - Value;
-			Database->Execute<DB::UPDATE>(TW_GUILDS_TABLE, "Bank = '%d' WHERE ID = '%d'", m_Bank, m_pGuild->GetID());
-			return true;
-		}
-	}
+	// The bank in memory is authoritative, no need to ask the database
+	if(Value < 0 || m_Bank < Value)
+		return false;
 
-	return false;
-}
\ No newline at end of file
+	m_Bank -= Value;
+	CBankLedger::Get().Record(CBankLedger::KIND_GUILD, m_pGuild->GetID(), -Value);
+	return true;
+}
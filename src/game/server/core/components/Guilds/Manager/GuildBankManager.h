@@ -24,8 +24,8 @@ public:
 	// Get the current amount of currency in the bank
 	const int& Get() const { return m_Bank; }
 
-	// Spend and set
-	void Set(int Value);
+	// Add and spend, the database follows through the bank ledger
+	void Add(int Value);
 	[[nodiscard]] bool Spend(int Value);
 };
 
@@ -71,27 +71,21 @@ bool CGuildMemberData::DepositInBank(int Golds)
 	if(!pPlayer)
 		return false;
 
-	// Get the bank value from the guild table in the database
-	ResultPtr pRes = Database->Execute<DB::SELECT>("Bank", TW_GUILDS_TABLE, "WHERE ID = '%d'", m_pGuild->GetID());
-	if(pRes->next())
+	// If the player has enough gold to deposit
+	if(pPlayer->Account()->SpendCurrency(Golds))
 	{
-		// If the player has enough gold to deposit
-		if(pPlayer->Account()->SpendCurrency(Golds))
-		{
-			// Increase the member's deposit and the guild bank value
-			m_Deposit += Golds;
-			m_pGuild->GetBank()->Set(pRes->getInt("Bank") + Golds);
-			Database->Execute<DB::UPDATE>(TW_GUILDS_TABLE, "Bank = '%d' WHERE ID = '%d'", m_pGuild->GetBank()->Get(), m_pGuild->GetID());
-
-			// Send a chat message to the player indicating the successful deposit and the new bank value
-			const char* pNickname = Instance::Server()->GetAccountNickname(m_AccountID);
-			m_pGuild->GetLogger()->Add(LOGFLAG_BANK_CHANGES, "'%s' deposit '%d' in the guild safe.", pNickname, Golds);
-			GS()->ChatGuild(m_pGuild->GetID(), "'{STR}' deposit {VAL} gold in the safe, now {VAL}!", pNickname, Golds, m_pGuild->GetBank()->Get());
-
-			// Save guild data
-			m_pGuild->GetMembers()->Save();
-			return true;
-		}
+		// Increase the member's deposit and the guild bank value
+		m_Deposit += Golds;
+		m_pGuild->GetBank()->Add(Golds);
+
+		// Send a chat message to the player indicating the successful deposit and the new bank value
+		const char* pNickname = Instance::Server()->GetAccountNickname(m_AccountID);
+		m_pGuild->GetLogger()->Add(LOGFLAG_BANK_CHANGES, "'%s' deposit '%d' in the guild safe.", pNickname, Golds);
+		GS()->ChatGuild(m_pGuild->GetID(), "'{STR}' deposit {VAL} gold in the safe, now {VAL}!", pNickname, Golds, m_pGuild->GetBank()->Get());
+
+		// Save guild data
+		m_pGuild->GetMembers()->Save();
+		return true;
 	}
 
 	return false;
@@ -105,30 +99,22 @@ bool CGuildMemberData::WithdrawFromBank(int Golds)
 	if(!pPlayer)
 		return false;
 
-	// Get the bank value from the guild table in the database
-	ResultPtr pRes = Database->Execute<DB::SELECT>("Bank", TW_GUILDS_TABLE, "WHERE ID = '%d'", m_pGuild->GetID());
-	if(pRes->next())
+	// Make sure the requested withdrawal amount is not greater than the available bank value
+	Golds = minimum(Golds, m_pGuild->GetBank()->Get());
+	if(Golds > 0 && m_pGuild->GetBank()->Spend(Golds))
 	{
-		int Bank = pRes->getInt("Bank");
-
-		// Make sure the requested withdrawal amount is not greater than the available bank value
-		Golds = minimum(Golds, Bank);
-		if(Golds > 0)
-		{
-			// Decrease the member's deposit, add the withdrawn gold to the player's account, and decrease the guild bank value
-			m_Deposit -= Golds;
-			pPlayer->Account()->AddGold(Golds);
-			m_pGuild->GetBank()->Set(Bank - Golds);
-
-			// Send a chat message to the player indicating the successful withdrawal and the new bank value
-			const char* pNickname = Instance::Server()->GetAccountNickname(m_AccountID);
-			m_pGuild->GetLogger()->Add(LOGFLAG_BANK_CHANGES, "'%s' withdrawn '%d' from the guild safe.", pNickname, Golds);
-			GS()->ChatGuild(m_pGuild->GetID(), "'{STR}' withdrawn {VAL} gold from the safe, now {VAL}!", pNickname, Golds, m_pGuild->GetBank()->Get());
-
-			// Save guild data
-			m_pGuild->GetMembers()->Save();
-			return true;
-		}
+		// Decrease the member's deposit and add the withdrawn gold to the player's account
+		m_Deposit -= Golds;
+		pPlayer->Account()->AddGold(Golds);
+
+		// Send a chat message to the player indicating the successful withdrawal and the new bank value
+		const char* pNickname = Instance::Server()->GetAccountNickname(m_AccountID);
+		m_pGuild->GetLogger()->Add(LOGFLAG_BANK_CHANGES, "'%s' withdrawn '%d' from the guild safe.", pNickname, Golds);
+		GS()->ChatGuild(m_pGuild->GetID(), "'{STR}' withdrawn {VAL} gold from the safe, now {VAL}!", pNickname, Golds, m_pGuild->GetBank()->Get());
+
+		// Save guild data
+		m_pGuild->GetMembers()->Save();
+		return true;
 	}
 
 	return false;
@@ -104,12 +104,12 @@ GUILD_MEMBER_RESULT CGuildMembersManager::Kick(int AccountID)
 
 bool CGuildMembersManager::HasFreeSlots() const
 {
-	return (int)m_apMembers.size() < m_pGuild->GetUpgrades(CGuildData::UPGRADE_AVAILABLE_SLOTS)->getValue();
+	return (int)m_apMembers.size() < m_pGuild->GetUpgradeValue(CGuildData::UPGRADE_AVAILABLE_SLOTS);
 }
 
 std::pair<int, int> CGuildMembersManager::GetCurrentSlots() const
 {
-	return std::pair((int)m_apMembers.size(), m_pGuild->GetUpgrades(CGuildData::UPGRADE_AVAILABLE_SLOTS)->getValue());
+	return std::pair((int)m_apMembers.size(), m_pGuild->GetUpgradeValue(CGuildData::UPGRADE_AVAILABLE_SLOTS));
 }
 
 // This function resets the deposit amount for all guild members
@@ -13,10 +13,32 @@ CEntityHouseDoor::CEntityHouseDoor(CGameWorld* pGameWorld, vec2 Pos, CHouseDoor*
 	GS()->Collision()->Wallline(32, vec2(0, -1), &m_Pos, &m_PosTo, false);
 	m_PosControll = Pos;
 	m_State = CLOSED;
+	m_BlockerID = GameWorld()->DoorBlockers()->AddSegment(m_Pos, m_PosTo, m_pHouse);
 	GS()->CreateLaserOrbite(this, 4, EntLaserOrbiteType::DEFAULT, 0.f, 16.f, LASERTYPE_DOOR);
 	GameWorld()->InsertEntity(this);
 }
 
+CEntityHouseDoor::~CEntityHouseDoor()
+{
+	GameWorld()->DoorBlockers()->RemoveSegment(m_BlockerID);
+}
+
+bool CEntityHouseDoor::HasAccess(CCharacter* pChar) const
+{
+	// Characters who have access to the house door
+	if(m_pHouse->GetDoorsController()->HasAccess(pChar->GetPlayer()->Account()->GetID()))
+		return true;
+
+	// Eidolon when the owner has access
+	if(pChar->GetPlayer()->IsBot())
+	{
+		CPlayerBot* pPlayerBot = static_cast<CPlayerBot*>(pChar->GetPlayer());
+		if(pPlayerBot->GetEidolonOwner() && m_pHouse->GetDoorsController()->HasAccess(pPlayerBot->GetEidolonOwner()->Account()->GetID()))
+			return true;
+	}
+	return false;
+}
+
 void CEntityHouseDoor::Tick()
 {
 	// Get the UID of the owner of the house
@@ -48,36 +70,18 @@ void CEntityHouseDoor::Tick()
 	// Check if the door is opened
 	if(m_State == CLOSED)
 	{
-		// Loop through all characters in the game world
-		for(CCharacter* pChar = (CCharacter*)GameWorld()->FindFirst(CGameWorld::ENTTYPE_CHARACTER); pChar; pChar = (CCharacter*)pChar->TypeNext())
+		// Only the characters within the door radius hit limit
+		CGameWorld::CDoorHit aHits[MAX_CLIENTS];
+		const int NumHits = GameWorld()->FindDoorHits(m_BlockerID, (float)g_Config.m_SvDoorRadiusHit, aHits);
+		for(int i = 0; i < NumHits; i++)
 		{
-			vec2 IntersectPos;
-
-			// Find the closest point on the line from the door position to the destination position to the character's position
-			if(closest_point_on_line(m_Pos, m_PosTo, pChar->m_Core.m_Pos, IntersectPos))
-			{
-				// Calculate the distance between the intersect point and the character's position
-				const float Distance = distance(IntersectPos, pChar->m_Core.m_Pos);
+			// Skip characters who have access, shared by all doors of the house
+			CCharacter* pChar = aHits[i].m_pChar;
+			if(GameWorld()->DoorBlockers()->HasAccess(m_BlockerID, pChar->GetPlayer()->GetCID(), [&]() { return HasAccess(pChar); }))
+				continue;
 
-				// Check if the distance is within the door radius hit limit
-				if(Distance <= g_Config.m_SvDoorRadiusHit)
-				{
-					// Skip characters who have access to the house door
-					if(m_pHouse->GetDoorsController()->HasAccess(pChar->GetPlayer()->Account()->GetID()))
-						continue;
-
-					// Skip eidolon when the owner has access
-					if(pChar->GetPlayer()->IsBot())
-					{
-						CPlayerBot* pPlayerBot = static_cast<CPlayerBot*>(pChar->GetPlayer());
-						if(pPlayerBot->GetEidolonOwner() && m_pHouse->GetDoorsController()->HasAccess(pPlayerBot->GetEidolonOwner()->Account()->GetID()))
-							continue;
-					}
-
-					// Set the character's door hit flag to true
-					pChar->m_DoorHit = true;
-				}
-			}
+			// Set the character's door hit flag to true
+			pChar->m_DoorHit = true;
 		}
 	}
 }
@@ -16,9 +16,13 @@ class CEntityHouseDoor : public CEntity
 	class CHouseDoor* m_pDoorInfo {};
 	int m_State {};
 	vec2 m_PosControll {};
+	int m_BlockerID {};
+
+	bool HasAccess(CCharacter* pChar) const;
 
 public:
 	CEntityHouseDoor(CGameWorld* pGameWorld, vec2 Pos, class CHouseDoor* pDoorInfo, class CHouseData* pHouse);
+	~CEntityHouseDoor() override;
 
 	void Tick() override;
 	void Snap(int SnappingClient) override;
@@ -3,6 +3,7 @@
 #include "HouseBankData.h"
 
 #include "game/server/gamecontext.h"
+#include <game/server/core/tools/bank_ledger.h>
 #include "HouseData.h"
 
 // Returns the player associated with the house
@@ -16,27 +17,16 @@ void CHouseBankData::Add(int Value)
 	if(!pPlayer)
 		return;
 
-	// Execute a SELECT query on the database to retrieve the ID and HouseBank columns from the TW_HOUSES_TABLE
-	// where the UserID is equal to the value of m_pAccountID
-	ResultPtr pRes = Database->Execute<DB::SELECT>("ID, HouseBank", TW_HOUSES_TABLE, "WHERE UserID = '%d'", *m_pAccountID);
-
-	// Check if there is a result from the query
-	if(pRes->next())
+	// Check if the player has enough currency to spend the specified value
+	if(pPlayer->Account()->SpendCurrency(Value))
 	{
-		// Retrieve the value of the ID column from the result
-		int HouseID = pRes->getInt("ID");
-
-		// Check if the player has enough currency to spend the specified value
-		if(pPlayer->Account()->SpendCurrency(Value))
-		{
-			// Update the value of the HouseBank column in the TW_HOUSES_TABLE by adding the specified value to the current value
-			m_Bank = pRes->getInt("HouseBank") + Value;
-			Database->Execute<DB::UPDATE>(TW_HOUSES_TABLE, "HouseBank = '%d' WHERE ID = '%d'", m_Bank, HouseID);
+		// The bank in memory is authoritative, the database follows through the bank ledger
+		m_Bank += Value;
+		CBankLedger::Get().Record(CBankLedger::KIND_HOUSE, m_HouseID, Value);
 
-			// Send a chat message to the player indicating the amount of gold they have put in the safe
-			int ClientID = pPlayer->GetCID();
-			m_pGS->Chat(ClientID, "You put {VAL} gold in the safe, now {VAL}!", Value, m_Bank);
-		}
+		// Send a chat message to the player indicating the amount of gold they have put in the safe
+		int ClientID = pPlayer->GetCID();
+		m_pGS->Chat(ClientID, "You put {VAL} gold in the safe, now {VAL}!", Value, m_Bank);
 	}
 }
 
@@ -48,34 +38,27 @@ void CHouseBankData::Take(int Value)
 	if(!pPlayer)
 		return;
 
-	// Execute a SELECT query on the database to retrieve the ID and HouseBank columns from the TW_HOUSES_TABLE table where the UserID matches the value of m_pAccountID
-	ResultPtr pRes = Database->Execute<DB::SELECT>("ID, HouseBank", TW_HOUSES_TABLE, "WHERE UserID = '%d'", *m_pAccountID);
-	if(pRes->next())
-	{
-		// Get the ClientID of the player
-		int ClientID = pPlayer->GetCID();
-
-		// Get the HouseID and Bank values from the result
-		int HouseID = pRes->getInt("ID");
-		int Bank = pRes->getInt("HouseBank");
-
-		// Update the Value to be the minimum of Value and Bank
-		Value = minimum(Value, Bank);
+	// Update the Value to be the minimum of Value and Bank
+	Value = minimum(Value, m_Bank);
 
-		// If Value is greater than 0
-		if(Value > 0)
-		{
-			// Add Value to the player's money
-			pPlayer->Account()->AddGold(Value);
-
-			// Update the m_Bank variable to be Bank minus Value
-			m_Bank = Bank - Value;
+	// If Value is greater than 0
+	if(Value > 0)
+	{
+		// Add Value to the player's money
+		pPlayer->Account()->AddGold(Value);
 
-			// Execute an UPDATE query on the database to update the HouseBank column of the TW_HOUSES_TABLE table where the ID matches HouseID
-			Database->Execute<DB::UPDATE>(TW_HOUSES_TABLE, "HouseBank = '%d' WHERE ID = '%d'", m_Bank, HouseID);
+		// Take it from the bank, the database follows through the bank ledger
+		m_Bank -= Value;
+		CBankLedger::Get().Record(CBankLedger::KIND_HOUSE, m_HouseID, -Value);
 
-			// Send a message to the client with the updated information
-			m_pGS->Chat(ClientID, "You take {VAL} gold in the safe {VAL}!", Value, m_Bank);
-		}
+		// Send a message to the client with the updated information
+		m_pGS->Chat(pPlayer->GetCID(), "You take {VAL} gold in the safe {VAL}!", Value, m_Bank);
 	}
-}
\ No newline at end of file
+}
+
+// Resets the bank value to 0
+void CHouseBankData::Reset()
+{
+	CBankLedger::Get().Record(CBankLedger::KIND_HOUSE, m_HouseID, -m_Bank);
+	m_Bank = 0;
+}
@@ -8,14 +8,15 @@ class CHouseBankData
 {
 	class CGS* m_pGS;
 	int* m_pAccountID {};
+	int m_HouseID {};
 	int m_Bank {};
 
 	// Returns the player associated with the house
 	class CPlayer* GetPlayer() const;
 
 public:
-	// Constructor that initializes the bank data with the game server, account ID, and initial bank value
-	CHouseBankData(CGS* pGS, int* pAccountID, int Bank) : m_pGS(pGS), m_pAccountID(pAccountID), m_Bank(Bank) {}
+	// Constructor that initializes the bank data with the game server, account ID, house ID, and initial bank value
+	CHouseBankData(CGS* pGS, int* pAccountID, int HouseID, int Bank) : m_pGS(pGS), m_pAccountID(pAccountID), m_HouseID(HouseID), m_Bank(Bank) {}
 
 	// Returns the current bank value
 	int Get() const { return m_Bank; }
@@ -27,7 +28,7 @@ public:
 	void Take(int Value);
 
 	// Resets the bank value to 0
-	void Reset() { m_Bank = 0; }
+	void Reset();
 };
 
 #endif
\ No newline at end of file
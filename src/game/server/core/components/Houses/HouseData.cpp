@@ -6,6 +6,7 @@
 
 #include <game/server/core/entities/items/jobitems.h>
 #include <game/server/core/entities/tools/draw_board.h>
+#include <game/server/core/entities/tools/loltext.h>
 
 CGS* CHouseData::GS() const { return static_cast<CGS*>(Server()->GameServer(m_WorldID)); }
 CPlayer* CHouseData::GetPlayer() const { return GS()->GetPlayerByUserID(m_AccountID); }
@@ -147,7 +148,7 @@ void CHouseData::Buy(CPlayer* pPlayer)
 		m_pDoorsController->CloseAll();
 		m_pBank->Reset();
 		pPlayer->Account()->ReinitializeHouse();
-		Database->Execute<DB::UPDATE>(TW_HOUSES_TABLE, "UserID = '%d', HouseBank = '0', AccessData = NULL WHERE ID = '%d'", m_AccountID, m_ID);
+		Database->Execute<DB::UPDATE>(TW_HOUSES_TABLE, "UserID = '%d', AccessData = NULL WHERE ID = '%d'", m_AccountID, m_ID);
 
 		// send information
 		GS()->Chat(-1, "{STR} becomes the owner of the house class {STR}", Server()->ClientName(ClientID), GetClassName());
@@ -178,7 +179,7 @@ void CHouseData::Sell()
 	{
 		pPlayer->Account()->ReinitializeHouse();
 	}
-	Database->Execute<DB::UPDATE>(TW_HOUSES_TABLE, "UserID = NULL, HouseBank = '0', AccessData = NULL WHERE ID = '%d'", m_ID);
+	Database->Execute<DB::UPDATE>(TW_HOUSES_TABLE, "UserID = NULL, AccessData = NULL WHERE ID = '%d'", m_ID);
 
 	// Send informations
 	if(pPlayer)
@@ -232,10 +233,15 @@ void CHouseData::TextUpdate(int LifeTime)
 		Name = Server()->GetAccountNickname(m_AccountID);
 	}
 
-	// Create a text object with the given parameters
-	if(GS()->CreateText(nullptr, false, m_TextPos, {}, LifeTime - 5, Name.c_str()))
+	// The text stays in the world and is only rewritten when the owner changes
+	if(GS()->m_World.ExistEntity(m_pText))
+		m_pText->SetText(Name.c_str());
+	else
+		m_pText = GS()->CreateText(nullptr, false, m_TextPos, {}, 0, Name.c_str());
+
+	if(m_pText)
 	{
-		// Update the value of "m_LastTickTextUpdated" to the current server tick plus the lifetime of the text object
+		// Check the owner again after the given number of ticks
 		m_LastTickTextUpdated = Server()->Tick() + LifeTime;
 	}
 }
\ No newline at end of file
@@ -35,6 +35,7 @@ class CHouseData : public MultiworldIdentifiableStaticData< std::deque < HouseDa
 	int m_Price {};
 
 	int m_LastTickTextUpdated{};
+	class CWorldText* m_pText {};
 
 	class CGS* GS() const;
 	class CPlayer* GetPlayer() const;
@@ -65,7 +66,7 @@ public:
 		m_pDoorsController = new CHouseDoorsController(GS(), std::move(AccessSet), std::move(JsonDoorData), this);
 		
 		// bank init
-		m_pBank = new CHouseBankData(GS(), &m_AccountID, Bank);
+		m_pBank = new CHouseBankData(GS(), &m_AccountID, m_ID, Bank);
 
 		// init decoration
 		InitDecorations();
@@ -9,20 +9,19 @@
 #include <game/server/core/components/Quests/QuestManager.h>
 
 template < typename T >
-void ExecuteTemplateItemsTypes(T Type, std::map < int, CPlayerItem >& paItems, const std::function<void(const CPlayerItem&)> pFunc)
+void ExecuteTemplateItemsTypes(T Type, int ClientID, const std::function<void(const CPlayerItem&)> pFunc)
 {
-	bool Found = false;
-	for(const auto& [ItemID, ItemData] : paItems)
-	{
-		bool ActivateCallback = false;
-		if constexpr(std::is_same_v<T, ItemType>)
-			ActivateCallback = ItemData.HasItem() && ItemData.Info()->IsType(Type);
-		else if constexpr(std::is_same_v<T, ItemFunctional>)
-			ActivateCallback = ItemData.HasItem() && ItemData.Info()->IsFunctional(Type);
-
-		if(ActivateCallback)
-			pFunc(ItemData);
-	}
+	// only the held items of the type or slot, in item order
+	const CInventoryIndex& Index = CPlayerItem::Index(ClientID);
+	const std::vector<int>* pvItems = nullptr;
+	if constexpr(std::is_same_v<T, ItemType>)
+		pvItems = &Index.Held((int)Type);
+	else if constexpr(std::is_same_v<T, ItemFunctional>)
+		pvItems = &Index.HeldInSlot((int)Type);
+
+	auto& aItems = CPlayerItem::Data()[ClientID];
+	for(int ItemID : *pvItems)
+		pFunc(aItems[ItemID]);
 }
 
 using namespace sqlstr;
@@ -90,6 +89,7 @@ void CInventoryManager::OnInitAccount(CPlayer* pPlayer)
 void CInventoryManager::OnResetClient(int ClientID)
 {
 	CPlayerItem::Data().erase(ClientID);
+	CPlayerItem::ResetIndex(ClientID);
 }
 
 bool CInventoryManager::OnHandleMenulist(CPlayer* pPlayer, int Menulist)
@@ -275,7 +275,7 @@ std::vector<int> CInventoryManager::GetItemIDsCollectionByFunction(ItemFunctiona
 
 void CInventoryManager::ListInventory(int ClientID, ItemType Type)
 {
-	ExecuteTemplateItemsTypes(Type, CPlayerItem::Data()[ClientID], [&](const CPlayerItem& pItem)
+	ExecuteTemplateItemsTypes(Type, ClientID, [&](const CPlayerItem& pItem)
 	{
 		ItemSelected(GS()->m_apPlayers[ClientID], &pItem);
 	});
@@ -283,7 +283,7 @@ void CInventoryManager::ListInventory(int ClientID, ItemType Type)
 
 void CInventoryManager::ListInventory(int ClientID, ItemFunctional Type)
 {
-	ExecuteTemplateItemsTypes(Type, CPlayerItem::Data()[ClientID], [&](const CPlayerItem& pItem)
+	ExecuteTemplateItemsTypes(Type, ClientID, [&](const CPlayerItem& pItem)
 	{
 		ItemSelected(GS()->m_apPlayers[ClientID], &pItem);
 	});
@@ -394,41 +394,10 @@ void CInventoryManager::ItemSelected(CPlayer* pPlayer, const CPlayerItem* pItem)
 
 int CInventoryManager::GetCountItemsType(CPlayer* pPlayer, ItemType Type) const
 {
-	const int ClientID = pPlayer->GetCID();
-	return (int)std::count_if(CPlayerItem::Data()[ClientID].cbegin(), CPlayerItem::Data()[ClientID].cend(), [Type](auto pItem)
-	{
-		return pItem.second.HasItem() && pItem.second.Info()->IsType(Type);
-	});
+	return CPlayerItem::Index(pPlayer->GetCID()).Count((int)Type);
 }
 
-// TODO: FIX IT (lock .. unlock)
-std::mutex lock_sleep;
 void CInventoryManager::AddItemSleep(int AccountID, ItemIdentifier ItemID, int Value, int Milliseconds)
 {
-	std::thread Thread([this, AccountID, ItemID, Value, Milliseconds]()
-	{
-		if(Milliseconds > 0)
-			std::this_thread::sleep_for(std::chrono::milliseconds(Milliseconds));
-
-		lock_sleep.lock();
-		CPlayer* pPlayer = GS()->GetPlayerByUserID(AccountID);
-		if(pPlayer)
-		{
-			pPlayer->GetItem(ItemID)->Add(Value);
-			lock_sleep.unlock();
-			return;
-		}
-
-		ResultPtr pRes = Database->Execute<DB::SELECT>("Value", "tw_accounts_items", "WHERE ItemID = '%d' AND UserID = '%d'", ItemID, AccountID);
-		if(pRes->next())
-		{
-			const int ReallyValue = pRes->getInt("Value") + Value;
-			Database->Execute<DB::UPDATE>("tw_accounts_items", "Value = '%d' WHERE UserID = '%d' AND ItemID = '%d'", ReallyValue, AccountID, ItemID);
-			lock_sleep.unlock();
-			return;
-		}
-		Database->Execute<DB::INSERT>("tw_accounts_items", "(ItemID, UserID, Value, Settings, Enchant) VALUES ('%d', '%d', '%d', '0', '0')", ItemID, AccountID, Value);
-		lock_sleep.unlock();
-	});
-	Thread.detach();
+	Core()->ScheduleItemGrant(AccountID, ItemID, Value, Milliseconds);
 }
\ No newline at end of file
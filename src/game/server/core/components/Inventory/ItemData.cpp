@@ -46,6 +46,7 @@ bool CPlayerItem::SetSettings(int Settings)
 		return false;
 
 	m_Settings = Settings;
+	UpdateIndex();
 	return Save();
 }
 
@@ -90,6 +91,7 @@ bool CPlayerItem::Add(int Value, int StartSettings, int StartEnchant, bool Messa
 		m_Settings = StartSettings;
 	}
 	m_Value += Value;
+	UpdateIndex();
 
 	// check the empty slot if yes then put the item on
 	if((Info()->IsType(ItemType::TYPE_EQUIP) && GetPlayer()->GetEquippedItemID(Info()->GetFunctional()) <= 0) || Info()->IsType(ItemType::TYPE_MODULE))
@@ -130,6 +132,7 @@ bool CPlayerItem::Remove(int Value)
 		Equip(false);
 
 	m_Value -= Value;
+	UpdateIndex();
 	return Save();
 }
 
@@ -139,6 +142,7 @@ bool CPlayerItem::Equip(bool SaveItem)
 		return false;
 
 	m_Settings ^= true;
+	UpdateIndex();
 
 	if(Info()->IsType(ItemType::TYPE_EQUIP))
 	{
@@ -304,8 +308,9 @@ bool CPlayerItem::Save()
 	if(GetPlayer() && GetPlayer()->IsAuthed())
 	{
 		int UserID = GetPlayer()->Account()->GetID();
-		const auto pResCheck = Database->Prepare<DB::SELECT>("ItemID, UserID", "tw_accounts_items", "WHERE ItemID = '%d' AND UserID = '%d'", m_ID, UserID);
-		pResCheck->AtExecute([this, UserID](ResultPtr pRes)
+		auto pResCheck = Database->Prepare(STMT_ITEM_SELECT, "SELECT ItemID FROM tw_accounts_items WHERE ItemID = ? AND UserID = ?");
+		pResCheck->Bind(m_ID).Bind(UserID);
+		pResCheck->AtExecuteSelect([this, UserID](ResultPtr pRes)
 		{
 			// check database value
 			if(pRes->next())
@@ -313,13 +318,14 @@ bool CPlayerItem::Save()
 				// remove item
 				if(!m_Value)
 				{
-					Database->Execute<DB::REMOVE>("tw_accounts_items", "WHERE ItemID = '%d' AND UserID = '%d'", m_ID, UserID);
+					auto pRemove = Database->Prepare(STMT_ITEM_REMOVE, "DELETE FROM tw_accounts_items WHERE ItemID = ? AND UserID = ?");
+					pRemove->Bind(m_ID).Bind(UserID).Execute();
 					return;
 				}
 
 				// update an item
-				Database->Execute<DB::UPDATE>("tw_accounts_items", "Value = '%d', Settings = '%d', Enchant = '%d', Durability = '%d' WHERE UserID = '%d' AND ItemID = '%d'",
-					m_Value, m_Settings, m_Enchant, m_Durability, GetPlayer()->Account()->GetID(), m_ID);
+				auto pUpdate = Database->Prepare(STMT_ITEM_UPDATE, "UPDATE tw_accounts_items SET Value = ?, Settings = ?, Enchant = ?, Durability = ? WHERE UserID = ? AND ItemID = ?");
+				pUpdate->Bind(m_Value).Bind(m_Settings).Bind(m_Enchant).Bind(m_Durability).Bind(UserID).Bind(m_ID).Execute();
 				return;
 			}
 
@@ -327,7 +333,8 @@ bool CPlayerItem::Save()
 			if(m_Value)
 			{
 				m_Durability = 100;
-				Database->Execute<DB::INSERT>("tw_accounts_items", "(ItemID, UserID, Value, Settings, Enchant) VALUES ('%d', '%d', '%d', '%d', '%d')", m_ID, UserID, m_Value, m_Settings, m_Enchant);
+				auto pInsert = Database->Prepare(STMT_ITEM_INSERT, "INSERT INTO tw_accounts_items (ItemID, UserID, Value, Settings, Enchant) VALUES (?, ?, ?, ?, ?)");
+				pInsert->Bind(m_ID).Bind(UserID).Bind(m_Value).Bind(m_Settings).Bind(m_Enchant).Execute();
 			}
 		});
 		return true;
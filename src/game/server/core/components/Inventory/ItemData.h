@@ -5,6 +5,8 @@
 
 #include "ItemInfoData.h"
 
+#include <game/server/core/tools/inventory_index.h>
+
 class CItem;
 using CItemsContainer = std::deque<CItem>;
 
@@ -52,9 +54,14 @@ class CPlayerItem : public CItem, public MultiworldIdentifiableStaticData< std::
 {
 	friend class CInventoryManager;
 	int m_ClientID {};
+	static inline std::map < int, CInventoryIndex > ms_Index {};
 
 	class CGS* GS() const;
 	class CPlayer* GetPlayer() const;
+	void UpdateIndex() const
+	{
+		ms_Index[m_ClientID].Set(m_ID, (int)Info()->GetType(), (int)Info()->GetFunctional(), HasItem(), IsEquipped());
+	}
 
 public:
 	CPlayerItem() = default;
@@ -68,7 +75,12 @@ public:
 		m_Durability = Durability;
 		m_Settings = Settings;
 		CPlayerItem::m_pData[m_ClientID][m_ID] = *this;
+		UpdateIndex();
 	}
+
+	// held and equipped items of a player by type and slot
+	static const CInventoryIndex& Index(int ClientID) { return ms_Index[ClientID]; }
+	static void ResetIndex(int ClientID) { ms_Index.erase(ClientID); }
 	
 	// getters
 	int GetEnchantStats(AttributeIdentifier ID) const { return Info()->GetInfoEnchantStats(ID, m_Enchant); }
@@ -33,10 +33,8 @@ bool CRandomBox::Start(CPlayer* pPlayer, int Seconds, CPlayerItem* pPlayerUsesIt
 		// Set the tick when the last random box will finish opening
 		pPlayer->m_aPlayerTick[LastRandomBox] = pPlayer->GS()->Server()->Tick() + Seconds;
 
-		// Sort the vector of random items by chance
 		// Create a new instance of the random box randomizer entity
-		std::sort(m_VectorItems.begin(), m_VectorItems.end(), [](const CRandomItem& pLeft, const CRandomItem& pRight) { return pLeft.m_Chance < pRight.m_Chance; });
-		new CEntityRandomBoxRandomizer(&pPlayer->GS()->m_World, pPlayer, pPlayer->Account()->GetID(), Seconds, std::move(m_VectorItems), pPlayerUsesItem, UseValue);
+		new CEntityRandomBoxRandomizer(&pPlayer->GS()->m_World, pPlayer, pPlayer->Account()->GetID(), Seconds, *this, pPlayerUsesItem, UseValue);
 	}
 
 	return true;
@@ -3,6 +3,11 @@
 #ifndef GAME_SERVER_INVENTORY_RANDOM_BOX_H
 #define GAME_SERVER_INVENTORY_RANDOM_BOX_H
 
+#include <game/server/core/tools/alias_table.h>
+
+#include <algorithm>
+#include <vector>
+
 class CPlayerItem;
 class CPlayer;
 
@@ -27,6 +32,15 @@ public:
 class CRandomBox
 {
 	std::vector <CRandomItem> m_VectorItems {}; // Create an empty vector to store CRandomItem objects
+	CAliasTable m_Table {}; // Weighted by the chances, rebuilt when items are added
+
+	void BuildTable()
+	{
+		std::vector<float> vWeights;
+		for(const auto& Item : m_VectorItems)
+			vWeights.push_back(Item.m_Chance);
+		m_Table.Build(vWeights);
+	}
 
 public:
 	// Default constructor for CRandomBox
@@ -36,6 +50,7 @@ public:
 	CRandomBox(const std::initializer_list<CRandomItem>& pList)
 	{
 		m_VectorItems.insert(m_VectorItems.end(), pList.begin(), pList.end());
+		BuildTable();
 	}
 
 	// Add a new CRandomItem object to the vector using perfect forwarding
@@ -43,6 +58,7 @@ public:
 	void Add(Args&& ... args)
 	{
 		m_VectorItems.emplace_back(std::forward<Args>(args)...); 
+		BuildTable();
 	}
 
 	// Check if the vector is empty
@@ -51,6 +67,48 @@ public:
 		return m_VectorItems.empty();
 	}
 
+	// Draw one item, the chances are relative weights
+	template < typename F >
+	const CRandomItem& Draw(F&& Random) const
+	{
+		return m_Table.IsEmpty() ? m_VectorItems.back() : m_VectorItems[m_Table.Draw(Random)];
+	}
+	const CRandomItem& Draw() const { return Draw([]() { return random_float(); }); }
+
+	// Draw Count items at once, merged into one entry per item id with the values summed
+	// and the number of draws that gave it, so every item is granted and saved once
+	struct CReceivedItem
+	{
+		CRandomItem m_Item;
+		int m_Coincidences;
+	};
+	template < typename F >
+	std::vector<CReceivedItem> Roll(int Count, F&& Random) const
+	{
+		std::vector<int> vDraws(m_VectorItems.size(), 0);
+		for(int i = 0; i < Count; i++)
+			vDraws[m_Table.IsEmpty() ? m_VectorItems.size() - 1 : m_Table.Draw(Random)]++;
+
+		std::vector<CReceivedItem> vReceived;
+		for(size_t i = 0; i < m_VectorItems.size(); i++)
+		{
+			if(!vDraws[i])
+				continue;
+
+			const CRandomItem& Item = m_VectorItems[i];
+			auto Iter = std::find_if(vReceived.begin(), vReceived.end(), [&Item](const CReceivedItem& Received) { return Received.m_Item.m_ItemID == Item.m_ItemID; });
+			if(Iter == vReceived.end())
+				vReceived.push_back({ CRandomItem(Item.m_ItemID, Item.m_Value * vDraws[i], Item.m_Chance), vDraws[i] });
+			else
+			{
+				Iter->m_Item.m_Value += Item.m_Value * vDraws[i];
+				Iter->m_Coincidences += vDraws[i];
+			}
+		}
+		return vReceived;
+	}
+	std::vector<CReceivedItem> Roll(int Count) const { return Roll(Count, []() { return random_float(); }); }
+
 	// Start the random box process with given parameters
 	bool Start(CPlayer* pPlayer, int Seconds, CPlayerItem* pPlayerUsesItem = nullptr, int UseValue = 1);
 };
@@ -5,7 +5,7 @@
 
 #include <game/server/gamecontext.h>
 
-CEntityRandomBoxRandomizer::CEntityRandomBoxRandomizer(CGameWorld* pGameWorld, CPlayer* pPlayer, int PlayerAccountID, int LifeTime, const std::vector<CRandomItem>& List, CPlayerItem* pPlayerUsesItem, int UseValue)
+CEntityRandomBoxRandomizer::CEntityRandomBoxRandomizer(CGameWorld* pGameWorld, CPlayer* pPlayer, int PlayerAccountID, int LifeTime, const CRandomBox& RandomBox, CPlayerItem* pPlayerUsesItem, int UseValue)
 	: CEntity(pGameWorld, CGameWorld::ENTTYPE_RANDOM_BOX, pPlayer->m_ViewPos)
 {
 	m_Used = UseValue;
@@ -13,39 +13,24 @@ CEntityRandomBoxRandomizer::CEntityRandomBoxRandomizer(CGameWorld* pGameWorld, C
 	m_pPlayer = pPlayer;
 	m_AccountID = PlayerAccountID;
 	m_pPlayerUsesItem = pPlayerUsesItem;
-	m_aRandomItems = List;
+	m_RandomBox = RandomBox;
 
 	GameWorld()->InsertEntity(this);
 }
 
-// This function selects a random item from the "m_aRandomItems" vector of CRandomItem objects
-std::vector<CRandomItem>::iterator CEntityRandomBoxRandomizer::SelectRandomItem()
-{
-	// Find the first item in the vector that meets the criteria specified by the lambda function
-	const auto iter = std::find_if(m_aRandomItems.begin(), m_aRandomItems.end(), [](const CRandomItem& pItem)
-	{
-		const float RandomDrop = random_float(100.0f);
-		return RandomDrop < pItem.m_Chance;
-	});
-
-	// If any item was found, return the iterator pointing to it
-	// Otherwise, return an iterator pointing to the last item in the vector
-	return iter != m_aRandomItems.end() ? iter : std::prev(m_aRandomItems.end());
-}
-
 void CEntityRandomBoxRandomizer::Tick()
 {
 	// Check if m_LifeTime is zero or a multiple of the server tick speed
 	if(!m_LifeTime || m_LifeTime % Server()->TickSpeed() == 0)
 	{
-		// Select a random item
-		auto IterRandomElement = SelectRandomItem();
+		// Select a random item to show
+		const CRandomItem& ShownItem = m_RandomBox.Draw();
 
 		// Check if the player exists and if the player's character exists
 		if(m_pPlayer && m_pPlayer->GetCharacter())
 		{
 			const vec2 PlayerPos = m_pPlayer->GetCharacter()->m_Core.m_Pos;
-			GS()->CreateText(nullptr, false, vec2(PlayerPos.x, PlayerPos.y - 80), vec2(0, -0.3f), 15, GS()->GetItemInfo(IterRandomElement->m_ItemID)->GetName());
+			GS()->CreateText(nullptr, false, vec2(PlayerPos.x, PlayerPos.y - 80), vec2(0, -0.3f), 15, GS()->GetItemInfo(ShownItem.m_ItemID)->GetName());
 		}
 
 		if(!m_LifeTime)
@@ -88,38 +73,8 @@ void CEntityRandomBoxRandomizer::Tick()
 				}
 			};
 
-			// get list received items
-			struct ReceivedItem { CRandomItem RandomItem; int Coincidences; };
-			std::list<ReceivedItem> aReceivedItems;
-
-			// Define a lambda function called "findMatchingItem"
-			auto findMatchingItem = [&IterRandomElement](const ReceivedItem& pItem)
-			{
-				return pItem.RandomItem.m_ItemID == IterRandomElement->m_ItemID;
-			};
-
-			// Iterate "m_Used" number of times
-			for(int i = 0; i < m_Used; i++)
-			{
-				// Find the first element in the vector "aReceivedItems" that satisfies the condition specified by the lambda function "findMatchingItem"
-				auto iter = std::find_if(aReceivedItems.begin(), aReceivedItems.end(), findMatchingItem);
-
-				// If an element was found
-				if(iter != aReceivedItems.end())
-				{
-					// Increment the values of the element's RandomItem member
-					iter->RandomItem.m_Value += IterRandomElement->m_Value;
-					iter->Coincidences++;
-				}
-				else
-				{
-					// If no element was found, add a new element
-					aReceivedItems.push_back({ *IterRandomElement, 1 });
-				}
-
-				// Assign a new random item to IterRandomElement
-				IterRandomElement = SelectRandomItem();
-			}
+			// Draw all boxes at once, one entry per item id, so every item is granted and saved once
+			const auto vReceivedItems = m_RandomBox.Roll(m_Used);
 
 			// Check if the player exists
 			if(m_pPlayer)
@@ -130,19 +85,19 @@ void CEntityRandomBoxRandomizer::Tick()
 				GS()->Chat(-1, "{STR} uses '{STR}x{VAL}' and got:", pClientName, m_pPlayerUsesItem->Info()->GetName(), m_Used);
 
 				// Iterate through all the received items / information
-				for(auto& pItem : aReceivedItems)
+				for(const auto& Received : vReceivedItems)
 				{
-					CPlayerItem* pPlayerItem = m_pPlayer->GetItem(pItem.RandomItem.m_ItemID);
-					GiveRandomItem(pItem.RandomItem);
-					GS()->Chat(-1, "* {STR}x{VAL} - ({INT})", pPlayerItem->Info()->GetName(), pItem.RandomItem.m_Value, pItem.Coincidences);
+					CPlayerItem* pPlayerItem = m_pPlayer->GetItem(Received.m_Item.m_ItemID);
+					GiveRandomItem(Received.m_Item);
+					GS()->Chat(-1, "* {STR}x{VAL} - ({INT})", pPlayerItem->Info()->GetName(), Received.m_Item.m_Value, Received.m_Coincidences);
 				}
 				GS()->Chat(-1, "---------------------------------");
 			}
 			else
 			{
 				// Give the random items to the player offline
-				for(auto& pItem : aReceivedItems)
-					GiveRandomItem(pItem.RandomItem);
+				for(const auto& Received : vReceivedItems)
+					GiveRandomItem(Received.m_Item);
 			}
 
 			// Destroy the current entity
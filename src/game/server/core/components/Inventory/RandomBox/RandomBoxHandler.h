@@ -14,17 +14,14 @@ class CEntityRandomBoxRandomizer : public CEntity
 	int m_AccountID;
 	CPlayer* m_pPlayer;
 	CPlayerItem* m_pPlayerUsesItem;
-	std::vector<CRandomItem> m_aRandomItems;
+	CRandomBox m_RandomBox;
 
 public:
 	// CEntityRandomBoxRandomizer is a class that represents a random box randomizer entity in the game world
 	// It takes a pointer to the game world and a pointer to the player that activated the random box
 	// It also takes the player's account ID, the lifetime of the random box, a list of random items that can be obtained from the random box,
 	// a pointer to the player's current item and the value used for item usage
-	CEntityRandomBoxRandomizer(CGameWorld* pGameWorld, CPlayer* pPlayer, int PlayerAccountID, int LifeTime, const std::vector<CRandomItem>& List, CPlayerItem* pPlayerUsesItem, int UseValue);
-
-	// Selects a random item from the list of available random items
-	std::vector<CRandomItem>::iterator SelectRandomItem();
+	CEntityRandomBoxRandomizer(CGameWorld* pGameWorld, CPlayer* pPlayer, int PlayerAccountID, int LifeTime, const CRandomBox& RandomBox, CPlayerItem* pPlayerUsesItem, int UseValue);
 
 	// Updates the state of the random box randomizer entity tick
 	void Tick() override;
@@ -43,8 +43,13 @@ bool CMailboxManager::OnHandleMenulist(CPlayer* pPlayer, int Menulist)
 // check whether messages are available
 int CMailboxManager::GetLettersCount(int AccountID)
 {
-	ResultPtr pRes = Database->Execute<DB::SELECT>("ID", "tw_accounts_mailbox", "WHERE UserID = '%d'", AccountID);
-	const int MailValue = pRes->rowsCount();
+	int MailValue = 0;
+	auto pCount = Database->Prepare(STMT_MAIL_COUNT, "SELECT COUNT(*) AS Letters FROM tw_accounts_mailbox WHERE UserID = ?");
+	pCount->Bind(AccountID).ExecuteSelect([&MailValue](ResultPtr pRes)
+	{
+		if(pRes->next())
+			MailValue = pRes->getInt("Letters");
+	});
 	return MailValue;
 }
 
@@ -112,12 +117,13 @@ void CMailboxManager::SendInbox(const char* pFrom, int AccountID, const char* pN
 	CItem AttachedItem(ItemID, Value, Enchant);
 	if(AttachedItem.IsValid())
 	{
-		Database->Execute<DB::INSERT>("tw_accounts_mailbox", "(Name, Description, ItemID, ItemValue, Enchant, UserID, FromSend) VALUES ('%s', '%s', '%d', '%d', '%d', '%d', '%s');",
-			cName.cstr(), cDesc.cstr(), AttachedItem.GetID(), AttachedItem.GetValue(), AttachedItem.GetEnchant(), AccountID, cFrom.cstr());
+		auto pInsert = Database->Prepare(STMT_MAIL_INSERT_ITEM, "INSERT INTO tw_accounts_mailbox (Name, Description, ItemID, ItemValue, Enchant, UserID, FromSend) VALUES (?, ?, ?, ?, ?, ?, ?)");
+		pInsert->Bind(cName.str()).Bind(cDesc.str()).Bind(AttachedItem.GetID()).Bind(AttachedItem.GetValue()).Bind(AttachedItem.GetEnchant()).Bind(AccountID).Bind(cFrom.str()).Execute();
 	}
 	else
 	{
-		Database->Execute<DB::INSERT>("tw_accounts_mailbox", "(Name, Description, UserID, FromSend) VALUES ('%s', '%s', '%d', '%s');", cName.cstr(), cDesc.cstr(), AccountID, cFrom.cstr());
+		auto pInsert = Database->Prepare(STMT_MAIL_INSERT, "INSERT INTO tw_accounts_mailbox (Name, Description, UserID, FromSend) VALUES (?, ?, ?, ?)");
+		pInsert->Bind(cName.str()).Bind(cDesc.str()).Bind(AccountID).Bind(cFrom.str()).Execute();
 	}
 }
 
@@ -170,5 +176,6 @@ void CMailboxManager::AcceptLetter(CPlayer* pPlayer, int LetterID)
 
 void CMailboxManager::DeleteLetter(int LetterID)
 {
-	Database->Execute<DB::REMOVE>("tw_accounts_mailbox", "WHERE ID = '%d'", LetterID);
+	auto pRemove = Database->Prepare(STMT_MAIL_REMOVE, "DELETE FROM tw_accounts_mailbox WHERE ID = ?");
+	pRemove->Bind(LetterID).Execute();
 }
\ No newline at end of file
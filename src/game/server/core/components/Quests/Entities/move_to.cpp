@@ -22,12 +22,8 @@ CEntityQuestAction::CEntityQuestAction(CGameWorld* pGameWorld, const QuestBotInf
 	m_pDefeatMobPlayer = pDefeatMobPlayer;
 	GameWorld()->InsertEntity(this);
 
-	// Set the size of the container m_IDs to hold s_Particles number of elements
-	m_IDs.set_size(s_Particles);
-
-	// Iterate over each element in m_IDs container
-	for(int i = 0; i < m_IDs.size(); i++)
-		m_IDs[i] = Server()->SnapNewID();
+	// Reserve one block of snap IDs for all particles
+	m_IDBlock = Server()->SnapNewIDBlock(s_Particles);
 }
 
 CEntityQuestAction::~CEntityQuestAction()
@@ -47,17 +43,8 @@ CEntityQuestAction::~CEntityQuestAction()
 	// Check if m_pDefeatMobPlayer exists
 	if(m_pDefeatMobPlayer)
 	{
-		// Disable the quest progress for the current client
-		m_pDefeatMobPlayer->GetQuestBotMobInfo().m_ActiveForClient[m_ClientID] = false;
-		m_pDefeatMobPlayer->GetQuestBotMobInfo().m_CompleteClient[m_ClientID] = false;
-
-		// Flag to check if m_pDefeatMobPlayer should be cleared
-		bool ClearDefeatMobPlayer = true;
-		for(int i = 0; i < MAX_PLAYERS; i++)
-		{
-			if(m_pDefeatMobPlayer->GetQuestBotMobInfo().m_ActiveForClient[i] && !m_pDefeatMobPlayer->GetQuestBotMobInfo().m_CompleteClient[m_ClientID])
-				ClearDefeatMobPlayer = false;
-		}
+		// Disable the quest progress for the current client, the mob is cleared once no client is left on it
+		const bool ClearDefeatMobPlayer = m_pDefeatMobPlayer->QuestMobInterest().Finish(m_pDefeatMobPlayer->GetCID(), m_ClientID);
 
 		// Clear m_pDefeatMobPlayer if ClearDefeatMobPlayer is true
 		if(ClearDefeatMobPlayer)
@@ -69,9 +56,8 @@ CEntityQuestAction::~CEntityQuestAction()
 		}
 	}
 
-	// Iterate through each element in the m_IDs
-	for(int i = 0; i < m_IDs.size(); i++)
-		Server()->SnapFreeID(m_IDs[i]);
+	// Release the block of particles
+	Server()->SnapFreeIDBlock(m_IDBlock);
 }
 
 bool CEntityQuestAction::PressedFire() const
@@ -180,7 +166,7 @@ void CEntityQuestAction::Tick()
 		Handler([this]
 		{
 			// Complete the task by defeating a mob
-			return m_pDefeatMobPlayer && m_pDefeatMobPlayer->GetQuestBotMobInfo().m_CompleteClient[m_ClientID];
+			return m_pDefeatMobPlayer && m_pDefeatMobPlayer->IsQuestMobCompleteFor(m_ClientID);
 		});
 	}
 	// Check if the Type includes the MOVE_ONLY flag
@@ -265,12 +251,12 @@ void CEntityQuestAction::HandleBroadcastInformation() const
 
 void CEntityQuestAction::Snap(int SnappingClient)
 {
-	if(m_ClientID != SnappingClient)
+	if(m_ClientID != SnappingClient || m_IDBlock < 0)
 		return;
 
-	for(int i = 0; i < m_IDs.size(); i++)
+	for(int i = 0; i < (int)s_Particles; i++)
 	{
-		CNetObj_Projectile* pObj = static_cast<CNetObj_Projectile*>(Server()->SnapNewItem(NETOBJTYPE_PROJECTILE, m_IDs[i], sizeof(CNetObj_Projectile)));
+		CNetObj_Projectile* pObj = static_cast<CNetObj_Projectile*>(Server()->SnapNewItem(NETOBJTYPE_PROJECTILE, m_IDBlock + i, sizeof(CNetObj_Projectile)));
 		if(!pObj)
 			return;
 
@@ -14,7 +14,7 @@ class CEntityQuestAction : public CEntity
 	bool* m_pComplete;
 	bool m_AutoCompletesQuestStep;
 	float m_Radius;
-	array < int > m_IDs;
+	int m_IDBlock;
 	const QuestBotInfo::TaskAction* m_pTaskMoveTo;
 
 public:
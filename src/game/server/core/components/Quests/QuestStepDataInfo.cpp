@@ -340,17 +340,10 @@ void CQuestStep::UpdateTaskMoveTo()
 			CPlayerBot* pPlayerBot = nullptr;
 			if(pRequired.IsHasDefeatMob())
 			{
-				for(int c = MAX_PLAYERS; c < MAX_CLIENTS; c++)
-				{
-					CPlayerBot* pPlBotSearch = dynamic_cast<CPlayerBot*>(GS()->m_apPlayers[c]);
-					if(pPlBotSearch && pPlBotSearch->GetQuestBotMobInfo().m_QuestID == pQuest->GetID() &&
-						pPlBotSearch->GetQuestBotMobInfo().m_QuestStep == m_Bot.m_StepPos &&
-						pPlBotSearch->GetQuestBotMobInfo().m_MoveToStep == i)
-					{
-						pPlayerBot = pPlBotSearch;
-						break;
-					}
-				}
+				// The mob spawned for this task, if there is one in the world
+				const int MobClientID = CPlayerBot::ms_aQuestMobInterest[GS()->GetWorldID()].FindMob(pQuest->GetID(), m_Bot.m_StepPos, i);
+				if(MobClientID >= MAX_PLAYERS && MobClientID < MAX_CLIENTS)
+					pPlayerBot = dynamic_cast<CPlayerBot*>(GS()->m_apPlayers[MobClientID]);
 
 				if(!pPlayerBot)
 				{
@@ -370,8 +363,7 @@ void CQuestStep::UpdateTaskMoveTo()
 					dbg_msg(PRINT_QUEST_PREFIX, "Creating a quest mob");
 				}
 
-				pPlayerBot->GetQuestBotMobInfo().m_ActiveForClient[pPlayer->GetCID()] = true;
-				pPlayerBot->GetQuestBotMobInfo().m_CompleteClient[pPlayer->GetCID()] = false;
+				pPlayerBot->QuestMobInterest().Accept(pPlayerBot->GetCID(), pPlayer->GetCID());
 			}
 
 			// Check if there is a move-to entity at the required position
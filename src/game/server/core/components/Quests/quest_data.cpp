@@ -33,7 +33,8 @@ bool CPlayerQuest::Accept()
 	m_State = QuestState::ACCEPT;
 	m_Step = 1;
 	m_Datafile.Create();
-	Database->Execute<DB::INSERT>("tw_accounts_quests", "(QuestID, UserID, Type) VALUES ('%d', '%d', '%d')", m_ID, GetPlayer()->Account()->GetID(), m_State);
+	auto pInsert = Database->Prepare(STMT_QUEST_INSERT, "INSERT INTO tw_accounts_quests (QuestID, UserID, Type) VALUES (?, ?, ?)");
+	pInsert->Bind(m_ID).Bind(GetPlayer()->Account()->GetID()).Bind((int)m_State).Execute();
 
 	// Send quest information to the player
 	int ClientID = GetPlayer()->GetCID();
@@ -63,7 +64,8 @@ void CPlayerQuest::Refuse()
 	if(m_State != QuestState::ACCEPT || !pPlayer)
 		return;
 
-	Database->Execute<DB::REMOVE>("tw_accounts_quests", "WHERE QuestID = '%d' AND UserID = '%d'", m_ID, GetPlayer()->Account()->GetID());
+	auto pRemove = Database->Prepare(STMT_QUEST_REMOVE, "DELETE FROM tw_accounts_quests WHERE QuestID = ? AND UserID = ?");
+	pRemove->Bind(m_ID).Bind(GetPlayer()->Account()->GetID()).Execute();
 	Reset();
 }
 
@@ -94,7 +96,8 @@ void CPlayerQuest::UpdateStepPosition()
 
 	// Finish quest because there are no next steps
 	m_State = QuestState::FINISHED;
-	Database->Execute<DB::UPDATE>("tw_accounts_quests", "Type = '%d' WHERE QuestID = '%d' AND UserID = '%d'", m_State, m_ID, pPlayer->Account()->GetID());
+	auto pUpdate = Database->Prepare(STMT_QUEST_UPDATE_STATE, "UPDATE tw_accounts_quests SET Type = ? WHERE QuestID = ? AND UserID = ?");
+	pUpdate->Bind((int)m_State).Bind(m_ID).Bind(pPlayer->Account()->GetID()).Execute();
 	m_Datafile.Delete();
 
 	// Add the reward gold to the player's money and experience
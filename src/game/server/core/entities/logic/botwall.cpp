@@ -11,51 +11,53 @@ CBotWall::CBotWall(CGameWorld* pGameWorld, vec2 Pos, vec2 Direction, int Flag)
 	GS()->Collision()->Wallline(32, Direction, &m_Pos, &m_PosTo);
 	m_Active = false;
 	m_Flag = Flag;
+	m_BlockerID = GameWorld()->DoorBlockers()->AddSegment(m_Pos, m_PosTo);
 
 	GameWorld()->InsertEntity(this);
 }
 
-void CBotWall::HitCharacter(CCharacter* pChar)
+CBotWall::~CBotWall()
 {
-	vec2 IntersectPos;
-	if(closest_point_on_line(m_Pos, m_PosTo, pChar->m_Core.m_Pos, IntersectPos))
-	{
-		const float Distance = distance(IntersectPos, pChar->m_Core.m_Pos);
-		if(Distance <= g_Config.m_SvDoorRadiusHit * 3)
-		{
-			if(Distance <= g_Config.m_SvDoorRadiusHit)
-				pChar->m_DoorHit = true;
-			m_Active = true;
-		}
-	}
+	GameWorld()->DoorBlockers()->RemoveSegment(m_BlockerID);
+}
+
+void CBotWall::HitCharacter(CCharacter* pChar, float Distance)
+{
+	if(Distance <= g_Config.m_SvDoorRadiusHit)
+		pChar->m_DoorHit = true;
+	m_Active = true;
 }
 
 void CBotWall::Tick()
 {
 	m_Active = false;
 
-	for(CCharacter* pChar = (CCharacter*)GameWorld()->FindFirst(CGameWorld::ENTTYPE_CHARACTER); pChar; pChar = (CCharacter*)pChar->TypeNext())
+	// the wall shows up for bots within three door radii
+	CGameWorld::CDoorHit aHits[MAX_CLIENTS];
+	const int NumHits = GameWorld()->FindDoorHits(m_BlockerID, (float)(g_Config.m_SvDoorRadiusHit * 3), aHits);
+	for(int i = 0; i < NumHits; i++)
 	{
+		CCharacter* pChar = aHits[i].m_pChar;
 		if(!pChar->GetPlayer()->IsBot())
 			continue;
 
 		int BotType = pChar->GetPlayer()->GetBotType();
 		if((m_Flag & Flags::WALLLINEFLAG_MOB_BOT) && (BotType == BotsTypes::TYPE_BOT_MOB))
 		{
-			HitCharacter(pChar);
+			HitCharacter(pChar, aHits[i].m_Distance);
 			continue;
 		}
 
 		int MobID = pChar->GetPlayer()->GetBotMobID();
 		if((m_Flag & Flags::WALLLINEFLAG_NPC_BOT) && (BotType == BotsTypes::TYPE_BOT_NPC) && (NpcBotInfo::ms_aNpcBot[MobID].m_Function != FUNCTION_NPC_GUARDIAN))
 		{
-			HitCharacter(pChar);
+			HitCharacter(pChar, aHits[i].m_Distance);
 			continue;
 		}
 
 		if((m_Flag & Flags::WALLLINEFLAG_QUEST_BOT) && (BotType == BotsTypes::TYPE_BOT_QUEST))
 		{
-			HitCharacter(pChar);
+			HitCharacter(pChar, aHits[i].m_Distance);
 			continue;
 		}
 	}
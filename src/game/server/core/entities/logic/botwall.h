@@ -18,7 +18,8 @@ public:
 	};
 
 	CBotWall(CGameWorld *pGameWorld, vec2 Pos, vec2 Direction, int Flag);
-	void HitCharacter(CCharacter* pChar);
+	~CBotWall() override;
+	void HitCharacter(CCharacter* pChar, float Distance);
 
 	void Tick() override;
 	void Snap(int SnappingClient) override;
@@ -26,6 +27,7 @@ public:
 private:
 	int m_Flag;
 	bool m_Active;
+	int m_BlockerID;
 };
 
 #endif
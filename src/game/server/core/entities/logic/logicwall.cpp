@@ -132,10 +132,16 @@ CLogicWallWall::CLogicWallWall(CGameWorld *pGameWorld, vec2 Pos, int Mode, int H
 	vec2 Direction = Mode == 0 ? vec2(0, -1) : vec2(1, 0);
 	GS()->Collision()->Wallline(32, Direction, &m_Pos, &m_PosTo);
 	m_RespawnTick = Server()->TickSpeed()*10;
+	m_BlockerID = GameWorld()->DoorBlockers()->AddSegment(m_Pos, m_PosTo);
 
 	GameWorld()->InsertEntity(this);
 }
 
+CLogicWallWall::~CLogicWallWall()
+{
+	GameWorld()->DoorBlockers()->RemoveSegment(m_BlockerID);
+}
+
 void CLogicWallWall::TakeDamage()
 {
 	m_Health -= 25;
@@ -150,16 +156,10 @@ void CLogicWallWall::Tick()
 
 	if(!m_RespawnTick)
 	{
-		for (CCharacter* pChar = (CCharacter*)GameWorld()->FindFirst(CGameWorld::ENTTYPE_CHARACTER); pChar; pChar = (CCharacter*)pChar->TypeNext())
-		{
-			vec2 IntersectPos;
-			if(closest_point_on_line(m_Pos, m_PosTo, pChar->m_Core.m_Pos, IntersectPos))
-			{
-				float Distance = distance(IntersectPos, pChar->m_Core.m_Pos);
-				if(Distance <= g_Config.m_SvDoorRadiusHit)
-					pChar->m_DoorHit = true;
-			}
-		}
+		CGameWorld::CDoorHit aHits[MAX_CLIENTS];
+		const int NumHits = GameWorld()->FindDoorHits(m_BlockerID, (float)g_Config.m_SvDoorRadiusHit, aHits);
+		for(int i = 0; i < NumHits; i++)
+			aHits[i].m_pChar->m_DoorHit = true;
 	}
 }
 
@@ -240,28 +240,29 @@ CLogicDoorKey::CLogicDoorKey(CGameWorld *pGameWorld, vec2 Pos, int ItemID, int M
 	vec2 Direction = Mode == 0 ? vec2(0, -1) : vec2(1, 0);
 	GS()->Collision()->Wallline(32, Direction, &m_Pos, &m_PosTo);
 	m_ItemID = ItemID;
+	m_BlockerID = GameWorld()->DoorBlockers()->AddSegment(m_Pos, m_PosTo);
 
 	GameWorld()->InsertEntity(this);
 }
 
+CLogicDoorKey::~CLogicDoorKey()
+{
+	GameWorld()->DoorBlockers()->RemoveSegment(m_BlockerID);
+}
+
 void CLogicDoorKey::Tick()
 {
-	for (CCharacter* pChar = (CCharacter*)GameWorld()->FindFirst(CGameWorld::ENTTYPE_CHARACTER); pChar; pChar = (CCharacter*)pChar->TypeNext())
+	CGameWorld::CDoorHit aHits[MAX_CLIENTS];
+	const int NumHits = GameWorld()->FindDoorHits(m_BlockerID, (float)g_Config.m_SvDoorRadiusHit, aHits);
+	for(int i = 0; i < NumHits; i++)
 	{
+		CCharacter* pChar = aHits[i].m_pChar;
 		CPlayer* pPlayer = pChar->GetPlayer();
 		if (pPlayer->GetItem(m_ItemID)->GetValue())
 			continue;
 
-		vec2 IntersectPos;
-		if(closest_point_on_line(m_Pos, m_PosTo, pChar->m_Core.m_Pos, IntersectPos))
-		{
-			float Distance = distance(IntersectPos, pChar->m_Core.m_Pos);
-			if(Distance <= g_Config.m_SvDoorRadiusHit)
-			{
-				pChar->m_DoorHit = true;
-				GS()->Broadcast(pChar->GetPlayer()->GetCID(), BroadcastPriority::GAME_WARNING, 100, "You need {STR}", GS()->GetItemInfo(m_ItemID)->GetName());
-			}
-		}
+		pChar->m_DoorHit = true;
+		GS()->Broadcast(pChar->GetPlayer()->GetCID(), BroadcastPriority::GAME_WARNING, 100, "You need {STR}", GS()->GetItemInfo(m_ItemID)->GetName());
 	}
 }
 
@@ -292,25 +293,25 @@ CLogicDungeonDoorKey::CLogicDungeonDoorKey(CGameWorld *pGameWorld, vec2 Pos, int
 	GS()->Collision()->Wallline(32, vec2(0, -1), &m_Pos, &m_PosTo);
 	m_OpenedDoor = false;
 	m_BotID = BotID;
+	m_BlockerID = GameWorld()->DoorBlockers()->AddSegment(m_Pos, m_PosTo);
 
 	GameWorld()->InsertEntity(this);
 }
 
+CLogicDungeonDoorKey::~CLogicDungeonDoorKey()
+{
+	GameWorld()->DoorBlockers()->RemoveSegment(m_BlockerID);
+}
+
 void CLogicDungeonDoorKey::Tick()
 {
 	if (m_OpenedDoor)
 		return;
 
-	for (CCharacter* pChar = (CCharacter*)GameWorld()->FindFirst(CGameWorld::ENTTYPE_CHARACTER); pChar; pChar = (CCharacter*)pChar->TypeNext())
-	{
-		vec2 IntersectPos;
-		if(closest_point_on_line(m_Pos, m_PosTo, pChar->m_Core.m_Pos, IntersectPos))
-		{
-			float Distance = distance(IntersectPos, pChar->m_Core.m_Pos);
-			if(Distance <= 64.0f)
-				pChar->m_DoorHit = true;
-		}
-	}
+	CGameWorld::CDoorHit aHits[MAX_CLIENTS];
+	const int NumHits = GameWorld()->FindDoorHits(m_BlockerID, 64.0f, aHits);
+	for(int i = 0; i < NumHits; i++)
+		aHits[i].m_pChar->m_DoorHit = true;
 }
 
 bool CLogicDungeonDoorKey::SyncStateChanges()
@@ -48,9 +48,11 @@ class CLogicWallWall : public CEntity
 	int m_Health;
 	int m_SaveHealth;
 	int m_RespawnTick;
+	int m_BlockerID;
 
 public:
 	CLogicWallWall(CGameWorld *pGameWorld, vec2 Pos, int Mode, int Health);
+	~CLogicWallWall() override;
 	virtual void Snap(int SnappingClient);
 	virtual void Tick();
 
@@ -63,9 +65,11 @@ public:
 class CLogicDoorKey : public CEntity
 {
 	int m_ItemID;
+	int m_BlockerID;
 
 public:
 	CLogicDoorKey(CGameWorld *pGameWorld, vec2 Pos, int ItemID, int Mode);
+	~CLogicDoorKey() override;
 	virtual void Snap(int SnappingClient);
 	virtual void Tick();
 
@@ -75,9 +79,11 @@ class CLogicDungeonDoorKey : public CEntity
 {
 	int m_BotID;
 	bool m_OpenedDoor;
+	int m_BlockerID;
 
 public:
 	CLogicDungeonDoorKey(CGameWorld *pGameWorld, vec2 Pos, int BotID);
+	~CLogicDungeonDoorKey() override;
 	virtual void Snap(int SnappingClient);
 	virtual void Tick();
 
@@ -15,9 +15,8 @@ CLaserOrbite::CLaserOrbite(CGameWorld* pGameWorld, vec2 Position, int Amount, En
 	m_LaserType = LaserType;
 	GameWorld()->InsertEntity(this);
 
-	m_IDs.set_size(Amount);
-	for(int i = 0; i < m_IDs.size(); i++)
-		m_IDs[i] = Server()->SnapNewID();
+	m_Amount = Amount;
+	m_IDBlock = Server()->SnapNewIDBlock(Amount);
 }
 
 CLaserOrbite::CLaserOrbite(CGameWorld* pGameWorld, int ClientID, CEntity* pEntParent, int Amount, EntLaserOrbiteType Type, float Speed, float Radius, int LaserType, int64_t Mask)
@@ -37,16 +36,13 @@ CLaserOrbite::CLaserOrbite(CGameWorld* pGameWorld, int ClientID, CEntity* pEntPa
 	}
 	GameWorld()->InsertEntity(this);
 
-	m_IDs.set_size(Amount);
-	for(int i = 0; i < m_IDs.size(); i++)
-		m_IDs[i] = Server()->SnapNewID();
+	m_Amount = Amount;
+	m_IDBlock = Server()->SnapNewIDBlock(Amount);
 }
 
 CLaserOrbite::~CLaserOrbite()
 {
-	for(int i = 0; i < m_IDs.size(); i++)
-		Server()->SnapFreeID(m_IDs[i]);
-	m_IDs.clear();
+	Server()->SnapFreeIDBlock(m_IDBlock);
 }
 
 void CLaserOrbite::Tick()
@@ -74,7 +70,7 @@ void CLaserOrbite::Tick()
 vec2 CLaserOrbite::UtilityOrbitePos(int PosID) const
 {
 	float AngleStart = 2.0f * pi;
-	float AngleStep = 2.0f * pi / (float)m_IDs.size();
+	float AngleStep = 2.0f * pi / (float)m_Amount;
 	if(m_Type == EntLaserOrbiteType::MOVE_LEFT)
 		AngleStart = -(AngleStart * (float)Server()->Tick() / (float)Server()->TickSpeed()) * m_MoveSpeed;
 	else if(m_Type == EntLaserOrbiteType::MOVE_RIGHT)
@@ -87,17 +83,17 @@ vec2 CLaserOrbite::UtilityOrbitePos(int PosID) const
 
 void CLaserOrbite::Snap(int SnappingClient)
 {
-	if(NetworkClipped(SnappingClient, m_Pos, GetProximityRadius()) || !CmaskIsSet(m_Mask, SnappingClient))
+	if(m_IDBlock < 0 || NetworkClipped(SnappingClient, m_Pos, GetProximityRadius()) || !CmaskIsSet(m_Mask, SnappingClient))
 		return;
 
-	vec2 LastPosition = m_Pos + UtilityOrbitePos(m_IDs.size() - 1);
-	for(int i = 0; i < m_IDs.size(); i++)
+	vec2 LastPosition = m_Pos + UtilityOrbitePos(m_Amount - 1);
+	for(int i = 0; i < m_Amount; i++)
 	{
 		vec2 PosStart = m_Pos + UtilityOrbitePos(i);
 
 		if(GS()->GetClientVersion(SnappingClient) >= VERSION_DDNET_MULTI_LASER)
 		{
-			CNetObj_DDNetLaser* pObj = static_cast<CNetObj_DDNetLaser*>(Server()->SnapNewItem(NETOBJTYPE_DDNETLASER, m_IDs[i], sizeof(CNetObj_DDNetLaser)));
+			CNetObj_DDNetLaser* pObj = static_cast<CNetObj_DDNetLaser*>(Server()->SnapNewItem(NETOBJTYPE_DDNETLASER, m_IDBlock + i, sizeof(CNetObj_DDNetLaser)));
 			if(!pObj)
 				return;
 
@@ -111,7 +107,7 @@ void CLaserOrbite::Snap(int SnappingClient)
 		}
 		else
 		{
-			CNetObj_Laser* pObj = static_cast<CNetObj_Laser*>(Server()->SnapNewItem(NETOBJTYPE_LASER, m_IDs[i], sizeof(CNetObj_Laser)));
+			CNetObj_Laser* pObj = static_cast<CNetObj_Laser*>(Server()->SnapNewItem(NETOBJTYPE_LASER, m_IDBlock + i, sizeof(CNetObj_Laser)));
 			if(!pObj)
 				return;
 
@@ -21,7 +21,8 @@ public:
 	CEntity* GetEntityParent() const { return m_pEntParent; }
 
 private:
-	array<int> m_IDs;
+	int m_IDBlock {};
+	int m_Amount {};
 	EntLaserOrbiteType m_Type {};
 	int m_ClientID {};
 	int m_LaserType {};
@@ -3,51 +3,6 @@
 #include <engine/server.h>
 #include <engine/shared/config.h>
 
-CLolPlasma::CLolPlasma(CGameWorld* pGameWorld, CEntity* pParent, vec2 Pos, vec2 Vel, int Lifespan)
-	: CEntity(pGameWorld, CGameWorld::ENTTYPE_WORLD_TEXT, Pos)
-{
-	m_LocalPos = vec2(0.0f, 0.0f);
-	m_StartOff = Pos;
-	m_Pos = (pParent ? pParent->GetPos() : vec2(0.0f, 0.0f)) + m_StartOff;
-	m_Vel = Vel;
-	m_Life = Lifespan;
-	m_StartTick = Server()->Tick();
-	m_pParent = pParent;
-	GameWorld()->InsertEntity(this);
-}
-
-void CLolPlasma::Tick()
-{
-	m_Life--;
-	if(!m_Life)
-	{
-		GameWorld()->DestroyEntity(this);
-		return;
-	}
-
-	if(GameWorld()->ExistEntity(m_pParent))
-		m_Pos = m_pParent->GetPos();
-	else
-		m_Pos = vec2(0.0f, 0.0f) + m_StartOff + (m_LocalPos += m_Vel);
-}
-
-void CLolPlasma::Snap(int SnappingClient)
-{
-	if(NetworkClipped(SnappingClient))
-		return;
-
-	CNetObj_Projectile* pObj = static_cast<CNetObj_Projectile*>(Server()->SnapNewItem(NETOBJTYPE_PROJECTILE, GetID(), sizeof(CNetObj_Projectile)));
-	if(!pObj)
-		return;
-
-	pObj->m_X = (int)m_Pos.x;
-	pObj->m_Y = (int)m_Pos.y;
-	pObj->m_VelX = 0;
-	pObj->m_VelY = 0;
-	pObj->m_StartTick = Server()->Tick();
-	pObj->m_Type = WEAPON_HAMMER;
-}
-
 static bool s_aaaChars[256][5][3] = {
 	{ {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0} }, // ascii 0
 	{ {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0} }, // ascii 1
@@ -331,17 +286,38 @@ inline static vec2 TextSize(const char* pText)
 	return vec2(Count * g_Config.m_SvLoltextHspace * 4.0f, g_Config.m_SvLoltextVspace);
 }
 
-void CLoltext::Create(CGameWorld* pGameWorld, CEntity* pParent, vec2 Pos, vec2 Vel, int Lifespan, const char* pText, bool Center, bool Follow)
+CWorldText::CWorldText(CGameWorld* pGameWorld, CEntity* pParent, vec2 Pos, vec2 Vel, int Lifespan, const char* pText, bool Center)
+	: CEntity(pGameWorld, CGameWorld::ENTTYPE_WORLD_TEXT, Pos)
 {
-	vec2 CurPos = Pos;
-	if(Center)
-		CurPos -= TextSize(pText) * 0.5f;
+	m_LocalPos = vec2(0.0f, 0.0f);
+	m_StartOff = Pos;
+	m_Pos = (pParent ? pParent->GetPos() : vec2(0.0f, 0.0f)) + m_StartOff;
+	m_Vel = Vel;
+	m_Life = Lifespan;
+	m_pParent = pParent;
+	m_Center = Center;
+	SetText(pText);
+	GameWorld()->InsertEntity(this);
+}
 
-	if(pParent && !Follow)
-	{
-		CurPos += pParent->GetPos();
-		pParent = nullptr;
-	}
+CWorldText::~CWorldText()
+{
+	for(const int ID : m_vIDs)
+		Server()->SnapFreeID(ID);
+	m_vIDs.clear();
+}
+
+void CWorldText::SetText(const char* pText)
+{
+	if(m_Text == pText)
+		return;
+
+	m_Text = pText;
+	m_vPixels.clear();
+
+	vec2 CurPos = vec2(0.0f, 0.0f);
+	if(m_Center)
+		CurPos -= TextSize(pText) * 0.5f;
 
 	char c;
 	while((c = *pText++))
@@ -354,7 +330,51 @@ void CLoltext::Create(CGameWorld* pGameWorld, CEntity* pParent, vec2 Pos, vec2 V
 		for(int y = 0; y < 5/*XXX*/; ++y)
 			for(int x = 0; x < 3/*XXX*/; ++x)
 				if(s_aaaChars[(unsigned)c][y][x])
-					new CLolPlasma(pGameWorld, pParent, CurPos + vec2(x * g_Config.m_SvLoltextHspace, y * g_Config.m_SvLoltextVspace), Vel, Lifespan);
+					m_vPixels.emplace_back(CurPos.x + x * g_Config.m_SvLoltextHspace, CurPos.y + y * g_Config.m_SvLoltextVspace);
 		CurPos.x += 4 * g_Config.m_SvLoltextHspace;
 	}
-}
\ No newline at end of file
+	m_Width = TextSize(m_Text.c_str()).x;
+
+	// keep the snap ids of the old text, only take or give back the difference
+	while(m_vIDs.size() < m_vPixels.size())
+		m_vIDs.push_back(Server()->SnapNewID());
+	while(m_vIDs.size() > m_vPixels.size())
+	{
+		Server()->SnapFreeID(m_vIDs.back());
+		m_vIDs.pop_back();
+	}
+}
+
+void CWorldText::Tick()
+{
+	if(m_Life > 0 && !--m_Life)
+	{
+		GameWorld()->DestroyEntity(this);
+		return;
+	}
+
+	if(m_pParent && GameWorld()->ExistEntity(m_pParent))
+		m_Pos = m_pParent->GetPos() + m_StartOff;
+	else
+		m_Pos = m_StartOff + (m_LocalPos += m_Vel);
+}
+
+void CWorldText::Snap(int SnappingClient)
+{
+	if(m_vPixels.empty() || NetworkClipped(SnappingClient, m_Pos, m_Width))
+		return;
+
+	for(size_t i = 0; i < m_vPixels.size(); i++)
+	{
+		CNetObj_Projectile* pObj = static_cast<CNetObj_Projectile*>(Server()->SnapNewItem(NETOBJTYPE_PROJECTILE, m_vIDs[i], sizeof(CNetObj_Projectile)));
+		if(!pObj)
+			return;
+
+		pObj->m_X = (int)(m_Pos.x + m_vPixels[i].x);
+		pObj->m_Y = (int)(m_Pos.y + m_vPixels[i].y);
+		pObj->m_VelX = 0;
+		pObj->m_VelY = 0;
+		pObj->m_StartTick = Server()->Tick();
+		pObj->m_Type = WEAPON_HAMMER;
+	}
+}
@@ -2,27 +2,31 @@
 #define GAME_SERVER_ENTITIES_LOLTEXT_H
 #include <game/server/entity.h>
 
-class CLolPlasma : public CEntity
+// text drawn with projectiles, one entity for the whole string
+class CWorldText : public CEntity
 {
+	std::string m_Text;
+	std::vector<vec2> m_vPixels; // offsets from m_Pos of the lit glyph pixels
+	std::vector<int> m_vIDs; // one snap id per pixel
+	float m_Width {};
+	bool m_Center {};
+
 	vec2 m_LocalPos; // local coordinate system is origin'd wherever we actually start (i.e. this is (0,0) after creation)
 	vec2 m_Vel;
-	int m_Life; // remaining ticks
-	int m_StartTick; // tick created
+	int m_Life; // remaining ticks, lives forever if not positive
 	vec2 m_StartOff; // initial offset from parent, for proper following
 	CEntity* m_pParent;
 
 public:
-	CLolPlasma(CGameWorld* pGameWorld, CEntity* pParent, vec2 Pos, vec2 Vel, int Lifespan);
+	CWorldText(CGameWorld* pGameWorld, CEntity* pParent, vec2 Pos, vec2 Vel, int Lifespan, const char* pText, bool Center);
+	~CWorldText() override;
+
+	// rebuilds the pixels in place, keeping the snap ids
+	void SetText(const char* pText);
+	void SetLifespan(int Lifespan) { m_Life = Lifespan; }
 
 	void Tick() override;
 	void Snap(int SnappingClient) override;
 };
 
-class CLoltext
-{
-public:
-	void Create(CGameWorld *pGameWorld, CEntity *pParent, vec2 Pos, vec2 Vel, int Lifespan, const char *pText, bool Center, bool Follow);
-};
-
 #endif
-
@@ -13,10 +13,7 @@ CMultipleOrbite::CMultipleOrbite(CGameWorld* pGameWorld, CEntity* pParent)
 
 CMultipleOrbite::~CMultipleOrbite()
 {
-	for(const auto& pItems : m_Items)
-	{
-		Server()->SnapFreeID(pItems.m_ID);
-	}
+	Server()->SnapFreeIDBlock(m_IDBlock);
 	m_Items.clear();
 }
 
@@ -25,11 +22,11 @@ void CMultipleOrbite::Add(int Value, int Type, int Subtype)
 	for(int i = 0; i < Value; i++)
 	{
 		SnapItem Item;
-		Item.m_ID = Server()->SnapNewID();
 		Item.m_Type = Type;
 		Item.m_Subtype = Subtype;
 		m_Items.push_back(Item);
 	}
+	ReserveIDs();
 }
 
 void CMultipleOrbite::Remove(int Value, int Type, int Subtype)
@@ -39,7 +36,6 @@ void CMultipleOrbite::Remove(int Value, int Type, int Subtype)
 	{
 		if(it->m_Type == Type && it->m_Subtype == Subtype)
 		{
-			Server()->SnapFreeID(it->m_ID);
 			it = m_Items.erase(it);
 			Count++;
 		}
@@ -50,6 +46,20 @@ void CMultipleOrbite::Remove(int Value, int Type, int Subtype)
 	}
 }
 
+void CMultipleOrbite::ReserveIDs()
+{
+	// items snap with the ID of their position, the block only grows
+	if((int)m_Items.size() <= m_IDBlockSize)
+		return;
+
+	int Size = maximum(m_IDBlockSize, 4);
+	while(Size < (int)m_Items.size())
+		Size *= 2;
+	Server()->SnapFreeIDBlock(m_IDBlock);
+	m_IDBlock = Server()->SnapNewIDBlock(Size);
+	m_IDBlockSize = m_IDBlock >= 0 ? Size : 0;
+}
+
 void CMultipleOrbite::Tick()
 {
 	if(!GameWorld()->ExistEntity(m_pParent))
@@ -77,10 +87,13 @@ void CMultipleOrbite::Snap(int SnappingClient)
 		return;
 
 	int Pos = 0;
-	for(const auto& [ID, Type, Subtype] : m_Items)
+	for(const auto& [Type, Subtype] : m_Items)
 	{
+		if(Pos >= m_IDBlockSize)
+			break;
+
 		const vec2 PosStart = m_Pos + UtilityOrbitePos(Pos);
-		CNetObj_Pickup* pObj = static_cast<CNetObj_Pickup*>(Server()->SnapNewItem(NETOBJTYPE_PICKUP, ID, sizeof(CNetObj_Pickup)));
+		CNetObj_Pickup* pObj = static_cast<CNetObj_Pickup*>(Server()->SnapNewItem(NETOBJTYPE_PICKUP, m_IDBlock + Pos, sizeof(CNetObj_Pickup)));
 		if(!pObj)
 			continue;
 
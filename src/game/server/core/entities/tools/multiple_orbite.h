@@ -8,12 +8,13 @@ class CMultipleOrbite : public CEntity
 {
 	struct SnapItem
 	{
-		int m_ID;
 		int m_Type;
 		int m_Subtype;
 	};
 	std::list< SnapItem > m_Items{};
 	CEntity* m_pParent {};
+	int m_IDBlock { -1 };
+	int m_IDBlockSize {};
 
 public:
 	CMultipleOrbite(CGameWorld *pGameWorld, CEntity* pParent);
@@ -27,6 +28,7 @@ public:
 
 private:
 	vec2 UtilityOrbitePos(int PosID) const;
+	void ReserveIDs();
 
 };
 
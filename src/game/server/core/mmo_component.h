@@ -8,10 +8,21 @@
 using namespace sqlstr;
 class MmoComponent
 {
+public:
+	enum
+	{
+		PROFILE_TICK = 0,
+		PROFILE_MESSAGE,
+		PROFILE_TILE,
+		NUM_PROFILE_HOOKS,
+	};
+
 protected:
 	class CGS* m_GameServer;
 	class IServer* m_pServer;
 	class CMmoController* m_Core;
+	const char* m_pName {};
+	class CProfileEntry* m_apProfile[NUM_PROFILE_HOOKS] {};
 	friend CMmoController; // provide access for the controller
 
 	CGS* GS() const { return m_GameServer; }
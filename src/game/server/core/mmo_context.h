@@ -191,6 +191,33 @@ enum class QuestState : int
 	FINISHED,
 };
 
+// prepared statement ids, each one indexes the statement cache of a database connection
+enum PreparedStatementID
+{
+	STMT_ITEM_SELECT,
+	STMT_ITEM_INSERT,
+	STMT_ITEM_UPDATE,
+	STMT_ITEM_REMOVE,
+	STMT_ACCOUNT_SAVE_STATS,
+	STMT_ACCOUNT_SAVE_UPGRADES,
+	STMT_ACCOUNT_SAVE_SOCIAL_STATUS,
+	STMT_ACCOUNT_SAVE_POSITION,
+	STMT_ACCOUNT_SAVE_TIME_PERIODS,
+	STMT_ACCOUNT_SAVE_LANGUAGE,
+	STMT_ACCOUNT_SAVE_USERNAME,
+	STMT_ACCOUNT_SAVE_FARMING,
+	STMT_ACCOUNT_SAVE_MINING,
+	STMT_QUEST_INSERT,
+	STMT_QUEST_UPDATE_STATE,
+	STMT_QUEST_REMOVE,
+	STMT_MAIL_COUNT,
+	STMT_MAIL_INSERT,
+	STMT_MAIL_INSERT_ITEM,
+	STMT_MAIL_REMOVE,
+	STMT_SQL_BENCHMARK,
+	NUM_PREPARED_STATEMENTS,
+};
+
 // npc functions
 enum FunctionsNPC
 {
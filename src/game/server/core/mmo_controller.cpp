@@ -3,6 +3,7 @@
 #include "mmo_controller.h"
 
 #include <engine/shared/config.h>
+#include <engine/shared/profiler.h>
 #include <game/server/gamecontext.h>
 #include <teeother/system/string.h>
 
@@ -25,6 +26,7 @@
 #include "components/tutorial/tutorial_manager.h"
 #include "components/warehouse/warehouse_manager.h"
 #include "components/worlds/world_manager.h"
+#include "tools/bank_ledger.h"
 
 inline static void InsertUpgradesVotes(CPlayer* pPlayer, AttributeGroup Type, CVoteWrapper* pWrapper)
 {
@@ -66,26 +68,30 @@ inline static void InsertUpgradesVotes(CPlayer* pPlayer, AttributeGroup Type, CV
 
 CMmoController::CMmoController(CGS* pGameServer) : m_pGameServer(pGameServer)
 {
+	// bank changes a previous run left in the journal, before any bank is loaded
+	if(m_pGameServer->GetWorldID() == MAIN_WORLD_ID)
+		CBankLedger::Replay();
+
 	// order
-	m_System.add(m_pQuestManager = new CQuestManager);
-	m_System.add(m_pBotManager = new CBotManager);
-	m_System.add(m_pInventoryManager = new CInventoryManager);
-	m_System.add(m_pCraftManager = new CCraftManager);
-	m_System.add(m_pWarehouseManager = new CWarehouseManager);
-	m_System.add(new CAuctionManager);
-	m_System.add(m_pEidolonManager = new CEidolonManager);
-	m_System.add(m_pDungeonManager = new CDungeonManager);
-	m_System.add(new CAethernetManager);
-	m_System.add(m_pWorldManager = new CWorldManager);
-	m_System.add(m_pHouseManager = new CHouseManager);
-	m_System.add(m_pGuildManager = new CGuildManager);
-	m_System.add(m_pGroupManager = new CGroupManager);
-	m_System.add(m_pSkillManager = new CSkillManager);
-	m_System.add(m_pTutorialManager = new CTutorialManager);
-	m_System.add(m_pAccountManager = new CAccountManager);
-	m_System.add(m_pAccountMinerManager = new CAccountMinerManager);
-	m_System.add(m_pAccountPlantManager = new CAccountPlantManager);
-	m_System.add(m_pMailboxManager = new CMailboxManager);
+	m_System.add(m_pQuestManager = new CQuestManager, "QuestManager");
+	m_System.add(m_pBotManager = new CBotManager, "BotManager");
+	m_System.add(m_pInventoryManager = new CInventoryManager, "InventoryManager");
+	m_System.add(m_pCraftManager = new CCraftManager, "CraftManager");
+	m_System.add(m_pWarehouseManager = new CWarehouseManager, "WarehouseManager");
+	m_System.add(new CAuctionManager, "AuctionManager");
+	m_System.add(m_pEidolonManager = new CEidolonManager, "EidolonManager");
+	m_System.add(m_pDungeonManager = new CDungeonManager, "DungeonManager");
+	m_System.add(new CAethernetManager, "AethernetManager");
+	m_System.add(m_pWorldManager = new CWorldManager, "WorldManager");
+	m_System.add(m_pHouseManager = new CHouseManager, "HouseManager");
+	m_System.add(m_pGuildManager = new CGuildManager, "GuildManager");
+	m_System.add(m_pGroupManager = new CGroupManager, "GroupManager");
+	m_System.add(m_pSkillManager = new CSkillManager, "SkillManager");
+	m_System.add(m_pTutorialManager = new CTutorialManager, "TutorialManager");
+	m_System.add(m_pAccountManager = new CAccountManager, "AccountManager");
+	m_System.add(m_pAccountMinerManager = new CAccountMinerManager, "AccountMinerManager");
+	m_System.add(m_pAccountPlantManager = new CAccountPlantManager, "AccountPlantManager");
+	m_System.add(m_pMailboxManager = new CMailboxManager, "MailboxManager");
 
 	for(auto& pComponent : m_System.m_vComponents)
 	{
@@ -99,30 +105,108 @@ CMmoController::CMmoController(CGS* pGameServer) : m_pGameServer(pGameServer)
 		char aLocalSelect[64];
 		str_format(aLocalSelect, sizeof(aLocalSelect), "WHERE WorldID = '%d'", m_pGameServer->GetWorldID());
 		pComponent->OnInitWorld(aLocalSelect);
+
+		// profiled hooks per world and component
+		const char* apHooks[MmoComponent::NUM_PROFILE_HOOKS] = { "tick", "message", "tile" };
+		for(int Hook = 0; Hook < MmoComponent::NUM_PROFILE_HOOKS; Hook++)
+		{
+			char aName[64];
+			str_format(aName, sizeof(aName), "w%d/%s/%s", m_pGameServer->GetWorldID(), pComponent->m_pName, apHooks[Hook]);
+			pComponent->m_apProfile[Hook] = CProfiler::Get()->Entry(aName);
+		}
 	}
 }
 
 CMmoController::~CMmoController()
 {
+	// grants still waiting are not dropped
+	std::vector<CDelayedItemGrant> vGrants;
+	m_DelayedGrants.Drain([&vGrants](const CDelayedItemGrant& Grant) { vGrants.push_back(Grant); });
+	ApplyItemGrants(vGrants, true);
+
+	if(m_pGameServer->GetWorldID() == MAIN_WORLD_ID)
+		CBankLedger::Get().FlushNow();
+
 	m_System.free();
 }
 
 void CMmoController::OnTick()
 {
 	for(auto& pComponent : m_System.m_vComponents)
+	{
+		PROFILE_SCOPE(pComponent->m_apProfile[MmoComponent::PROFILE_TICK]);
 		pComponent->OnTick();
+	}
+
+	// delayed item grants that came due
+	if(m_DelayedGrants.Size())
+	{
+		std::vector<CDelayedItemGrant> vGrants;
+		m_DelayedGrants.Advance(GS()->Server()->Tick(), [&vGrants](const CDelayedItemGrant& Grant) { vGrants.push_back(Grant); });
+		ApplyItemGrants(vGrants, false);
+	}
+
+	// write the bank changes behind the game
+	if(GS()->GetWorldID() == MAIN_WORLD_ID && GS()->Server()->Tick() % (GS()->Server()->TickSpeed() * g_Config.m_SvBankFlushInterval) == 0)
+		CBankLedger::Get().Flush();
 
 	// Check if the current tick is a multiple of the time period check time
 	if(GS()->Server()->Tick() % ((GS()->Server()->TickSpeed() * 60) * g_Config.m_SvTimePeriodCheckTime) == 0)
 		HandleTimePeriod();
 }
 
+void CMmoController::ScheduleItemGrant(int AccountID, int ItemID, int Value, int Milliseconds)
+{
+	const int64_t Delay = (int64_t)Milliseconds * GS()->Server()->TickSpeed() / 1000;
+	m_DelayedGrants.Schedule(GS()->Server()->Tick() + Delay, { AccountID, ItemID, Value });
+}
+
+void CMmoController::ApplyItemGrants(const std::vector<CDelayedItemGrant>& vGrants, bool Wait) const
+{
+	// players that are online get the item right away, wherever they are
+	std::map<std::pair<int, ItemIdentifier>, int> OfflineGrants;
+	for(const auto& Grant : vGrants)
+	{
+		if(CPlayer* pPlayer = GS()->GetPlayerByUserID(Grant.m_AccountID))
+			pPlayer->GetItem(Grant.m_ItemID)->Add(Grant.m_Value);
+		else
+			OfflineGrants[{ Grant.m_AccountID, Grant.m_ItemID }] += Grant.m_Value;
+	}
+	if(OfflineGrants.empty())
+		return;
+
+	// the rest is written in one transaction, one row per account and item
+	auto WriteGrants = [OfflineGrants = std::move(OfflineGrants)]()
+	{
+		Database->ExecuteTransaction([&OfflineGrants](ISqlConnection* pConnection)
+		{
+			char aBuf[256];
+			for(const auto& [Key, Value] : OfflineGrants)
+			{
+				const auto& [AccountID, ItemID] = Key;
+				str_format(aBuf, sizeof(aBuf), "SELECT ID FROM tw_accounts_items WHERE UserID = '%d' AND ItemID = '%d'", AccountID, ItemID);
+				if(pConnection->ExecuteQuery(aBuf)->next())
+					str_format(aBuf, sizeof(aBuf), "UPDATE tw_accounts_items SET Value = Value + '%d' WHERE UserID = '%d' AND ItemID = '%d'", Value, AccountID, ItemID);
+				else
+					str_format(aBuf, sizeof(aBuf), "INSERT INTO tw_accounts_items (ItemID, UserID, Value, Settings, Enchant) VALUES ('%d', '%d', '%d', '0', '0')", ItemID, AccountID, Value);
+				pConnection->Execute(aBuf);
+			}
+		});
+	};
+
+	if(Wait)
+		WriteGrants();
+	else
+		std::thread(WriteGrants).detach();
+}
+
 bool CMmoController::OnMessage(int MsgID, void* pRawMsg, int ClientID)
 {
 	if(GS()->Server()->ClientIngame(ClientID) && GS()->GetPlayer(ClientID))
 	{
 		for(auto& pComponent : m_System.m_vComponents)
 		{
+			PROFILE_SCOPE(pComponent->m_apProfile[MmoComponent::PROFILE_MESSAGE]);
 			if(pComponent->OnMessage(MsgID, pRawMsg, ClientID))
 				return true;
 		}
@@ -332,6 +416,7 @@ bool CMmoController::OnPlayerHandleTile(CCharacter* pChr, int IndexCollision)
 
 	for(auto& pComponent : m_System.m_vComponents)
 	{
+		PROFILE_SCOPE(pComponent->m_apProfile[MmoComponent::PROFILE_TILE]);
 		if(pComponent->OnHandleTile(pChr, IndexCollision))
 			return true;
 	}
@@ -479,38 +564,47 @@ void CMmoController::SaveAccount(CPlayer* pPlayer, int Table) const
 
 	if(Table == SAVE_STATS)
 	{
-		Database->Execute<DB::UPDATE>("tw_accounts_data", "Level = '%d', Exp = '%d' WHERE ID = '%d'", pAcc->GetLevel(), pAcc->GetExperience(), pAcc->GetID());
+		auto pSave = Database->Prepare(STMT_ACCOUNT_SAVE_STATS, "UPDATE tw_accounts_data SET Level = ?, Exp = ? WHERE ID = ?");
+		pSave->Bind(pAcc->GetLevel()).Bind(pAcc->GetExperience()).Bind(pAcc->GetID()).Execute();
 	}
 	else if(Table == SAVE_UPGRADES)
 	{
-		dynamic_string Buffer;
+		// the field list only depends on the loaded attributes, so the statement text stays the same
+		std::string Query = "UPDATE tw_accounts_data SET Upgrade = ?";
 		for(const auto& [ID, pAttribute] : CAttributeDescription::Data())
 		{
 			if(pAttribute->HasDatabaseField())
-			{
-				char aBuf[64];
-				str_format(aBuf, sizeof(aBuf), ", %s = '%d' ", pAttribute->GetFieldName(), pAcc->m_aStats[ID]);
-				Buffer.append_at(Buffer.length(), aBuf);
-			}
+				Query.append(", ").append(pAttribute->GetFieldName()).append(" = ?");
 		}
+		Query.append(" WHERE ID = ?");
 
-		Database->Execute<DB::UPDATE>("tw_accounts_data", "Upgrade = '%d' %s WHERE ID = '%d'", pAcc->m_Upgrade, Buffer.buffer(), pAcc->GetID());
-		Buffer.clear();
+		auto pSave = Database->Prepare(STMT_ACCOUNT_SAVE_UPGRADES, Query.c_str());
+		pSave->Bind(pAcc->m_Upgrade);
+		for(const auto& [ID, pAttribute] : CAttributeDescription::Data())
+		{
+			if(pAttribute->HasDatabaseField())
+				pSave->Bind(pAcc->m_aStats[ID]);
+		}
+		pSave->Bind(pAcc->GetID()).Execute();
 	}
 	else if(Table == SAVE_PLANT_DATA)
 	{
-		std::string Fields = pAcc->m_FarmingData.getUpdateField();
-		Database->Execute<DB::UPDATE>("tw_accounts_farming", "%s WHERE UserID = '%d'", Fields.c_str(), pAcc->GetID());
+		static const std::string s_Query = "UPDATE tw_accounts_farming SET " + CJobFields::GetUpdateColumns() + " WHERE UserID = ?";
+		auto pSave = Database->Prepare(STMT_ACCOUNT_SAVE_FARMING, s_Query.c_str());
+		pAcc->m_FarmingData.BindFields(*pSave);
+		pSave->Bind(pAcc->GetID()).Execute();
 	}
 	else if(Table == SAVE_MINER_DATA)
 	{
-		std::string Fields = pAcc->m_MiningData.getUpdateField();
-		Database->Execute<DB::UPDATE>("tw_accounts_mining", "%s WHERE UserID = '%d'", Fields.c_str(), pAcc->GetID());
+		static const std::string s_Query = "UPDATE tw_accounts_mining SET " + CJobFields::GetUpdateColumns() + " WHERE UserID = ?";
+		auto pSave = Database->Prepare(STMT_ACCOUNT_SAVE_MINING, s_Query.c_str());
+		pAcc->m_MiningData.BindFields(*pSave);
+		pSave->Bind(pAcc->GetID()).Execute();
 	}
 	else if(Table == SAVE_SOCIAL_STATUS)
 	{
-		Database->Execute<DB::UPDATE>("tw_accounts_data", "Relations = '%d', PrisonSeconds = '%d', DailyChairGolds = '%d' WHERE ID = '%d'",
-			pAcc->GetRelations(), pAcc->m_PrisonSeconds, pAcc->GetCurrentDailyChairGolds(), pAcc->GetID());
+		auto pSave = Database->Prepare(STMT_ACCOUNT_SAVE_SOCIAL_STATUS, "UPDATE tw_accounts_data SET Relations = ?, PrisonSeconds = ?, DailyChairGolds = ? WHERE ID = ?");
+		pSave->Bind(pAcc->GetRelations()).Bind(pAcc->m_PrisonSeconds).Bind(pAcc->GetCurrentDailyChairGolds()).Bind(pAcc->GetID()).Execute();
 	}
 	else if(Table == SAVE_GUILD_DATA)
 	{
@@ -519,22 +613,26 @@ void CMmoController::SaveAccount(CPlayer* pPlayer, int Table) const
 	else if(Table == SAVE_POSITION)
 	{
 		const int LatestCorrectWorldID = AccountManager()->GetLastVisitedWorldID(pPlayer);
-		Database->Execute<DB::UPDATE>("tw_accounts_data", "WorldID = '%d' WHERE ID = '%d'", LatestCorrectWorldID, pAcc->GetID());
+		auto pSave = Database->Prepare(STMT_ACCOUNT_SAVE_POSITION, "UPDATE tw_accounts_data SET WorldID = ? WHERE ID = ?");
+		pSave->Bind(LatestCorrectWorldID).Bind(pAcc->GetID()).Execute();
 	}
 	else if(Table == SAVE_TIME_PERIODS)
 	{
-		time_t Daily = pAcc->m_Periods.m_DailyStamp;
-		time_t Week = pAcc->m_Periods.m_WeekStamp;
-		time_t Month = pAcc->m_Periods.m_MonthStamp;
-		Database->Execute<DB::UPDATE>("tw_accounts_data", "DailyStamp = '%llu', WeekStamp = '%llu', MonthStamp = '%llu' WHERE ID = '%d'", Daily, Week, Month, pAcc->GetID());
+		const int64_t Daily = pAcc->m_Periods.m_DailyStamp;
+		const int64_t Week = pAcc->m_Periods.m_WeekStamp;
+		const int64_t Month = pAcc->m_Periods.m_MonthStamp;
+		auto pSave = Database->Prepare(STMT_ACCOUNT_SAVE_TIME_PERIODS, "UPDATE tw_accounts_data SET DailyStamp = ?, WeekStamp = ?, MonthStamp = ? WHERE ID = ?");
+		pSave->Bind(Daily).Bind(Week).Bind(Month).Bind(pAcc->GetID()).Execute();
 	}
 	else if(Table == SAVE_LANGUAGE)
 	{
-		Database->Execute<DB::UPDATE>("tw_accounts", "Language = '%s' WHERE ID = '%d'", pPlayer->GetLanguage(), pAcc->GetID());
+		auto pSave = Database->Prepare(STMT_ACCOUNT_SAVE_LANGUAGE, "UPDATE tw_accounts SET Language = ? WHERE ID = ?");
+		pSave->Bind(pPlayer->GetLanguage()).Bind(pAcc->GetID()).Execute();
 	}
 	else
 	{
-		Database->Execute<DB::UPDATE>("tw_accounts", "Username = '%s' WHERE ID = '%d'", pAcc->GetLogin(), pAcc->GetID());
+		auto pSave = Database->Prepare(STMT_ACCOUNT_SAVE_USERNAME, "UPDATE tw_accounts SET Username = ? WHERE ID = ?");
+		pSave->Bind(pAcc->GetLogin()).Bind(pAcc->GetID()).Execute();
 	}
 }
 
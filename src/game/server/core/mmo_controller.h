@@ -9,14 +9,24 @@
 	This will affect the size of the output file
 */
 #include "mmo_component.h"
+#include "tools/timer_wheel.h"
+
+// an item given some time after it was earned
+struct CDelayedItemGrant
+{
+	int m_AccountID;
+	int m_ItemID;
+	int m_Value;
+};
 
 class CMmoController
 {
 	class CStack
 	{
 	public:
-		void add(class MmoComponent *pComponent)
+		void add(class MmoComponent *pComponent, const char *pName)
 		{
+			pComponent->m_pName = pName;
 			m_vComponents.push_back(pComponent);
 		}
 
@@ -52,6 +62,9 @@ class CMmoController
 	class CWorldManager* m_pWorldManager;
 	class CEidolonManager* m_pEidolonManager;
 
+	CTimerWheel<CDelayedItemGrant> m_DelayedGrants;
+	void ApplyItemGrants(const std::vector<CDelayedItemGrant>& vGrants, bool Wait) const;
+
 public:
 	explicit CMmoController(CGS *pGameServer);
 	~CMmoController();
@@ -89,6 +102,9 @@ public:
 	void HandleTimePeriod() const;
 	void HandlePlayerTimePeriod(CPlayer* pPlayer);
 
+	// gives the item after the delay on the game thread, or in the database if the player left
+	void ScheduleItemGrant(int AccountID, int ItemID, int Value, int Milliseconds);
+
 	static void AsyncClientEnterMsgInfo(std::string ClientName, int ClientID);
 	void ConAsyncLinesForTranslate();
 	//
@@ -0,0 +1,79 @@
+/* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
+/* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#ifndef GAME_SERVER_CORE_TOOLS_ALIAS_TABLE_H
+#define GAME_SERVER_CORE_TOOLS_ALIAS_TABLE_H
+
+#include <base/math.h>
+
+#include <vector>
+
+/*
+ * Walker's alias method: weighted draws in constant time
+ * Every column holds its own index with probability m_Prob and an alias otherwise,
+ * a draw is one column pick and one coin flip, whatever the number of weights.
+ */
+class CAliasTable
+{
+	struct CColumn
+	{
+		float m_Prob;
+		int m_Alias;
+	};
+	std::vector<CColumn> m_vColumns;
+
+public:
+	// weights must not be negative, a table without any positive weight stays empty
+	void Build(const std::vector<float>& vWeights)
+	{
+		m_vColumns.clear();
+		double Total = 0.0;
+		for(float Weight : vWeights)
+			Total += maximum(Weight, 0.0f);
+		if(Total <= 0.0)
+			return;
+
+		// scaled so the average column is exactly full
+		const int Num = (int)vWeights.size();
+		std::vector<double> vScaled(Num);
+		std::vector<int> vSmall, vLarge;
+		for(int i = 0; i < Num; i++)
+		{
+			vScaled[i] = maximum(vWeights[i], 0.0f) * Num / Total;
+			(vScaled[i] < 1.0 ? vSmall : vLarge).push_back(i);
+		}
+
+		// fill every underfull column from an overfull one
+		m_vColumns.assign(Num, CColumn {1.0f, 0});
+		for(int i = 0; i < Num; i++)
+			m_vColumns[i].m_Alias = i;
+		while(!vSmall.empty() && !vLarge.empty())
+		{
+			const int Small = vSmall.back();
+			const int Large = vLarge.back();
+			vSmall.pop_back();
+			m_vColumns[Small] = {(float)vScaled[Small], Large};
+			vScaled[Large] -= 1.0 - vScaled[Small];
+			if(vScaled[Large] < 1.0)
+			{
+				vLarge.pop_back();
+				vSmall.push_back(Large);
+			}
+		}
+		// what is left is full up to rounding
+	}
+
+	bool IsEmpty() const { return m_vColumns.empty(); }
+	int Size() const { return (int)m_vColumns.size(); }
+
+	// Random() returns a uniform float in [0, 1]
+	template < typename F >
+	int Draw(F&& Random) const
+	{
+		const int Num = (int)m_vColumns.size();
+		const int Column = minimum((int)(Random() * Num), Num - 1);
+		return Random() < m_vColumns[Column].m_Prob ? Column : m_vColumns[Column].m_Alias;
+	}
+	int Draw() const { return Draw([]() { return random_float(); }); }
+};
+
+#endif
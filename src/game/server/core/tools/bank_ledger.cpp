@@ -0,0 +1,105 @@
+/* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
+/* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#include "bank_ledger.h"
+
+#include <engine/server/sql_connect_pool.h>
+#include <game/server/core/components/Guilds/GuildData.h>
+#include <game/server/core/components/Houses/HouseData.h>
+
+#include <chrono>
+#include <thread>
+
+// adds the journal sums to the bank columns and empties the journal
+static void FoldJournal(ISqlConnection* pConnection)
+{
+	char aBuf[512];
+	str_format(aBuf, sizeof(aBuf), "UPDATE %s SET Bank = Bank + (SELECT SUM(Delta) FROM %s WHERE Kind = '%d' AND OwnerID = %s.ID) "
+		"WHERE ID IN (SELECT OwnerID FROM %s WHERE Kind = '%d')", TW_GUILDS_TABLE, TW_BANK_JOURNAL_TABLE, (int)CBankLedger::KIND_GUILD,
+		TW_GUILDS_TABLE, TW_BANK_JOURNAL_TABLE, (int)CBankLedger::KIND_GUILD);
+	pConnection->Execute(aBuf);
+
+	str_format(aBuf, sizeof(aBuf), "UPDATE %s SET HouseBank = HouseBank + (SELECT SUM(Delta) FROM %s WHERE Kind = '%d' AND OwnerID = %s.ID) "
+		"WHERE ID IN (SELECT OwnerID FROM %s WHERE Kind = '%d')", TW_HOUSES_TABLE, TW_BANK_JOURNAL_TABLE, (int)CBankLedger::KIND_HOUSE,
+		TW_HOUSES_TABLE, TW_BANK_JOURNAL_TABLE, (int)CBankLedger::KIND_HOUSE);
+	pConnection->Execute(aBuf);
+
+	// rows of removed guilds and houses have nothing to fold into and go too
+	str_format(aBuf, sizeof(aBuf), "DELETE FROM %s", TW_BANK_JOURNAL_TABLE);
+	pConnection->Execute(aBuf);
+}
+
+void CBankLedger::WriteBatch(bool Fold)
+{
+	std::vector<CEntry> vBatch = TakeBatch();
+	if(vBatch.empty() && !Fold)
+		return;
+
+	const bool Success = Database->ExecuteTransaction([&vBatch, Fold](ISqlConnection* pConnection)
+	{
+		char aBuf[256];
+		std::string Values;
+		for(const auto& Entry : vBatch)
+		{
+			// a retried row may have been committed by an attempt whose answer got lost
+			str_format(aBuf, sizeof(aBuf), "SELECT Seq FROM %s WHERE Kind = '%d' AND OwnerID = '%d' AND Seq = '%lld'",
+				TW_BANK_JOURNAL_TABLE, Entry.m_Kind, Entry.m_OwnerID, (long long)Entry.m_Seq);
+			if(pConnection->ExecuteQuery(aBuf)->next())
+				continue;
+
+			str_format(aBuf, sizeof(aBuf), "%s('%d', '%d', '%lld', '%lld')", Values.empty() ? "" : ", ",
+				Entry.m_Kind, Entry.m_OwnerID, (long long)Entry.m_Seq, (long long)Entry.m_Delta);
+			Values += aBuf;
+		}
+
+		if(!Values.empty())
+			pConnection->Execute(std::string("INSERT INTO " TW_BANK_JOURNAL_TABLE " (Kind, OwnerID, Seq, Delta) VALUES ") + Values);
+
+		// retried rows are always written again before a fold, so the fold never loses the check above
+		if(Fold)
+			FoldJournal(pConnection);
+	});
+
+	if(!Success)
+		Requeue(std::move(vBatch));
+}
+
+void CBankLedger::Flush()
+{
+	if(m_Flushing.exchange(true))
+		return;
+
+	const bool Fold = (++m_NumFlushes % FOLD_EVERY_FLUSHES) == 0;
+	std::thread([this, Fold]()
+	{
+		WriteBatch(Fold);
+		m_Flushing = false;
+	}).detach();
+}
+
+void CBankLedger::FlushNow()
+{
+	while(m_Flushing.exchange(true))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	WriteBatch(true);
+	m_Flushing = false;
+
+	if(HasPending())
+		dbg_msg("bank", "the bank journal could not be written, the last changes are lost");
+}
+
+void CBankLedger::Replay()
+{
+	Database->ExecuteTransaction([](ISqlConnection* pConnection)
+	{
+		// should the fold fail, the new rows still must not take the keys of the old ones
+		ResultPtr pRes = pConnection->ExecuteQuery("SELECT COALESCE(MAX(Seq), 0) AS LastSeq FROM " TW_BANK_JOURNAL_TABLE);
+		if(pRes->next())
+		{
+			std::lock_guard Lock(Get().m_Mutex);
+			Get().m_LastSeq = pRes->getInt64("LastSeq");
+		}
+
+		FoldJournal(pConnection);
+	});
+}
@@ -0,0 +1,108 @@
+/* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
+/* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#ifndef GAME_SERVER_CORE_TOOLS_BANK_LEDGER_H
+#define GAME_SERVER_CORE_TOOLS_BANK_LEDGER_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#define TW_BANK_JOURNAL_TABLE "tw_bank_journal"
+
+/*
+ * Write-behind ledger of the guild and house banks
+ * The banks in memory are authoritative, every change is recorded here as a delta.
+ * The deltas of one bank are merged until the next batch, each batch row gets a
+ * sequence number, so the (Kind, OwnerID, Seq) key makes writing a row idempotent.
+ * Batches are appended to the journal table and folded into the bank columns later,
+ * the fold at startup replays whatever a crash left in the journal.
+ */
+class CBankLedger
+{
+public:
+	enum
+	{
+		KIND_GUILD = 0,
+		KIND_HOUSE,
+	};
+
+	struct CEntry
+	{
+		int m_Kind;
+		int m_OwnerID;
+		int64_t m_Seq;
+		int64_t m_Delta;
+	};
+
+	static CBankLedger& Get()
+	{
+		static CBankLedger s_Ledger;
+		return s_Ledger;
+	}
+
+	// game thread: record a change of a bank
+	void Record(int Kind, int OwnerID, int64_t Delta)
+	{
+		if(Delta == 0)
+			return;
+
+		std::lock_guard Lock(m_Mutex);
+		auto Iter = m_Pending.try_emplace({Kind, OwnerID}, 0).first;
+		Iter->second += Delta;
+		if(Iter->second == 0)
+			m_Pending.erase(Iter);
+	}
+
+	// one row per changed bank, rows that failed to write come again with their old sequence
+	std::vector<CEntry> TakeBatch()
+	{
+		std::lock_guard Lock(m_Mutex);
+		std::vector<CEntry> vBatch = std::move(m_vFailed);
+		m_vFailed.clear();
+		for(const auto& [Key, Delta] : m_Pending)
+			vBatch.push_back({Key.first, Key.second, ++m_LastSeq, Delta});
+		m_Pending.clear();
+		return vBatch;
+	}
+
+	// a batch that could not be written, kept for the next one
+	void Requeue(std::vector<CEntry>&& vBatch)
+	{
+		std::lock_guard Lock(m_Mutex);
+		m_vFailed.insert(m_vFailed.end(), vBatch.begin(), vBatch.end());
+	}
+
+	bool HasPending()
+	{
+		std::lock_guard Lock(m_Mutex);
+		return !m_Pending.empty() || !m_vFailed.empty();
+	}
+
+	// game thread: writes the next batch on a worker, skipped while the last one is still running
+	void Flush();
+	// writes everything left and folds the journal, blocks until done (shutdown)
+	void FlushNow();
+	// folds the rows a previous run left in the journal into the banks (startup)
+	static void Replay();
+
+private:
+	enum
+	{
+		// every how many flushes the journal is folded into the bank columns
+		FOLD_EVERY_FLUSHES = 12,
+	};
+
+	void WriteBatch(bool Fold);
+
+	std::atomic<bool> m_Flushing {};
+	int m_NumFlushes {};
+	std::mutex m_Mutex;
+	std::map<std::pair<int, int>, int64_t> m_Pending;
+	std::vector<CEntry> m_vFailed;
+	int64_t m_LastSeq {};
+};
+
+#endif
@@ -3,119 +3,177 @@
 #ifndef GAME_SERVER_MMO_UTILS_FIELD_DATA_H
 #define GAME_SERVER_MMO_UTILS_FIELD_DATA_H
 
+#include <engine/server/sql_backend.h>
+
+#include <array>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
 /*
- * Like all data structures must have setters and getters
- * This is just a template for more convenient work with database data
- * TODO: try using constexpr and a kind of variation pattern
- * std::variant and std::any are used partially at compile time and runtime.
- * And there is no way to give exact information about the returned object
+ * Database fields described once at compile time
+ * The schema lists the columns in the order of their ids, the container keeps the values
+ * in a flat array (or a tuple for mixed types), so a typed getter is a fixed offset and
+ * a wrong type does not compile
  *
- * Can use container how only for work inside db
- * struct DataStructure : pulbic DBFieldContainer
+ * struct CDataSchema
  * {
- *		DBField<int> m_Level { "Level", "info", this };
- * } m_Data;
+ *		static constexpr DBSchema<int, std::string> ms_Schema
+ *		{
+ *			DBFieldInfo<int> { "Level", "Level", 1 },
+ *			DBFieldInfo<std::string> { "Title", "Title", "" },
+ *		};
+ * };
+ * DBFieldContainer<CDataSchema> m_Data;
  *
- * m_Data.initFields();
+ * m_Data.InitFields(&pRes);
+ * m_Data.Get<0>()++;
  */
 
 template < typename T >
-class DBField
+struct DBFieldInfo
 {
-	friend class DBFieldContainer;
+	// string defaults stay literals, so the schema can be constexpr
+	using DefaultType = std::conditional_t<std::is_same_v<T, std::string>, const char*, T>;
 
-	size_t m_UniqueID{};
-	char m_aFieldName[128] = {};
-	char m_aDescription[128] = {};
+	const char* m_pFieldName;
+	const char* m_pDescription;
+	DefaultType m_Default;
+};
 
-public:
-	DBField() = delete;
-	DBField(size_t UniqueID, const char* pFieldName, const char* pDescription, T DefaultValue = {}) : m_Value(DefaultValue) { init(UniqueID, pFieldName, pDescription); }
+template < typename ... Ts >
+struct DBSchema
+{
+	static constexpr size_t NUM_FIELDS = sizeof...(Ts);
+	static constexpr bool SINGLE_TYPE = (std::is_same_v<std::tuple_element_t<0, std::tuple<Ts...>>, Ts> && ...);
+	using Storage = std::conditional_t<SINGLE_TYPE, std::array<std::tuple_element_t<0, std::tuple<Ts...>>, NUM_FIELDS>, std::tuple<Ts...>>;
 
-	T m_Value{};
+	std::tuple<DBFieldInfo<Ts>...> m_Fields;
+
+	constexpr DBSchema(DBFieldInfo<Ts>... Fields) : m_Fields(Fields...) {}
+};
+
+template < typename TSchema >
+class DBFieldContainer
+{
+	using Schema = std::decay_t<decltype(TSchema::ms_Schema)>;
+	using Indices = std::make_index_sequence<Schema::NUM_FIELDS>;
 
-	// functions
-	void init(size_t UniqueID, const char* pFieldName, const char* pDescription)
+	typename Schema::Storage m_Values {};
+
+	template < size_t ... Is >
+	static std::array<const char*, Schema::NUM_FIELDS> CollectNames(std::index_sequence<Is...>, bool Description)
 	{
-		m_UniqueID = UniqueID;
-		str_copy(m_aFieldName, pFieldName, sizeof(m_aFieldName));
-		str_copy(m_aDescription, pDescription, sizeof(m_aDescription));
+		return { (Description ? std::get<Is>(TSchema::ms_Schema.m_Fields).m_pDescription : std::get<Is>(TSchema::ms_Schema.m_Fields).m_pFieldName)... };
 	}
 
-	const T& getValue() const { return m_Value; }
-	const char* getFieldName() const { return m_aFieldName; };
-	const char* getDescription() const { return m_aDescription; }
-};
+	static const std::array<const char*, Schema::NUM_FIELDS>& FieldNames()
+	{
+		static const auto s_aNames = CollectNames(Indices {}, false);
+		return s_aNames;
+	}
 
-template<class> inline constexpr bool always_false_v = false;
+	static const std::array<const char*, Schema::NUM_FIELDS>& Descriptions()
+	{
+		static const auto s_aDescriptions = CollectNames(Indices {}, true);
+		return s_aDescriptions;
+	}
 
-class DBFieldContainer
-{
-	using FieldVariant = std::variant < DBField<int>, DBField<float>, DBField<double>, DBField<std::string> >;
+	template < size_t ... Is >
+	void ResetImpl(std::index_sequence<Is...>)
+	{
+		((std::get<Is>(m_Values) = std::get<Is>(TSchema::ms_Schema.m_Fields).m_Default), ...);
+	}
 
-	std::list < FieldVariant > m_VariantsData;
+	template < size_t I >
+	void InitField(ISqlResult* pRes)
+	{
+		auto& Value = std::get<I>(m_Values);
+		using T = std::decay_t<decltype(Value)>;
+		const char* pName = std::get<I>(TSchema::ms_Schema.m_Fields).m_pFieldName;
+		if constexpr(std::is_same_v<T, int>)
+			Value = pRes->getInt(pName);
+		else if constexpr(std::is_same_v<T, int64_t>)
+			Value = pRes->getInt64(pName);
+		else if constexpr(std::is_same_v<T, float>)
+			Value = static_cast<float>(pRes->getDouble(pName));
+		else if constexpr(std::is_same_v<T, double>)
+			Value = pRes->getDouble(pName);
+		else if constexpr(std::is_same_v<T, std::string>)
+			Value = pRes->getString(pName);
+		else
+			static_assert(!sizeof(T), "unsupported field type");
+	}
 
-public:
-	DBFieldContainer() = default;
-	DBFieldContainer(std::initializer_list<FieldVariant>&& pField) { m_VariantsData.insert(m_VariantsData.end(), pField.begin(), pField.end()); }
+	template < size_t ... Is >
+	void InitFieldsImpl(ISqlResult* pRes, std::index_sequence<Is...>)
+	{
+		(InitField<Is>(pRes), ...);
+	}
 
-	template < typename T >
-	DBField<T>& operator()(size_t UniqueID, [[maybe_unused]]T DefaultValue)
+	template < typename TStatement, size_t ... Is >
+	void BindFieldsImpl(TStatement& Statement, std::index_sequence<Is...>) const
 	{
-		auto it = std::find_if(m_VariantsData.begin(), m_VariantsData.end(), [UniqueID](auto& p)
+		auto BindOne = [&Statement](const auto& Value)
 		{
-			try { return std::get<DBField<T>>(p).m_UniqueID == UniqueID; }
-			catch([[maybe_unused]] const std::bad_variant_access& ex) { return false; }
-		});
+			if constexpr(std::is_same_v<std::decay_t<decltype(Value)>, float>)
+				Statement.Bind(static_cast<double>(Value));
+			else
+				Statement.Bind(Value);
+		};
+		(BindOne(std::get<Is>(m_Values)), ...);
+	}
+
+public:
+	static constexpr size_t NUM_FIELDS = Schema::NUM_FIELDS;
+
+	DBFieldContainer() { Reset(); }
 
-		dbg_assert(it != m_VariantsData.end(), "error get from variant data DBField");
-		return std::get<DBField<T>>(*it);
+	// typed access by a constant id, resolved at compile time
+	template < size_t ID >
+	auto& Get() { static_assert(ID < NUM_FIELDS, "field id out of the schema"); return std::get<ID>(m_Values); }
+	template < size_t ID >
+	const auto& Get() const { static_assert(ID < NUM_FIELDS, "field id out of the schema"); return std::get<ID>(m_Values); }
+
+	// access by an id known only at runtime (votes, menus), nullptr if out of range
+	auto* At(size_t ID)
+	{
+		static_assert(Schema::SINGLE_TYPE, "runtime access needs all fields of the same type");
+		return ID < NUM_FIELDS ? &m_Values[ID] : nullptr;
 	}
-	
-	std::string getUpdateField()
+	const auto* At(size_t ID) const
 	{
-		std::string Fields;
-		for(auto& p : m_VariantsData)
+		static_assert(Schema::SINGLE_TYPE, "runtime access needs all fields of the same type");
+		return ID < NUM_FIELDS ? &m_Values[ID] : nullptr;
+	}
+
+	static const char* GetFieldName(size_t ID) { return ID < NUM_FIELDS ? FieldNames()[ID] : ""; }
+	static const char* GetDescription(size_t ID) { return ID < NUM_FIELDS ? Descriptions()[ID] : ""; }
+
+	// "Field = ?, Field = ?" in schema order, built once per schema
+	static const std::string& GetUpdateColumns()
+	{
+		static const std::string s_Columns = []()
 		{
-			std::visit([&Fields](auto&& arg)
-			{
-				using T = std::decay_t<decltype(arg)>;
-				if constexpr(std::is_same_v<T, DBField<int>> || std::is_same_v<T, DBField<float>>|| std::is_same_v<T, DBField<double>>)
-					Fields.append(arg.getFieldName()).append("=").append(std::to_string(arg.m_Value)).append(",");
-				else if constexpr(std::is_same_v<T, DBField<std::string>>)
-					Fields.append(arg.getFieldName()).append("=").append(arg.m_Value).append(",");
-				else
-					dbg_assert(always_false_v<T>, "non-exhaustive visitor!");
-			}, p);
-		}
-
-		Fields.pop_back();
-		return Fields;
+			std::string Columns;
+			for(const char* pName : FieldNames())
+				Columns.append(Columns.empty() ? "" : ", ").append(pName).append(" = ?");
+			return Columns;
+		}();
+		return s_Columns;
 	}
 
-	void initFields(ResultPtr* pRes)
+	// binds the values in the order of GetUpdateColumns
+	template < typename TStatement >
+	void BindFields(TStatement& Statement) const { BindFieldsImpl(Statement, Indices {}); }
+
+	void Reset() { ResetImpl(Indices {}); }
+
+	void InitFields(std::unique_ptr<ISqlResult>* pRes)
 	{
 		if(pRes != nullptr)
-		{
-			for(auto& p : m_VariantsData)
-			{
-				std::visit([&pRes](auto&& arg)
-				{
-					using T = std::decay_t<decltype(arg)>;
-					if constexpr(std::is_same_v<T, DBField<int>>)
-						arg.m_Value = pRes->get()->getInt(arg.getFieldName());
-					else if constexpr(std::is_same_v<T, DBField<float>>)
-						arg.m_Value = static_cast<float>(pRes->get()->getDouble(arg.getFieldName()));
-					else if constexpr(std::is_same_v<T, DBField<double>>)
-						arg.m_Value = pRes->get()->getDouble(arg.getFieldName());
-					else if constexpr(std::is_same_v<T, DBField<std::string>>)
-						arg.m_Value = pRes->get()->getString(arg.getFieldName());
-					else
-						dbg_assert(always_false_v<T>, "non-exhaustive visitor!");
-				}, p);
-			}
-		}
+			InitFieldsImpl(pRes->get(), Indices {});
 	}
 };
 
-#endif
\ No newline at end of file
+#endif
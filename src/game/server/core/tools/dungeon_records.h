@@ -0,0 +1,77 @@
+/* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
+/* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#ifndef GAME_SERVER_CORE_TOOLS_DUNGEON_RECORDS_H
+#define GAME_SERVER_CORE_TOOLS_DUNGEON_RECORDS_H
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Best passage of every player in one dungeon, with the leaderboard kept alongside
+ * Records only ever get faster, so an entry never drops out of the top list by itself,
+ * it is only pushed out by a faster one. The top list is a small sorted array and never
+ * has to be rebuilt from the full table.
+ */
+class CDungeonRecords
+{
+public:
+	enum
+	{
+		TOP_SIZE = 5,
+	};
+
+	struct CRecord
+	{
+		int m_UserID;
+		int m_Seconds;
+		int m_PassageHelp;
+	};
+
+	// keeps the faster passage, the passage help goes with it, returns true if it is a new best
+	bool Submit(int UserID, int Seconds, int PassageHelp)
+	{
+		auto [Iter, Inserted] = m_Best.try_emplace(UserID, CRecord {UserID, Seconds, PassageHelp});
+		if(!Inserted)
+		{
+			if(Seconds >= Iter->second.m_Seconds)
+				return false;
+			Iter->second.m_Seconds = Seconds;
+			Iter->second.m_PassageHelp = PassageHelp;
+		}
+
+		// already listed moves up, otherwise it takes a free place or the slowest one
+		const CRecord& Record = Iter->second;
+		auto Listed = std::find_if(m_vTop.begin(), m_vTop.end(), [UserID](const CRecord& Top) { return Top.m_UserID == UserID; });
+		if(Listed != m_vTop.end())
+			*Listed = Record;
+		else if((int)m_vTop.size() < TOP_SIZE)
+			m_vTop.push_back(Record);
+		else if(Faster(Record, m_vTop.back()))
+			m_vTop.back() = Record;
+		else
+			return true;
+		std::sort(m_vTop.begin(), m_vTop.end(), Faster);
+		return true;
+	}
+
+	const CRecord* Find(int UserID) const
+	{
+		const auto Iter = m_Best.find(UserID);
+		return Iter != m_Best.end() ? &Iter->second : nullptr;
+	}
+	const std::vector<CRecord>& Top() const { return m_vTop; }
+	int Size() const { return (int)m_Best.size(); }
+
+private:
+	// ties keep a stable order by user
+	static bool Faster(const CRecord& Left, const CRecord& Right)
+	{
+		return Left.m_Seconds != Right.m_Seconds ? Left.m_Seconds < Right.m_Seconds : Left.m_UserID < Right.m_UserID;
+	}
+
+	std::unordered_map<int, CRecord> m_Best;
+	std::vector<CRecord> m_vTop;
+};
+
+#endif
@@ -0,0 +1,109 @@
+/* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
+/* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#ifndef GAME_SERVER_CORE_TOOLS_INVENTORY_INDEX_H
+#define GAME_SERVER_CORE_TOOLS_INVENTORY_INDEX_H
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Secondary index over the items of one player
+ * The IDs of held items are kept sorted per item type and per slot (the item function),
+ * equipped items once more per slot, so menus and counts visit only what they show.
+ * Set gets the whole derived state of one item and moves it between the lists.
+ */
+class CInventoryIndex
+{
+	struct CState
+	{
+		int m_Type;
+		int m_Slot;
+		bool m_Held;
+		bool m_Equipped;
+	};
+
+	std::unordered_map<int, CState> m_States;
+	std::map<int, std::vector<int>> m_ByType;
+	std::map<int, std::vector<int>> m_BySlot;
+	std::map<int, std::vector<int>> m_EquippedBySlot;
+	std::vector<int> m_vEquipped;
+
+	static const std::vector<int>& Find(const std::map<int, std::vector<int>>& Lists, int Key)
+	{
+		static const std::vector<int> s_vEmpty;
+		const auto Iter = Lists.find(Key);
+		return Iter != Lists.end() ? Iter->second : s_vEmpty;
+	}
+	static void Insert(std::vector<int>& vList, int ItemID) { vList.insert(std::lower_bound(vList.begin(), vList.end(), ItemID), ItemID); }
+	static void Erase(std::vector<int>& vList, int ItemID)
+	{
+		const auto Iter = std::lower_bound(vList.begin(), vList.end(), ItemID);
+		if(Iter != vList.end() && *Iter == ItemID)
+			vList.erase(Iter);
+	}
+
+public:
+	// an equipped item is always held as well
+	void Set(int ItemID, int Type, int Slot, bool Held, bool Equipped)
+	{
+		Equipped = Equipped && Held;
+		auto [Iter, Inserted] = m_States.try_emplace(ItemID, CState {Type, Slot, false, false});
+		CState& State = Iter->second;
+		if(!Inserted && State.m_Type == Type && State.m_Slot == Slot && State.m_Held == Held && State.m_Equipped == Equipped)
+			return;
+
+		// out of the old lists, into the new ones
+		if(State.m_Held)
+		{
+			Erase(m_ByType[State.m_Type], ItemID);
+			Erase(m_BySlot[State.m_Slot], ItemID);
+		}
+		if(State.m_Equipped)
+		{
+			Erase(m_EquippedBySlot[State.m_Slot], ItemID);
+			Erase(m_vEquipped, ItemID);
+		}
+		State = {Type, Slot, Held, Equipped};
+		if(Held)
+		{
+			Insert(m_ByType[Type], ItemID);
+			Insert(m_BySlot[Slot], ItemID);
+		}
+		if(Equipped)
+		{
+			Insert(m_EquippedBySlot[Slot], ItemID);
+			Insert(m_vEquipped, ItemID);
+		}
+	}
+
+	void Clear()
+	{
+		m_States.clear();
+		m_ByType.clear();
+		m_BySlot.clear();
+		m_EquippedBySlot.clear();
+		m_vEquipped.clear();
+	}
+
+	// sorted item IDs
+	const std::vector<int>& Held(int Type) const { return Find(m_ByType, Type); }
+	const std::vector<int>& HeldInSlot(int Slot) const { return Find(m_BySlot, Slot); }
+	const std::vector<int>& Equipped(int Slot) const { return Find(m_EquippedBySlot, Slot); }
+	const std::vector<int>& Equipped() const { return m_vEquipped; }
+	int Count(int Type) const { return (int)Held(Type).size(); }
+
+	// the first equipped item of the slot other than SkipItemID, -1 if there is none
+	int FindEquipped(int Slot, int SkipItemID = -1) const
+	{
+		for(int ItemID : Equipped(Slot))
+		{
+			if(ItemID != SkipItemID)
+				return ItemID;
+		}
+		return -1;
+	}
+};
+
+#endif
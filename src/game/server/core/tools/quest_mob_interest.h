@@ -0,0 +1,160 @@
+/* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
+/* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#ifndef GAME_SERVER_CORE_TOOLS_QUEST_MOB_INTEREST_H
+#define GAME_SERVER_CORE_TOOLS_QUEST_MOB_INTEREST_H
+
+#include <engine/shared/protocol.h>
+
+#include <algorithm>
+#include <bitset>
+#include <map>
+#include <tuple>
+#include <vector>
+
+/*
+ * Clients a quest mob is spawned for
+ * Mobs are players and are kept by client ID. Every mob has a bitset of the clients with
+ * its quest step active and of those that already defeated it, changed only on accept,
+ * defeat and finish. The reverse lists give the mobs of one client, and the task a mob
+ * was spawned for finds it again.
+ */
+class CQuestMobInterest
+{
+public:
+	using ClientMask = std::bitset<MAX_PLAYERS>;
+
+private:
+	struct CMob
+	{
+		bool m_Spawned;
+		std::tuple<int, int, int> m_Task;
+		ClientMask m_Active;
+		ClientMask m_Complete;
+	};
+
+	CMob m_aMobs[MAX_CLIENTS] {};
+	std::map<std::tuple<int, int, int>, int> m_ByTask;
+	std::vector<int> m_avMobs[MAX_PLAYERS];
+
+	static bool ValidClient(int ClientID) { return ClientID >= 0 && ClientID < MAX_PLAYERS; }
+	CMob* Find(int MobID) { return MobID >= 0 && MobID < MAX_CLIENTS && m_aMobs[MobID].m_Spawned ? &m_aMobs[MobID] : nullptr; }
+	const CMob* Find(int MobID) const { return MobID >= 0 && MobID < MAX_CLIENTS && m_aMobs[MobID].m_Spawned ? &m_aMobs[MobID] : nullptr; }
+	void Leave(int MobID, CMob& Mob, int ClientID)
+	{
+		Mob.m_Active.reset(ClientID);
+		Mob.m_Complete.reset(ClientID);
+		std::vector<int>& vMobs = m_avMobs[ClientID];
+		const auto Iter = std::lower_bound(vMobs.begin(), vMobs.end(), MobID);
+		if(Iter != vMobs.end() && *Iter == MobID)
+			vMobs.erase(Iter);
+	}
+
+public:
+	// a mob spawned for the move to task of a quest step, a mob with the same ID is replaced
+	void AddMob(int MobID, int QuestID, int Step, int MoveToStep)
+	{
+		if(MobID < 0 || MobID >= MAX_CLIENTS)
+			return;
+
+		RemoveMob(MobID);
+		const auto Task = std::make_tuple(QuestID, Step, MoveToStep);
+		m_aMobs[MobID].m_Spawned = true;
+		m_aMobs[MobID].m_Task = Task;
+		m_ByTask[Task] = MobID;
+	}
+
+	void RemoveMob(int MobID)
+	{
+		CMob* pMob = Find(MobID);
+		if(!pMob)
+			return;
+
+		for(int ClientID = 0; ClientID < MAX_PLAYERS; ClientID++)
+		{
+			if(pMob->m_Active.test(ClientID))
+				Leave(MobID, *pMob, ClientID);
+		}
+		const auto TaskIter = m_ByTask.find(pMob->m_Task);
+		if(TaskIter != m_ByTask.end() && TaskIter->second == MobID)
+			m_ByTask.erase(TaskIter);
+		*pMob = CMob {};
+	}
+
+	// -1 if no mob is spawned for the task
+	int FindMob(int QuestID, int Step, int MoveToStep) const
+	{
+		const auto Iter = m_ByTask.find(std::make_tuple(QuestID, Step, MoveToStep));
+		return Iter != m_ByTask.end() ? Iter->second : -1;
+	}
+
+	// the quest step became active for the client, an earlier defeat no longer counts
+	void Accept(int MobID, int ClientID)
+	{
+		CMob* pMob = Find(MobID);
+		if(!pMob || !ValidClient(ClientID))
+			return;
+
+		pMob->m_Complete.reset(ClientID);
+		if(pMob->m_Active.test(ClientID))
+			return;
+		pMob->m_Active.set(ClientID);
+		std::vector<int>& vMobs = m_avMobs[ClientID];
+		vMobs.insert(std::lower_bound(vMobs.begin(), vMobs.end(), MobID), MobID);
+	}
+
+	// only counts for clients the mob is active for
+	void Defeat(int MobID, int ClientID)
+	{
+		CMob* pMob = Find(MobID);
+		if(pMob && ValidClient(ClientID) && pMob->m_Active.test(ClientID))
+			pMob->m_Complete.set(ClientID);
+	}
+
+	// the client is done with the mob, returns true if no client is left on it
+	bool Finish(int MobID, int ClientID)
+	{
+		CMob* pMob = Find(MobID);
+		if(!pMob)
+			return true;
+		if(ValidClient(ClientID) && pMob->m_Active.test(ClientID))
+			Leave(MobID, *pMob, ClientID);
+		return pMob->m_Active.none();
+	}
+
+	// the client leaves every mob at once
+	void Abandon(int ClientID)
+	{
+		if(!ValidClient(ClientID))
+			return;
+
+		const std::vector<int> vMobs = m_avMobs[ClientID];
+		for(int MobID : vMobs)
+			Leave(MobID, m_aMobs[MobID], ClientID);
+	}
+
+	// bit tests, a mob that is not spawned has no clients
+	bool IsActive(int MobID, int ClientID) const
+	{
+		const CMob* pMob = Find(MobID);
+		return pMob && ValidClient(ClientID) && pMob->m_Active.test(ClientID);
+	}
+	bool IsComplete(int MobID, int ClientID) const
+	{
+		const CMob* pMob = Find(MobID);
+		return pMob && ValidClient(ClientID) && pMob->m_Complete.test(ClientID);
+	}
+	ClientMask Active(int MobID) const
+	{
+		const CMob* pMob = Find(MobID);
+		return pMob ? pMob->m_Active : ClientMask();
+	}
+
+	// sorted IDs of the mobs the client is active for
+	const std::vector<int>& Mobs(int ClientID) const
+	{
+		static const std::vector<int> s_vEmpty;
+		return ValidClient(ClientID) ? m_avMobs[ClientID] : s_vEmpty;
+	}
+};
+
+#endif
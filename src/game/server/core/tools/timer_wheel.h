@@ -0,0 +1,109 @@
+/* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
+/* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#ifndef GAME_SERVER_CORE_TOOLS_TIMER_WHEEL_H
+#define GAME_SERVER_CORE_TOOLS_TIMER_WHEEL_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+/*
+ * Tick driven timer wheel for work deferred on the game thread
+ * Items are hashed into a slot by their due tick, advancing the wheel only looks at
+ * the slots of the ticks that passed. Items further away than one turn wait in their
+ * slot for later turns. Items fire exactly once, ordered by due tick and then by the
+ * order they were scheduled in, also after a jump over many ticks.
+ */
+template < typename T >
+class CTimerWheel
+{
+public:
+	enum
+	{
+		NUM_SLOTS = 256,
+	};
+
+	// an item due at or before the last advanced tick fires with the next advance
+	void Schedule(int64_t DueTick, T Item)
+	{
+		if(m_CurrentTick >= 0)
+			DueTick = std::max(DueTick, m_CurrentTick + 1);
+		m_aSlots[DueTick & (NUM_SLOTS - 1)].push_back({DueTick, m_NextOrder++, std::move(Item)});
+		m_Size++;
+	}
+
+	// fires Fn(Item) for everything due up to Tick, Fn may schedule again
+	template < typename F >
+	void Advance(int64_t Tick, F&& Fn)
+	{
+		// the first advance looks at every slot, items may have been scheduled before
+		if(m_CurrentTick < 0)
+			m_CurrentTick = Tick - NUM_SLOTS;
+		if(Tick <= m_CurrentTick || !m_Size)
+		{
+			m_CurrentTick = std::max(m_CurrentTick, Tick);
+			return;
+		}
+
+		// a jump over a full turn visits every slot once
+		const int64_t First = m_CurrentTick + 1;
+		const int64_t Last = std::min(Tick, First + NUM_SLOTS - 1);
+		m_CurrentTick = Tick;
+		for(int64_t Slot = First; Slot <= Last; Slot++)
+		{
+			auto& vSlot = m_aSlots[Slot & (NUM_SLOTS - 1)];
+			auto Split = std::stable_partition(vSlot.begin(), vSlot.end(), [Tick](const CEntry& Entry) { return Entry.m_DueTick > Tick; });
+			std::move(Split, vSlot.end(), std::back_inserter(m_vFiring));
+			vSlot.erase(Split, vSlot.end());
+		}
+		Fire(Fn);
+	}
+
+	// fires everything left regardless of the due tick (shutdown)
+	template < typename F >
+	void Drain(F&& Fn)
+	{
+		for(auto& vSlot : m_aSlots)
+		{
+			std::move(vSlot.begin(), vSlot.end(), std::back_inserter(m_vFiring));
+			vSlot.clear();
+		}
+		Fire(Fn);
+	}
+
+	size_t Size() const { return m_Size; }
+
+private:
+	struct CEntry
+	{
+		int64_t m_DueTick;
+		uint64_t m_Order;
+		T m_Item;
+	};
+
+	template < typename F >
+	void Fire(F&& Fn)
+	{
+		std::sort(m_vFiring.begin(), m_vFiring.end(), [](const CEntry& Left, const CEntry& Right)
+		{
+			return Left.m_DueTick != Right.m_DueTick ? Left.m_DueTick < Right.m_DueTick : Left.m_Order < Right.m_Order;
+		});
+
+		// taken out first, Fn may schedule and even advance again
+		std::vector<CEntry> vFiring;
+		vFiring.swap(m_vFiring);
+		m_Size -= vFiring.size();
+		for(auto& Entry : vFiring)
+			Fn(Entry.m_Item);
+	}
+
+	std::array<std::vector<CEntry>, NUM_SLOTS> m_aSlots;
+	std::vector<CEntry> m_vFiring;
+	int64_t m_CurrentTick = -1;
+	uint64_t m_NextOrder = 0;
+	size_t m_Size = 0;
+};
+
+#endif
@@ -83,7 +83,7 @@ void CVoteGroup::SetVoteTitleImpl(const char* pCmd, int SettingsID1, int Setting
 	va_list VarArgs;
 	va_start(VarArgs, pText);
 	dynamic_string Buffer;
-	Instance::Server()->Localization()->Format_VL(Buffer, m_pPlayer->GetLanguage(), pText, VarArgs);
+	Instance::Server()->Localization()->Format_VL(Buffer, m_pPlayer->GetLanguageIndex(), pText, VarArgs);
 	va_end(VarArgs);
 
 	const char* pAppend = "\0";
@@ -137,7 +137,7 @@ void CVoteGroup::AddVoteImpl(const char* pCmd, int Settings1, int Settings2, con
 	va_list VarArgs;
 	va_start(VarArgs, pText);
 	dynamic_string Buffer;
-	Instance::Server()->Localization()->Format_VL(Buffer, m_pPlayer->GetLanguage(), pText, VarArgs);
+	Instance::Server()->Localization()->Format_VL(Buffer, m_pPlayer->GetLanguageIndex(), pText, VarArgs);
 	va_end(VarArgs);
 
 	// Reformatting
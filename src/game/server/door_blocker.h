@@ -0,0 +1,162 @@
+/* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
+/* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#ifndef GAME_SERVER_DOOR_BLOCKER_H
+#define GAME_SERVER_DOOR_BLOCKER_H
+
+#include <base/math.h>
+#include <base/vmath.h>
+#include <engine/shared/protocol.h>
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+/*
+ * Broad phase for door and wall segments. The characters are bucketed into a
+ * grid once per tick, a door then only looks at the cells its segment passes
+ * near instead of at every character. The exact distance test stays with the
+ * caller. Access checks are cached per owner (house, guild) for the tick, so
+ * the doors of one house ask for a client's access only once.
+ */
+class CDoorBlockerSystem
+{
+public:
+	enum
+	{
+		CELL_SIZE = 128,
+		// characters only move in TickDeferred or through ChangePosition, which rebuilds, this is a safety pad
+		CELL_MARGIN = 64,
+	};
+
+	// registers a segment, doors sharing pAccessOwner share their access cache
+	int AddSegment(vec2 From, vec2 To, const void* pAccessOwner = nullptr)
+	{
+		int Group = -1;
+		if(pAccessOwner)
+		{
+			auto Iter = m_AccessGroups.find(pAccessOwner);
+			if(Iter == m_AccessGroups.end())
+			{
+				Iter = m_AccessGroups.emplace(pAccessOwner, (int)m_vGroups.size()).first;
+				m_vGroups.emplace_back();
+			}
+			Group = Iter->second;
+		}
+
+		CSegment Segment { From, To, Group, true };
+		if(!m_vFreeSegments.empty())
+		{
+			const int ID = m_vFreeSegments.back();
+			m_vFreeSegments.pop_back();
+			m_vSegments[ID] = Segment;
+			return ID;
+		}
+		m_vSegments.push_back(Segment);
+		return (int)m_vSegments.size() - 1;
+	}
+
+	void RemoveSegment(int ID)
+	{
+		if(ID < 0 || ID >= (int)m_vSegments.size() || !m_vSegments[ID].m_Used)
+			return;
+		m_vSegments[ID].m_Used = false;
+		m_vFreeSegments.push_back(ID);
+	}
+
+	// the buckets are rebuilt on the first query of a tick, or earlier after characters came or went
+	void MarkDirty() { m_Dirty = true; }
+	bool NeedsRebuild(int Tick) const { return m_Dirty || Tick != m_BuiltTick; }
+
+	void BeginRebuild(int Tick)
+	{
+		m_vBodies.clear();
+		m_BuiltTick = Tick;
+		m_Dirty = false;
+		for(auto& Group : m_vGroups)
+		{
+			Group.m_Known.reset();
+			Group.m_Allowed.reset();
+		}
+	}
+	void AddBody(int ClientID, vec2 Pos) { m_vBodies.push_back({CellKey(CellCoord(Pos.x), CellCoord(Pos.y)), ClientID}); }
+	void EndRebuild() { std::sort(m_vBodies.begin(), m_vBodies.end()); }
+
+	// calls Fn(ClientID) for the bodies in the cells within Radius of the segment
+	template < typename F >
+	void ForEachCandidate(int ID, float Radius, F&& Fn) const
+	{
+		const CSegment& Segment = m_vSegments[ID];
+		const float Pad = Radius + (float)CELL_MARGIN;
+		const int MinX = CellCoord(minimum(Segment.m_From.x, Segment.m_To.x) - Pad);
+		const int MaxX = CellCoord(maximum(Segment.m_From.x, Segment.m_To.x) + Pad);
+		const int MinY = CellCoord(minimum(Segment.m_From.y, Segment.m_To.y) - Pad);
+		const int MaxY = CellCoord(maximum(Segment.m_From.y, Segment.m_To.y) + Pad);
+
+		// a row of cells is one contiguous range of the sorted keys
+		for(int y = MinY; y <= MaxY; y++)
+		{
+			const int64_t Last = CellKey(MaxX, y);
+			auto Iter = std::lower_bound(m_vBodies.begin(), m_vBodies.end(), CBody {CellKey(MinX, y), -1});
+			for(; Iter != m_vBodies.end() && Iter->m_Key <= Last; ++Iter)
+				Fn(Iter->m_ClientID);
+		}
+	}
+
+	// cached for the tick per access owner, Compute() is called once per client
+	template < typename F >
+	bool HasAccess(int ID, int ClientID, F&& Compute)
+	{
+		const int Group = m_vSegments[ID].m_Group;
+		if(Group < 0)
+			return Compute();
+
+		CAccessGroup& Access = m_vGroups[Group];
+		if(!Access.m_Known.test(ClientID))
+		{
+			Access.m_Known.set(ClientID);
+			Access.m_Allowed.set(ClientID, Compute());
+		}
+		return Access.m_Allowed.test(ClientID);
+	}
+
+	vec2 GetFrom(int ID) const { return m_vSegments[ID].m_From; }
+	vec2 GetTo(int ID) const { return m_vSegments[ID].m_To; }
+
+private:
+	struct CSegment
+	{
+		vec2 m_From;
+		vec2 m_To;
+		int m_Group;
+		bool m_Used;
+	};
+
+	struct CBody
+	{
+		int64_t m_Key;
+		int m_ClientID;
+		bool operator<(const CBody& Other) const { return m_Key < Other.m_Key || (m_Key == Other.m_Key && m_ClientID < Other.m_ClientID); }
+	};
+
+	struct CAccessGroup
+	{
+		std::bitset<MAX_CLIENTS> m_Known;
+		std::bitset<MAX_CLIENTS> m_Allowed;
+	};
+
+	static int CellCoord(float Value) { return (int)std::floor(Value / (float)CELL_SIZE); }
+	static int64_t CellKey(int x, int y) { return ((int64_t)(y + (1 << 20)) << 32) | (int64_t)(x + (1 << 20)); }
+
+	std::vector<CSegment> m_vSegments;
+	std::vector<int> m_vFreeSegments;
+	std::vector<CBody> m_vBodies;
+	std::vector<CAccessGroup> m_vGroups;
+	std::map<const void*, int> m_AccessGroups;
+	int m_BuiltTick = -1;
+	bool m_Dirty = true;
+};
+
+#endif
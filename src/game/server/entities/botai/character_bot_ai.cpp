@@ -210,11 +210,8 @@ void CCharacterBotAI::RewardPlayer(CPlayer* pPlayer, vec2 Force) const
 	// Check if the bot type is TYPE_BOT_QUEST_MOB and the killer is active for the client
 	if(m_pBotPlayer->GetBotType() == TYPE_BOT_QUEST_MOB)
 	{
-		if(m_pBotPlayer->GetQuestBotMobInfo().m_ActiveForClient[ClientID])
-		{
-			// Set the completion status for the killer to true
-			m_pBotPlayer->GetQuestBotMobInfo().m_CompleteClient[ClientID] = true;
-		}
+		// Set the completion status for the killer, only counts if the mob is active for the killer
+		m_pBotPlayer->QuestMobInterest().Defeat(m_pBotPlayer->GetCID(), ClientID);
 	}
 
 	// Check if the bot is a mob type
@@ -316,8 +313,9 @@ void CCharacterBotAI::Tick()
 		SetSafe();
 	}
 
-	// engine bots
-	HandleBot();
+	// engine bots, far bots think less often while their core keeps stepping with the last input
+	if(GameWorld()->IsBotThinkTick(m_pBotPlayer->GetCID()))
+		HandleBot();
 	HandleTilesets();
 	HandleTuning();
 
@@ -418,7 +416,7 @@ void CCharacterBotAI::Snap(int SnappingClient)
 	}
 	else if(m_pBotPlayer->GetBotType() == TYPE_BOT_QUEST_MOB)
 	{
-		bool IsActiveForSnappingClient = m_pBotPlayer->GetQuestBotMobInfo().m_ActiveForClient[SnappingClient];
+		bool IsActiveForSnappingClient = m_pBotPlayer->IsQuestMobActiveFor(SnappingClient);
 		DDNetFlag(CHARACTERFLAG_SOLO, !IsActiveForSnappingClient)
 			DDNetFlag(CHARACTERFLAG_COLLISION_DISABLED, !IsActiveForSnappingClient)
 	}
@@ -903,7 +901,7 @@ void CCharacterBotAI::Move()
 		}
 		else if(m_Core.m_HookState == HOOK_FLYING)
 			m_Input.m_Hook = 1;
-		else if(m_LatestInput.m_Hook == 0 && m_Core.m_HookState == HOOK_IDLE && rand() % 3 == 0)
+		else if(m_LatestInput.m_Hook == 0 && m_Core.m_HookState == HOOK_IDLE && GameWorld()->GetBotLod(m_pBotPlayer->GetCID()) != BotLod::MINIMAL && rand() % 3 == 0)
 		{
 			int NumDir = 45;
 			vec2 HookDir(0.0f, 0.0f);
@@ -1002,7 +1000,7 @@ CPlayer* CCharacterBotAI::SearchPlayer(float Distance) const
 			continue;
 
 		// Skip the iteration if the bot is a quest mob type and the player is not active for the bot
-		if(m_pBotPlayer->GetBotType() == TYPE_BOT_QUEST_MOB && !m_pBotPlayer->GetQuestBotMobInfo().m_ActiveForClient[i])
+		if(m_pBotPlayer->GetBotType() == TYPE_BOT_QUEST_MOB && !m_pBotPlayer->IsQuestMobActiveFor(i))
 			continue;
 
 		// Check if the bot is a npc type
@@ -1087,7 +1085,7 @@ CPlayer* CCharacterBotAI::SearchTankPlayer(float Distance)
 	for(int i = 0; i < MAX_PLAYERS; i++)
 	{
 		// Skip the iteration if the bot is a quest mob type and the player is not active for the bot
-		if(m_pBotPlayer->GetBotType() == TYPE_BOT_QUEST_MOB && !m_pBotPlayer->GetQuestBotMobInfo().m_ActiveForClient[i])
+		if(m_pBotPlayer->GetBotType() == TYPE_BOT_QUEST_MOB && !m_pBotPlayer->IsQuestMobActiveFor(i))
 			continue;
 
 		// check the distance of the player
@@ -1141,7 +1139,7 @@ CPlayerBot* CCharacterBotAI::SearchMob(float Distance) const
 			if(m_pBotPlayer->GetEidolonOwner())
 			{
 				// Check if the bot player is of type "TYPE_BOT_QUEST_MOB" and if the quest bot mob is active for the client at index i
-				if(SearchBotType == TYPE_BOT_QUEST_MOB && !pSearchTarget->GetQuestBotMobInfo().m_ActiveForClient[m_pBotPlayer->GetEidolonOwner()->GetCID()])
+				if(SearchBotType == TYPE_BOT_QUEST_MOB && !pSearchTarget->IsQuestMobActiveFor(m_pBotPlayer->GetEidolonOwner()->GetCID()))
 					continue;
 
 				// Check if the search bot type is TYPE_BOT_NPC and the relationship with the eidolon owner is not deteriorated to the maximum level
@@ -1359,8 +1359,8 @@ bool CCharacter::IsAllowedPVP(int FromID) const
 
 	// Allow damage if the player is a bot and is a quest mob, and the quest mob is active for the client, and the damage is coming from another player who is not a bot
 	// OR if the damage is coming from another bot who is a quest mob, and the quest mob is active for the player, and the player is not a bot
-	if((m_pPlayer->GetBotType() == TYPE_BOT_QUEST_MOB && dynamic_cast<CPlayerBot*>(m_pPlayer)->GetQuestBotMobInfo().m_ActiveForClient[FromID] && !pFrom->IsBot()) ||
-		(pFrom->GetBotType() == TYPE_BOT_QUEST_MOB && dynamic_cast<CPlayerBot*>(pFrom)->GetQuestBotMobInfo().m_ActiveForClient[m_pPlayer->GetCID()] && !m_pPlayer->IsBot()))
+	if((m_pPlayer->GetBotType() == TYPE_BOT_QUEST_MOB && dynamic_cast<CPlayerBot*>(m_pPlayer)->IsQuestMobActiveFor(FromID) && !pFrom->IsBot()) ||
+		(pFrom->GetBotType() == TYPE_BOT_QUEST_MOB && dynamic_cast<CPlayerBot*>(pFrom)->IsQuestMobActiveFor(m_pPlayer->GetCID()) && !m_pPlayer->IsBot()))
 	{
 		return true;
 	}
@@ -1372,7 +1372,7 @@ bool CCharacter::IsAllowedPVP(int FromID) const
 		// Also, check if the bot type is TYPE_BOT_NPC and the function of the NPC bot is FUNCTION_NPC_GUARDIAN
 		// If any of these conditions are true, return true, otherwise return false.
 		if(m_pPlayer->GetBotType() == TYPE_BOT_MOB ||
-			(m_pPlayer->GetBotType() == TYPE_BOT_QUEST_MOB && dynamic_cast<CPlayerBot*>(m_pPlayer)->GetQuestBotMobInfo().m_ActiveForClient[FromID]) ||
+			(m_pPlayer->GetBotType() == TYPE_BOT_QUEST_MOB && dynamic_cast<CPlayerBot*>(m_pPlayer)->IsQuestMobActiveFor(FromID)) ||
 			(m_pPlayer->GetBotType() == TYPE_BOT_NPC && NpcBotInfo::ms_aNpcBot[m_pPlayer->GetBotMobID()].m_Function == FUNCTION_NPC_GUARDIAN))
 		{
 			return true;
@@ -1459,6 +1459,7 @@ void CCharacter::ChangePosition(vec2 NewPos)
 	m_Core.m_Pos = NewPos;
 	m_Pos = NewPos;
 	ResetHook();
+	GameWorld()->DoorBlockers()->MarkDirty();
 }
 
 void CCharacter::ResetDoorPos()
@@ -5,6 +5,7 @@
 #include <engine/storage.h>
 #include <engine/map.h>
 #include <engine/shared/config.h>
+#include <engine/shared/jsonwriter.h>
 
 #include <game/gamecore.h>
 #include <game/layers.h>
@@ -43,11 +44,16 @@ CGS::CGS()
 	for(auto& pBroadcastState : m_aBroadcastStates)
 	{
 		pBroadcastState.m_NoChangeTick = 0;
+		pBroadcastState.m_NextSendTick = 0;
+		pBroadcastState.m_PrevHash = 0;
+		pBroadcastState.m_PrevMessageHash = 0;
 		pBroadcastState.m_LifeSpanTick = 0;
 		pBroadcastState.m_NextMessage[0] = 0;
 		pBroadcastState.m_TimedMessage[0] = 0;
-		pBroadcastState.m_PrevMessage[0] = 0;
+		pBroadcastState.m_aCompleteMsg[0] = 0;
+		pBroadcastState.m_Updated = false;
 		pBroadcastState.m_NextPriority = BroadcastPriority::LOWER;
+		pBroadcastState.m_TimedPriority = BroadcastPriority::LOWER;
 	}
 
 	for(auto& apPlayer : m_apPlayers)
@@ -351,7 +357,7 @@ void CGS::Chat(int ClientID, const char* pText, ...)
 	{
 		if(m_apPlayers[i])
 		{
-			Server()->Localization()->Format_VL(Buffer, m_apPlayers[i]->GetLanguage(), pText, VarArgs);
+			Server()->Localization()->Format_VL(Buffer, m_apPlayers[i]->GetLanguageIndex(), pText, VarArgs);
 
 			Msg.m_pMessage = Buffer.buffer();
 			Server()->SendPackMsg(&Msg, MSGFLAG_VITAL, i);
@@ -376,7 +382,7 @@ bool CGS::ChatAccount(int AccountID, const char* pText, ...)
 	va_start(VarArgs, pText);
 
 	dynamic_string Buffer;
-	Server()->Localization()->Format_VL(Buffer, pPlayer->GetLanguage(), pText, VarArgs);
+	Server()->Localization()->Format_VL(Buffer, pPlayer->GetLanguageIndex(), pText, VarArgs);
 
 	Msg.m_pMessage = Buffer.buffer();
 	Server()->SendPackMsg(&Msg, MSGFLAG_VITAL, pPlayer->GetCID());
@@ -404,7 +410,7 @@ void CGS::ChatGuild(int GuildID, const char* pText, ...)
 		if(CPlayer* pPlayer = GetPlayer(i, true); pPlayer && pPlayer->Account()->HasGuild() && pPlayer->Account()->GetGuild()->GetID() == GuildID)
 		{
 			Buffer.append("Guild | ");
-			Server()->Localization()->Format_VL(Buffer, m_apPlayers[i]->GetLanguage(), pText, VarArgs);
+			Server()->Localization()->Format_VL(Buffer, m_apPlayers[i]->GetLanguageIndex(), pText, VarArgs);
 
 			Msg.m_pMessage = Buffer.buffer();
 
@@ -437,7 +443,7 @@ void CGS::ChatWorldID(int WorldID, const char* Suffix, const char* pText, ...)
 			Buffer.append(Suffix);
 			Buffer.append(" ");
 		}
-		Server()->Localization()->Format_VL(Buffer, pPlayer->GetLanguage(), pText, VarArgs);
+		Server()->Localization()->Format_VL(Buffer, pPlayer->GetLanguageIndex(), pText, VarArgs);
 
 		Msg.m_pMessage = Buffer.buffer();
 
@@ -489,7 +495,7 @@ void CGS::Motd(int ClientID, const char* Text, ...)
 	va_list VarArgs;
 	va_start(VarArgs, Text);
 	dynamic_string Buffer;
-	Server()->Localization()->Format_VL(Buffer, pPlayer->GetLanguage(), Text, VarArgs);
+	Server()->Localization()->Format_VL(Buffer, pPlayer->GetLanguageIndex(), Text, VarArgs);
 
 	CNetMsg_Sv_Motd Msg;
 	Msg.m_pMessage = Buffer.buffer();
@@ -539,7 +545,7 @@ void CGS::Broadcast(int ClientID, BroadcastPriority Priority, int LifeSpan, cons
 		if(m_apPlayers[i])
 		{
 			dynamic_string Buffer;
-			Server()->Localization()->Format_VL(Buffer, m_apPlayers[i]->GetLanguage(), pText, VarArgs);
+			Server()->Localization()->Format_VL(Buffer, m_apPlayers[i]->GetLanguageIndex(), pText, VarArgs);
 			AddBroadcast(i, Buffer.buffer(), Priority, LifeSpan);
 			Buffer.clear();
 		}
@@ -557,7 +563,7 @@ void CGS::BroadcastWorldID(int WorldID, BroadcastPriority Priority, int LifeSpan
 		if(m_apPlayers[i] && IsPlayerEqualWorld(i, WorldID))
 		{
 			dynamic_string Buffer;
-			Server()->Localization()->Format_VL(Buffer, m_apPlayers[i]->GetLanguage(), pText, VarArgs);
+			Server()->Localization()->Format_VL(Buffer, m_apPlayers[i]->GetLanguageIndex(), pText, VarArgs);
 			AddBroadcast(i, Buffer.buffer(), Priority, LifeSpan);
 			Buffer.clear();
 		}
@@ -565,6 +571,16 @@ void CGS::BroadcastWorldID(int WorldID, BroadcastPriority Priority, int LifeSpan
 	va_end(VarArgs);
 }
 
+// hash of the typed broadcast fields, compared instead of the formatted text
+static unsigned BroadcastStatsHash(unsigned Hash, const CPlayer::CBroadcastStats& Stats)
+{
+	const int aFields[] = { Stats.m_Level, Stats.m_ExpPercent, Stats.m_Health, Stats.m_MaxHealth,
+		Stats.m_Mana, Stats.m_MaxMana, Stats.m_Gold, Stats.m_RecastSeconds };
+	for(int Field : aFields)
+		Hash = Hash * 33 + (unsigned)Field;
+	return Hash;
+}
+
 // the tick of the broadcast and his life
 void CGS::BroadcastTick(int ClientID)
 {
@@ -577,28 +593,44 @@ void CGS::BroadcastTick(int ClientID)
 	{
 		// Get the broadcast state for the given client ID
 		CBroadcastState& Broadcast = m_aBroadcastStates[ClientID];
+		CPlayer* pPlayer = m_apPlayers[ClientID];
 
 		// Check if the broadcast has a lifespan and the timed priority is greater than the next priority
+		BroadcastPriority Priority = Broadcast.m_NextPriority;
 		if(Broadcast.m_LifeSpanTick > 0 && Broadcast.m_TimedPriority > Broadcast.m_NextPriority)
 		{
 			// Copy the timed message to the next message buffer
 			str_copy(Broadcast.m_NextMessage, Broadcast.m_TimedMessage, sizeof(Broadcast.m_NextMessage));
+			Priority = Broadcast.m_TimedPriority;
 		}
 
-		//Send broadcast only if the message is different, or to fight auto-fading
-		if(Broadcast.m_Updated || str_comp(Broadcast.m_PrevMessage, Broadcast.m_NextMessage) != 0 || Broadcast.m_NoChangeTick < Server()->Tick())
+		// Collect the typed fields, basic stats are hidden while main information is shown
+		const bool ShowStats = Broadcast.m_TimedPriority < BroadcastPriority::MAIN_INFORMATION;
+		const char* pMessage = ShowStats && (pPlayer->m_PlayerFlags & PLAYERFLAG_CHATTING) ? "\0" : Broadcast.m_NextMessage;
+		CPlayer::CBroadcastStats Stats {};
+		const bool HasStats = ShowStats && pPlayer->GetBroadcastStats(&Stats);
+
+		// Compare the content hash, nothing is formatted while it stays the same
+		const unsigned MessageHash = str_quickhash(pMessage) * 33 + (unsigned)ShowStats;
+		const unsigned Hash = HasStats ? BroadcastStatsHash(MessageHash, Stats) : MessageHash;
+		const bool Changed = Broadcast.m_Updated || Hash != Broadcast.m_PrevHash;
+
+		// Changes are coalesced to sv_broadcast_rate sends per second, a new important message goes out at once
+		const bool Urgent = Changed && MessageHash != Broadcast.m_PrevMessageHash && Priority >= BroadcastPriority::GAME_PRIORITY;
+		const bool Send = (Changed && (Urgent || Broadcast.m_NextSendTick <= Server()->Tick()));
+
+		// Send broadcast only if the content is different, or to fight auto-fading
+		if(Send || Broadcast.m_NoChangeTick < Server()->Tick())
 		{
-			// Check if the timed priority of the broadcast is less than MAIN_INFORMATION
-			if(Broadcast.m_TimedPriority < BroadcastPriority::MAIN_INFORMATION)
+			// The fade keepalive resends the last complete message as is
+			if(Changed)
 			{
-				// Format the broadcast message with basic player stats and append pAppend
-				const char* pAppend = m_apPlayers[ClientID]->m_PlayerFlags & PLAYERFLAG_CHATTING ? "\0" : Broadcast.m_NextMessage;
-				m_apPlayers[ClientID]->FormatBroadcastBasicStats(Broadcast.m_aCompleteMsg, sizeof(Broadcast.m_aCompleteMsg), pAppend);
-			}
-			else
-			{
-				// Copy aBufAppend into the complete message buffer
-				str_copy(Broadcast.m_aCompleteMsg, Broadcast.m_NextMessage, sizeof(Broadcast.m_aCompleteMsg));
+				if(HasStats)
+					pPlayer->FormatBroadcastBasicStats(Broadcast.m_aCompleteMsg, sizeof(Broadcast.m_aCompleteMsg), Stats, pMessage);
+				else if(ShowStats)
+					Broadcast.m_aCompleteMsg[0] = '\0';
+				else
+					str_copy(Broadcast.m_aCompleteMsg, pMessage, sizeof(Broadcast.m_aCompleteMsg));
 			}
 
 			// Create a broadcast net message and send
@@ -606,10 +638,11 @@ void CGS::BroadcastTick(int ClientID)
 			Msg.m_pMessage = Broadcast.m_aCompleteMsg;
 			Server()->SendPackMsg(&Msg, MSGFLAG_VITAL, ClientID);
 
-			// Reset the complete message buffer and no change tick
-			str_copy(Broadcast.m_PrevMessage, Broadcast.m_NextMessage, sizeof(Broadcast.m_PrevMessage));
-			Broadcast.m_aCompleteMsg[0] = '\0';
+			// Remember the sent content and schedule the next possible send
+			Broadcast.m_PrevHash = Hash;
+			Broadcast.m_PrevMessageHash = MessageHash;
 			Broadcast.m_Updated = false;
+			Broadcast.m_NextSendTick = Server()->Tick() + maximum(1, Server()->TickSpeed() / g_Config.m_SvBroadcastRate);
 			Broadcast.m_NoChangeTick = Server()->Tick() + (Server()->TickSpeed() * 3);
 		}
 
@@ -636,9 +669,12 @@ void CGS::BroadcastTick(int ClientID)
 		m_aBroadcastStates[ClientID].m_LifeSpanTick = 0;
 		m_aBroadcastStates[ClientID].m_NextPriority = BroadcastPriority::LOWER;
 		m_aBroadcastStates[ClientID].m_TimedPriority = BroadcastPriority::LOWER;
-		m_aBroadcastStates[ClientID].m_PrevMessage[0] = 0;
+		m_aBroadcastStates[ClientID].m_PrevHash = 0;
+		m_aBroadcastStates[ClientID].m_PrevMessageHash = 0;
+		m_aBroadcastStates[ClientID].m_NextSendTick = 0;
 		m_aBroadcastStates[ClientID].m_NextMessage[0] = 0;
 		m_aBroadcastStates[ClientID].m_TimedMessage[0] = 0;
+		m_aBroadcastStates[ClientID].m_aCompleteMsg[0] = 0;
 		m_aBroadcastStates[ClientID].m_Updated = false;
 	}
 }
@@ -800,6 +836,15 @@ void CGS::OnTick()
 }
 
 // Here we use functions that can have static data or functions that don't need to be called in all worlds
+void CGS::OnWakeUp(int SkippedTicks)
+{
+	// Countdowns did not run while the world was dormant, deadlines that passed in
+	// the meantime (bot respawns) are due now and resolve in this catch-up tick
+	if(g_Config.m_Debug)
+		dbg_msg("world", "'%s' woke up after %d seconds", Server()->GetWorldName(m_WorldID), SkippedTicks / Server()->TickSpeed());
+	OnTick();
+}
+
 void CGS::OnTickGlobal()
 {
 	// Check if the day enum type has changed
@@ -1300,21 +1345,29 @@ void CGS::OnClientPredictedInput(int ClientID, void* pInput)
 	m_apPlayers[ClientID]->OnPredictedInput((CNetObj_PlayerInput*)pInput);
 }
 
-void CGS::OnUpdatePlayerServerInfo(nlohmann::json* pJson, int ClientID)
+void CGS::OnUpdatePlayerServerInfo(CJsonWriter* pJson, int ClientID)
 {
 	CPlayer* pPlayer = GetPlayer(ClientID);
 	if(!pPlayer)
 		return;
 
 	CTeeInfo& TeeInfo = m_apPlayers[ClientID]->GetTeeInfo();
-	(*pJson)["skin"]["name"] = TeeInfo.m_aSkinName;
+	pJson->WriteAttribute("skin");
+	pJson->BeginObject();
+	pJson->WriteAttribute("name");
+	pJson->WriteStrValue(TeeInfo.m_aSkinName);
 	if(TeeInfo.m_UseCustomColor)
 	{
-		(*pJson)["skin"]["color_body"] = TeeInfo.m_ColorBody;
-		(*pJson)["skin"]["color_feet"] = TeeInfo.m_ColorFeet;
+		pJson->WriteAttribute("color_body");
+		pJson->WriteIntValue(TeeInfo.m_ColorBody);
+		pJson->WriteAttribute("color_feet");
+		pJson->WriteIntValue(TeeInfo.m_ColorFeet);
 	}
-	(*pJson)["afk"] = false;
-	(*pJson)["team"] = m_apPlayers[ClientID]->GetTeam();
+	pJson->EndObject();
+	pJson->WriteAttribute("afk");
+	pJson->WriteBoolValue(false);
+	pJson->WriteAttribute("team");
+	pJson->WriteIntValue(m_apPlayers[ClientID]->GetTeam());
 }
 
 // change the world
@@ -1378,6 +1431,10 @@ void CGS::ClearClientData(int ClientID)
 	// clear active snap bots for player
 	for(auto& pActiveSnap : DataBotInfo::ms_aDataBot)
 		pActiveSnap.second.m_aVisibleActive[ClientID] = false;
+
+	// leave the quest mobs of every world
+	for(auto& QuestMobInterest : CPlayerBot::ms_aQuestMobInterest)
+		QuestMobInterest.Abandon(ClientID);
 }
 
 int CGS::GetRank(int AccountID)
@@ -1733,14 +1790,18 @@ int CGS::CreateBot(short BotType, int BotID, int SubID)
 }
 
 // create lol text in the world
-bool CGS::CreateText(CEntity* pParent, bool Follow, vec2 Pos, vec2 Vel, int Lifespan, const char* pText)
+CWorldText* CGS::CreateText(CEntity* pParent, bool Follow, vec2 Pos, vec2 Vel, int Lifespan, const char* pText)
 {
 	if(!IsPlayersNearby(Pos, 800))
-		return false;
+		return nullptr;
 
-	CLoltext Text;
-	Text.Create(&m_World, pParent, Pos, Vel, Lifespan, pText, true, Follow);
-	return true;
+	if(pParent && !Follow)
+	{
+		Pos += pParent->GetPos();
+		pParent = nullptr;
+	}
+
+	return new CWorldText(&m_World, pParent, Pos, Vel, Lifespan, pText, true);
 }
 
 // creates a particle of experience that follows the player
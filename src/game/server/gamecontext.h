@@ -118,7 +118,9 @@ private:
 	struct CBroadcastState
 	{
 		int m_NoChangeTick;
-		char m_PrevMessage[1024];
+		int m_NextSendTick;
+		unsigned m_PrevHash;
+		unsigned m_PrevMessageHash;
 
 		BroadcastPriority m_NextPriority;
 		char m_NextMessage[1024];
@@ -155,6 +157,7 @@ public:
 
 	void OnTick() override;
 	void OnTickGlobal() override;
+	void OnWakeUp(int SkippedTicks) override;
 	void OnPreSnap() override;
 	void OnSnap(int ClientID) override;
 	void OnPostSnap() override;
@@ -167,7 +170,7 @@ public:
 	void OnClientDrop(int ClientID, const char *pReason) override;
 	void OnClientDirectInput(int ClientID, void *pInput) override;
 	void OnClientPredictedInput(int ClientID, void *pInput) override;
-	void OnUpdatePlayerServerInfo(nlohmann::json* pJson, int ClientID) override;
+	void OnUpdatePlayerServerInfo(CJsonWriter* pJson, int ClientID) override;
 	bool IsClientReady(int ClientID) const override;
 	bool IsClientPlayer(int ClientID) const override;
 	bool IsClientCharacterExist(int ClientID) const override;
@@ -220,7 +223,7 @@ public:
 		MMO GAMECONTEXT
 	######################################################################### */
 	int CreateBot(short BotType, int BotID, int SubID);
-	bool CreateText(CEntity* pParent, bool Follow, vec2 Pos, vec2 Vel, int Lifespan, const char* pText);
+	class CWorldText* CreateText(CEntity* pParent, bool Follow, vec2 Pos, vec2 Vel, int Lifespan, const char* pText);
 	void CreateParticleExperience(vec2 Pos, int ClientID, int Experience, vec2 Force = vec2(0.0f, 0.0f));
 	void CreateDropBonuses(vec2 Pos, int Type, int Value, int NumDrop = 1, vec2 Force = vec2(0.0f, 0.0f));
 	void CreateDropItem(vec2 Pos, int ClientID, CItem DropItem, vec2 Force = vec2(0.0f, 0.0f));
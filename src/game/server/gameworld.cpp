@@ -21,6 +21,11 @@ CGameWorld::CGameWorld() : m_pNextTraverseEntity(nullptr), m_Paused(false)
 	m_apEntitiesCollection.reserve(static_cast<size_t>(NUM_ENTITIES * MAX_CLIENTS * 5));
 	m_aMarkedBotsActive.reserve(MAX_CLIENTS);
 	m_aBotsActive.reserve(MAX_CLIENTS);
+
+	for(auto& Lod : m_aBotLod)
+		Lod = BotLod::FULL;
+	for(auto& pChar : m_apDoorCharacters)
+		pChar = nullptr;
 }
 
 CGameWorld::~CGameWorld()
@@ -99,6 +104,9 @@ void CGameWorld::InsertEntity(CEntity* pEnt)
 	pEnt->m_pPrevTypeEntity = nullptr;
 	m_apFirstEntityTypes[pEnt->m_ObjType] = pEnt;
 	m_apEntitiesCollection.emplace(pEnt);
+
+	if(pEnt->m_ObjType == ENTTYPE_CHARACTER)
+		m_DoorBlockers.MarkDirty();
 }
 
 void CGameWorld::DestroyEntity(CEntity* pEnt)
@@ -127,6 +135,9 @@ void CGameWorld::RemoveEntity(CEntity* pEnt)
 	pEnt->m_pNextTypeEntity = nullptr;
 	pEnt->m_pPrevTypeEntity = nullptr;
 	m_apEntitiesCollection.erase(pEnt);
+
+	if(pEnt->m_ObjType == ENTTYPE_CHARACTER)
+		m_DoorBlockers.MarkDirty();
 }
 
 //
@@ -234,6 +245,40 @@ CCharacter* CGameWorld::IntersectCharacter(vec2 Pos0, vec2 Pos1, float Radius, v
 	return pClosest;
 }
 
+int CGameWorld::FindDoorHits(int SegmentID, float Radius, CDoorHit* pHits)
+{
+	// bucket the characters at the first door of the tick
+	if(m_DoorBlockers.NeedsRebuild(Server()->Tick()))
+	{
+		m_DoorBlockers.BeginRebuild(Server()->Tick());
+		std::fill(std::begin(m_apDoorCharacters), std::end(m_apDoorCharacters), nullptr);
+		for(CCharacter* pChar = (CCharacter*)FindFirst(ENTTYPE_CHARACTER); pChar; pChar = (CCharacter*)pChar->TypeNext())
+		{
+			const int ClientID = pChar->GetPlayer()->GetCID();
+			m_apDoorCharacters[ClientID] = pChar;
+			m_DoorBlockers.AddBody(ClientID, pChar->m_Core.m_Pos);
+		}
+		m_DoorBlockers.EndRebuild();
+	}
+
+	// the exact test on the current position, same as a walk over all characters
+	const vec2 From = m_DoorBlockers.GetFrom(SegmentID);
+	const vec2 To = m_DoorBlockers.GetTo(SegmentID);
+	int NumHits = 0;
+	m_DoorBlockers.ForEachCandidate(SegmentID, Radius, [&](int ClientID)
+	{
+		CCharacter* pChar = m_apDoorCharacters[ClientID];
+		vec2 IntersectPos;
+		if(!pChar || !pChar->IsAlive() || !closest_point_on_line(From, To, pChar->m_Core.m_Pos, IntersectPos))
+			return;
+
+		const float Distance = distance(IntersectPos, pChar->m_Core.m_Pos);
+		if(Distance <= Radius)
+			pHits[NumHits++] = { pChar, Distance };
+	});
+	return NumHits;
+}
+
 bool CGameWorld::IntersectClosestEntity(vec2 Pos, float Radius, int EnttypeID)
 {
 	for(CEntity* pDoor = FindFirst(EnttypeID); pDoor; pDoor = pDoor->TypeNext())
@@ -297,6 +342,8 @@ void CGameWorld::UpdatePlayerMaps()
 		return;
 
 	std::pair<float, int> Dist[MAX_CLIENTS];
+	float aNearestPlayer[MAX_CLIENTS];
+	std::fill(std::begin(aNearestPlayer), std::end(aNearestPlayer), 1e10f);
 	for(int ClientID = 0; ClientID < MAX_PLAYERS; ClientID++)
 	{
 		CPlayer* pPlayer = GS()->m_apPlayers[ClientID];
@@ -322,6 +369,7 @@ void CGameWorld::UpdatePlayerMaps()
 
 			// Calculate the distance between the player's view position and the bot's position
 			float Distance = distance(pPlayer->m_ViewPos, pBotPlayer->GetCharacter()->m_Core.m_Pos);
+			aNearestPlayer[j] = minimum(aNearestPlayer[j], Distance);
 			if(Distance > (float)g_Config.m_SvMapDistanceActveBot)
 			{
 				// If the distance is greater
@@ -403,4 +451,19 @@ void CGameWorld::UpdatePlayerMaps()
 
 	// Clear the list of marked active bots.
 	m_aMarkedBotsActive.clear();
+
+	// Bucket the bots by the distance to the nearest player, eidolons follow their owner at full rate
+	for(int i = MAX_PLAYERS; i < MAX_CLIENTS; i++)
+	{
+		CPlayerBot* pBotPlayer = dynamic_cast<CPlayerBot*>(GS()->m_apPlayers[i]);
+		if(!pBotPlayer || pBotPlayer->GetBotType() == TYPE_BOT_EIDOLON)
+			m_aBotLod[i] = BotLod::FULL;
+		else
+			m_aBotLod[i] = CBotLodScheduler::Classify(aNearestPlayer[i], (float)g_Config.m_SvBotLodFull, (float)g_Config.m_SvBotLodReduced);
+	}
+}
+
+bool CGameWorld::IsBotThinkTick(int ClientID) const
+{
+	return CBotLodScheduler::IsThinkTick(m_aBotLod[ClientID], Server()->Tick(), ClientID);
 }
\ No newline at end of file
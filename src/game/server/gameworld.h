@@ -5,6 +5,9 @@
 
 #include <game/gamecore.h>
 
+#include "bot_lod.h"
+#include "door_blocker.h"
+
 class CEntity;
 class CCharacter;
 
@@ -68,7 +71,10 @@ private:
 	CEntity *m_apFirstEntityTypes[NUM_ENTTYPES];
 	ska::unordered_set<int> m_aMarkedBotsActive;
 	ska::unordered_map<int, bool> m_aBotsActive;
+	BotLod m_aBotLod[MAX_CLIENTS];
 	ska::flat_hash_set<CEntity*> m_apEntitiesCollection;
+	CDoorBlockerSystem m_DoorBlockers;
+	class CCharacter* m_apDoorCharacters[MAX_CLIENTS];
 
 	class CGS *m_pGS;
 	class IServer *m_pServer;
@@ -87,6 +93,29 @@ public:
 	void SetGameServer(CGS *pGS);
 	void UpdatePlayerMaps();
 	bool IsBotActive(int ClientID) { return m_aBotsActive[ClientID]; }
+	BotLod GetBotLod(int ClientID) const { return m_aBotLod[ClientID]; }
+	bool IsBotThinkTick(int ClientID) const;
+
+	struct CDoorHit
+	{
+		class CCharacter* m_pChar;
+		float m_Distance;
+	};
+	CDoorBlockerSystem* DoorBlockers() { return &m_DoorBlockers; }
+
+	/*
+		Function: FindDoorHits
+			Finds the characters close to a door segment registered in DoorBlockers().
+
+		Arguments:
+			SegmentID - Segment returned by CDoorBlockerSystem::AddSegment.
+			Radius - How close to the segment the characters have to be.
+			pHits - Array of MAX_CLIENTS hits to fill.
+
+		Returns:
+			Number of characters found.
+	*/
+	int FindDoorHits(int SegmentID, float Radius, CDoorHit* pHits);
 
 	CEntity *FindFirst(int Type);
 
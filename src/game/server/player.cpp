@@ -764,6 +764,11 @@ const char* CPlayer::GetLanguage() const
 	return Server()->GetClientLanguage(m_ClientID);
 }
 
+int CPlayer::GetLanguageIndex() const
+{
+	return Server()->GetClientLanguageIndex(m_ClientID);
+}
+
 void CPlayer::UpdateTempData(int Health, int Mana)
 {
 	GetTempData().m_TempHealth = Health;
@@ -799,28 +804,33 @@ int64_t CPlayer::GetAfkTime() const
 	return m_Afk ? ((time_get() - m_LastPlaytime) / time_freq()) - g_Config.m_SvMaxAfkTime : 0;
 }
 
-void CPlayer::FormatBroadcastBasicStats(char* pBuffer, int Size, const char* pAppendStr)
+bool CPlayer::GetBroadcastStats(CBroadcastStats* pStats)
 {
 	if(!IsAuthed() || !m_pCharacter)
-		return;
+		return false;
 
-	const int LevelPercent = translate_to_percent((int)computeExperience(Account()->GetLevel()), Account()->GetExperience());
-	const int MaximumHealth = GetStartHealth();
-	const int MaximumMana = GetStartMana();
-	const int Health = m_pCharacter->Health();
-	const int Mana = m_pCharacter->Mana();
-	const int Gold = GetItem(itGold)->GetValue();
+	pStats->m_Level = Account()->GetLevel();
+	pStats->m_ExpPercent = translate_to_percent((int)computeExperience(Account()->GetLevel()), Account()->GetExperience());
+	pStats->m_Health = m_pCharacter->Health();
+	pStats->m_MaxHealth = GetStartHealth();
+	pStats->m_Mana = m_pCharacter->Mana();
+	pStats->m_MaxMana = GetStartMana();
+	pStats->m_Gold = GetItem(itGold)->GetValue();
+	pStats->m_RecastSeconds = -1;
+	if(m_aPlayerTick[PotionRecast] > Server()->Tick())
+		pStats->m_RecastSeconds = maximum(0, (m_aPlayerTick[PotionRecast] - Server()->Tick()) / Server()->TickSpeed());
+	return true;
+}
 
+void CPlayer::FormatBroadcastBasicStats(char* pBuffer, int Size, const CBroadcastStats& Stats, const char* pAppendStr) const
+{
 	char aRecastInfo[32] {};
-	if(m_aPlayerTick[PotionRecast] > Server()->Tick())
-	{
-		int Seconds = maximum(0, (m_aPlayerTick[PotionRecast] - Server()->Tick()) / Server()->TickSpeed());
-		str_format(aRecastInfo, sizeof(aRecastInfo), "Potion recast: %d", Seconds);
-	}
+	if(Stats.m_RecastSeconds >= 0)
+		str_format(aRecastInfo, sizeof(aRecastInfo), "Potion recast: %d", Stats.m_RecastSeconds);
 
-	std::string ProgressBar = Tools::String::progressBar(100, LevelPercent, 10, ":", " ");
+	std::string ProgressBar = Tools::String::progressBar(100, Stats.m_ExpPercent, 10, ":", " ");
 	str_format(pBuffer, Size, "\n\n\n\n\nLv%d[%s]\nHP %d/%d\nMP %d/%d\nGold %s\n%s\n\n\n\n\n\n\n\n\n\n\n%-150s",
-		Account()->GetLevel(), ProgressBar.c_str(), Health, MaximumHealth, Mana, MaximumMana, get_commas<int>(Gold).c_str(), aRecastInfo, pAppendStr);
+		Stats.m_Level, ProgressBar.c_str(), Stats.m_Health, Stats.m_MaxHealth, Stats.m_Mana, Stats.m_MaxMana, get_commas<int>(Stats.m_Gold).c_str(), aRecastInfo, pAppendStr);
 }
 
 /* #########################################################################
@@ -926,20 +936,8 @@ CPlayerQuest* CPlayer::GetQuest(QuestIdentifier ID) const
 // This function returns the ID of the equipped item with the specified functionality, excluding the specified item ID.
 int CPlayer::GetEquippedItemID(ItemFunctional EquipID, int SkipItemID) const
 {
-	// Iterate through each item
-	const auto& playerItems = CPlayerItem::Data()[m_ClientID];
-	for(const auto& [itemID, item] : playerItems)
-	{
-		// Check if the item has an item and is equipped and has the specified functionality and is not the excluded item
-		if(item.HasItem() && item.IsEquipped() && item.Info()->IsFunctional(EquipID) && itemID != SkipItemID)
-		{
-			// Return the item ID
-			return itemID;
-		}
-	}
-
 	// Return -1 if no equipped item with the specified functionality was found
-	return -1;
+	return CPlayerItem::Index(m_ClientID).FindEquipped(EquipID, SkipItemID);
 }
 
 int CPlayer::GetAttributeSize(AttributeIdentifier ID) const
@@ -953,11 +951,13 @@ int CPlayer::GetAttributeSize(AttributeIdentifier ID) const
 			return pDungeon->GetAttributeDungeonSync(this, ID);
 	}
 
-	// get all attributes from items
+	// get all attributes from equipped items
 	int Size = 0;
-	for(const auto& [ItemID, ItemData] : CPlayerItem::Data()[m_ClientID])
+	auto& aItems = CPlayerItem::Data()[m_ClientID];
+	for(int ItemID : CPlayerItem::Index(m_ClientID).Equipped())
 	{
-		if(ItemData.IsEquipped() && ItemData.Info()->IsEnchantable() && ItemData.Info()->GetInfoEnchantStats(ID))
+		const CPlayerItem& ItemData = aItems[ItemID];
+		if(ItemData.Info()->IsEnchantable() && ItemData.Info()->GetInfoEnchantStats(ID))
 		{
 			Size += ItemData.GetEnchantStats(ID);
 		}
@@ -1046,7 +1046,7 @@ CVoteEventOptional* CPlayer::CreateVoteOptional(int OptionID, int OptionID2, int
 	va_list VarArgs;
 	va_start(VarArgs, pInformation);
 	dynamic_string Buffer;
-	Server()->Localization()->Format_VL(Buffer, GetLanguage(), pInformation, VarArgs);
+	Server()->Localization()->Format_VL(Buffer, GetLanguageIndex(), pInformation, VarArgs);
 	Optional.m_Description = Buffer.buffer();
 	Buffer.clear();
 	va_end(VarArgs);
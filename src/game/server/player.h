@@ -115,7 +115,20 @@ public:
 	bool IsAfk() const { return m_Afk; }
 	int64_t GetAfkTime() const;
 
-	void FormatBroadcastBasicStats(char* pBuffer, int Size, const char* pAppendStr = "\0");
+	// typed fields of the basic stats broadcast, compared before anything is formatted
+	struct CBroadcastStats
+	{
+		int m_Level;
+		int m_ExpPercent;
+		int m_Health;
+		int m_MaxHealth;
+		int m_Mana;
+		int m_MaxMana;
+		int m_Gold;
+		int m_RecastSeconds; // -1 without potion recast
+	};
+	bool GetBroadcastStats(CBroadcastStats* pStats);
+	void FormatBroadcastBasicStats(char* pBuffer, int Size, const CBroadcastStats& Stats, const char* pAppendStr = "\0") const;
 
 	virtual void HandleTuningParams();
 	virtual int64_t GetMaskVisibleForClients() const { return -1; }
@@ -168,6 +181,7 @@ public:
 		FUNCTIONS PLAYER ACCOUNT
 	========================================================== */
 	const char* GetLanguage() const;
+	int GetLanguageIndex() const;
 
 	bool IsAuthed() const;
 	int GetStartTeam() const;
@@ -28,11 +28,20 @@ CPlayerBot::~CPlayerBot()
 	// Set all elements in the m_aVisibleActive array of the DataBotInfo object at index m_BotID to 0
 	std::memset(DataBotInfo::ms_aDataBot[m_BotID].m_aVisibleActive, 0, MAX_PLAYERS * sizeof(bool));
 
+	// Drop the quest mob together with its clients
+	if(m_BotType == TYPE_BOT_QUEST_MOB)
+		QuestMobInterest().RemoveMob(m_ClientID);
+
 	// Delete the m_pCharacter object and set it to nullptr
 	delete m_pCharacter;
 	m_pCharacter = nullptr;
 }
 
+CQuestMobInterest& CPlayerBot::QuestMobInterest() const
+{
+	return ms_aQuestMobInterest[GS()->GetWorldID()];
+}
+
 // This method is used to initialize the quest bot mob info for the player bot
 // It takes an instance of CQuestBotMobInfo as a parameter
 void CPlayerBot::InitQuestBotMobInfo(CQuestBotMobInfo elem)
@@ -43,9 +52,8 @@ void CPlayerBot::InitQuestBotMobInfo(CQuestBotMobInfo elem)
 		// Assign the passed CQuestBotMobInfo instance to the member variable m_QuestMobInfo
 		m_QuestMobInfo = elem;
 
-		// Set all elements of m_ActiveForClient m_CompleteClient array to false
-		std::memset(m_QuestMobInfo.m_ActiveForClient, 0, MAX_PLAYERS * sizeof(bool));
-		std::memset(m_QuestMobInfo.m_CompleteClient, 0, MAX_PLAYERS * sizeof(bool));
+		// Register the mob for its task without any clients
+		QuestMobInterest().AddMob(m_ClientID, elem.m_QuestID, elem.m_QuestStep, elem.m_MoveToStep);
 
 		// Update the attribute size of the player bot for the attribute identifier HP
 		m_BotStartHealth = CPlayerBot::GetAttributeSize(AttributeIdentifier::HP);
@@ -82,7 +90,8 @@ void CPlayerBot::Tick()
 			if(IsActive())
 			{
 				m_ViewPos = m_pCharacter->GetPos();
-				HandlePathFinder();
+				if(GS()->m_World.GetBotLod(m_ClientID) != BotLod::MINIMAL && GS()->m_World.IsBotThinkTick(m_ClientID))
+					HandlePathFinder();
 			}
 		}
 		else
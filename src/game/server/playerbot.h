@@ -5,6 +5,7 @@
 
 #include "player.h"
 
+#include "core/tools/quest_mob_interest.h"
 #include "core/utilities/pathfinder_data.h"
 
 class CPlayerBot : public CPlayer
@@ -28,9 +29,6 @@ class CPlayerBot : public CPlayer
 		int m_AttributeSpread;
 		int m_WorldID;
 		vec2 m_Position;
-
-		bool m_ActiveForClient[MAX_PLAYERS]{};
-		bool m_CompleteClient[MAX_PLAYERS]{};
 	} m_QuestMobInfo;
 
 public:
@@ -45,6 +43,12 @@ public:
 	void InitQuestBotMobInfo(CQuestBotMobInfo elem);
 	CQuestBotMobInfo& GetQuestBotMobInfo() { return m_QuestMobInfo; }
 
+	// clients of the quest mobs, one table per world as bots are numbered per world
+	static inline CQuestMobInterest ms_aQuestMobInterest[ENGINE_MAX_WORLDS];
+	CQuestMobInterest& QuestMobInterest() const;
+	bool IsQuestMobActiveFor(int ClientID) const { return QuestMobInterest().IsActive(m_ClientID, ClientID); }
+	bool IsQuestMobCompleteFor(int ClientID) const { return QuestMobInterest().IsComplete(m_ClientID, ClientID); }
+
 	int GetTeam() override { return TEAM_BLUE; }
 	bool IsBot() const override { return true; }
 	int GetBotID() const override { return m_BotID; }
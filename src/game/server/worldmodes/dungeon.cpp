@@ -114,6 +114,7 @@ void CGameControllerDungeon::ChangeState(int State)
 		int FinishTime = -1;
 		int BestPassageHelp = 0;
 		CPlayer* pBestPlayer = nullptr;
+		std::vector<CDungeonRecords::CRecord> vRecords;
 
 		for(int i = 0; i < MAX_PLAYERS; i++)
 		{
@@ -136,12 +137,15 @@ void CGameControllerDungeon::ChangeState(int State)
 			Buffer.append(", ");
 			Buffer.append(Server()->ClientName(i));
 
-			// save record and reset time for client
-			GS()->Core()->DungeonManager()->SaveDungeonRecord(pPlayer, m_DungeonID, &m_Records[i]);
+			// collect the record and reset time for client
+			vRecords.push_back({pPlayer->Account()->GetID(), m_Records[i].m_Time, m_Records[i].m_PassageHelp});
 			GS()->m_apPlayers[i]->GetTempData().m_TempTimeDungeon = 0;
 			m_Records[i].Reset();
 		}
 
+		// the group is written with one query
+		GS()->Core()->DungeonManager()->SaveDungeonRecords(m_DungeonID, vRecords);
+
 		// dungeon finished information
 		char aTimeFormat[64];
 		str_format(aTimeFormat, sizeof(aTimeFormat), "Time: %d minute(s) %d second(s)", FinishTime / 60, FinishTime - (FinishTime / 60 * 60));
@@ -594,27 +598,28 @@ DungeonDoor::DungeonDoor(CGameWorld* pGameWorld, vec2 Pos)
 {
 	GS()->Collision()->Wallline(32, vec2(0, -1), &m_Pos, &m_PosTo);
 	m_State = DUNGEON_WAITING;
+	m_BlockerID = GameWorld()->DoorBlockers()->AddSegment(m_Pos, m_PosTo);
 
 	GameWorld()->InsertEntity(this);
 }
 
+DungeonDoor::~DungeonDoor()
+{
+	GameWorld()->DoorBlockers()->RemoveSegment(m_BlockerID);
+}
+
 void DungeonDoor::Tick()
 {
 	if(m_State >= DUNGEON_STARTED)
 		return;
 
-	for(CCharacter* pChar = (CCharacter*)GameWorld()->FindFirst(CGameWorld::ENTTYPE_CHARACTER); pChar; pChar = (CCharacter*)pChar->TypeNext())
+	CGameWorld::CDoorHit aHits[MAX_CLIENTS];
+	const int NumHits = GameWorld()->FindDoorHits(m_BlockerID, (float)g_Config.m_SvDoorRadiusHit, aHits);
+	for(int i = 0; i < NumHits; i++)
 	{
-		vec2 IntersectPos;
-		if(closest_point_on_line(m_Pos, m_PosTo, pChar->m_Core.m_Pos, IntersectPos))
-		{
-			float Distance = distance(IntersectPos, pChar->m_Core.m_Pos);
-			if(Distance <= (float)g_Config.m_SvDoorRadiusHit)
-			{
-				pChar->m_DoorHit = true;
-				pChar->Die(pChar->GetPlayer()->GetCID(), WEAPON_WORLD);
-			}
-		}
+		CCharacter* pChar = aHits[i].m_pChar;
+		pChar->m_DoorHit = true;
+		pChar->Die(pChar->GetPlayer()->GetCID(), WEAPON_WORLD);
 	}
 }
 
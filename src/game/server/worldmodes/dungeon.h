@@ -72,8 +72,10 @@ private:
 class DungeonDoor : public CEntity
 {
 	int m_State;
+	int m_BlockerID;
 public:
 	DungeonDoor(CGameWorld *pGameWorld, vec2 Pos);
+	~DungeonDoor() override;
 
 	void SetState(int State) { m_State = State; };
 	void Tick() override;
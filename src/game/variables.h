@@ -152,6 +152,9 @@ MACRO_CONFIG_STR(SvMySqlLogin, sv_sql_login, 32, "root", CFGFLAG_SERVER, "MySQL
 MACRO_CONFIG_STR(SvMySqlPassword, sv_sql_password, 32, "", CFGFLAG_SERVER, "MySQL Password")
 MACRO_CONFIG_INT(SvMySqlPort, sv_sql_port, 3306, 0, 65000, CFGFLAG_SERVER, "MySQL Port")
 MACRO_CONFIG_INT(SvMySqlPoolSize, sv_sql_pool_size, 3, 2, 12, CFGFLAG_SERVER, "MySQL Pool size");
+MACRO_CONFIG_STR(SvSqlBackend, sv_sql_backend, 16, "mysql", CFGFLAG_SERVER, "Database backend (mysql, sqlite)")
+MACRO_CONFIG_STR(SvSqliteFile, sv_sqlite_file, 128, "", CFGFLAG_SERVER, "SQLite database file, empty for an in-memory database")
+MACRO_CONFIG_STR(SvSqliteSchema, sv_sqlite_schema, 128, "MRPG-database.sql", CFGFLAG_SERVER, "MySQL dump imported into a new SQLite database")
 
 MACRO_CONFIG_INT(SvLoltextHspace, sv_loltext_hspace, 7, 7, 25, CFGFLAG_SERVER, "horizontal offset between loltext 'pixels'")
 MACRO_CONFIG_INT(SvLoltextVspace, sv_loltext_vspace, 7, 7, 25, CFGFLAG_SERVER, "vertical offset between loltext 'pixels'")
@@ -163,6 +166,10 @@ MACRO_CONFIG_INT(ClNotifyWindow, cl_notify_window, 1, 0, 1, CFGFLAG_CLIENT | CFG
 MACRO_CONFIG_INT(ClInactiveRendering, cl_inactive_rendering, 1, 0, 2, CFGFLAG_CLIENT, "0 = Always render, 1 = Stop rendering when minimized, 2 = Stop rendering when window is inactive")
 
 MACRO_CONFIG_INT(SvMapDistanceActveBot, sv_map_distance_active_bot, 1000, 400, 10000, CFGFLAG_SERVER, "max distance for active bot")
+MACRO_CONFIG_INT(SvBotLodFull, sv_bot_lod_full, 600, 0, 10000, CFGFLAG_SERVER, "Bots closer to a player than this think every tick")
+MACRO_CONFIG_INT(SvBotLodReduced, sv_bot_lod_reduced, 900, 0, 10000, CFGFLAG_SERVER, "Bots closer to a player than this think every 4th tick, the rest every 25th tick")
+MACRO_CONFIG_INT(SvBankFlushInterval, sv_bank_flush_interval, 5, 1, 300, CFGFLAG_SERVER, "Seconds between writes of the guild and house bank journal")
+MACRO_CONFIG_INT(SvBroadcastRate, sv_broadcast_rate, 10, 1, 50, CFGFLAG_SERVER, "Max broadcast updates per second sent to a client")
 MACRO_CONFIG_INT(SvMapUpdateRate, sv_mapupdaterate, 5, 1, 100, CFGFLAG_SERVER, "64 player id <-> vanilla id players map update rate")
 
 // debug
@@ -98,7 +98,7 @@ const char* CLocalization::CLanguage::Localize(const char* pText) const
 	return pEntry->m_apVersions;
 }
 
-CLocalization::CLocalization(IStorageEngine* pStorage) : m_pStorage(pStorage), m_pMainLanguage(nullptr)
+CLocalization::CLocalization(IStorageEngine* pStorage) : m_pStorage(pStorage), m_pMainLanguage(nullptr), m_MainLanguageIndex(-1)
 { }
 
 CLocalization::~CLocalization()
@@ -140,6 +140,7 @@ bool CLocalization::Init()
 
 	// extract data
 	m_pMainLanguage = nullptr;
+	m_MainLanguageIndex = -1;
 	const json_value& rStart = (*pJsonData)["language indices"];
 	if(rStart.type == json_array)
 	{
@@ -152,6 +153,7 @@ bool CLocalization::Init()
 			{
 				pLanguage->Load(this, Storage());
 				m_pMainLanguage = pLanguage;
+				m_MainLanguageIndex = m_pLanguages.size() - 1;
 			}
 		}
 	}
@@ -161,21 +163,30 @@ bool CLocalization::Init()
 	return true;
 }
 
-const char* CLocalization::LocalizeWithDepth(const char* pLanguageCode, const char* pText, int Depth)
+int CLocalization::GetLanguageIndex(const char* pLanguageCode) const
 {
-	CLanguage* pLanguage = m_pMainLanguage;
 	if(pLanguageCode)
 	{
 		for(int i = 0; i < m_pLanguages.size(); i++)
 		{
 			if(str_comp(m_pLanguages[i]->GetFilename(), pLanguageCode) == 0)
-			{
-				pLanguage = m_pLanguages[i];
-				break;
-			}
+				return i;
 		}
 	}
 
+	return m_MainLanguageIndex;
+}
+
+CLocalization::CLanguage* CLocalization::GetLanguage(int LanguageIndex) const
+{
+	if(LanguageIndex < 0 || LanguageIndex >= m_pLanguages.size())
+		return m_pMainLanguage;
+	return m_pLanguages[LanguageIndex];
+}
+
+const char* CLocalization::LocalizeWithDepth(int LanguageIndex, const char* pText, int Depth)
+{
+	CLanguage* pLanguage = GetLanguage(LanguageIndex);
 	if(!pLanguage)
 		return pText;
 
@@ -186,104 +197,66 @@ const char* CLocalization::LocalizeWithDepth(const char* pLanguageCode, const ch
 	if(pResult)
 		return pResult;
 	if(pLanguage->GetParentFilename()[0] && Depth < 4)
-		return LocalizeWithDepth(pLanguage->GetParentFilename(), pText, Depth + 1);
+		return LocalizeWithDepth(GetLanguageIndex(pLanguage->GetParentFilename()), pText, Depth + 1);
 	return pText;
 }
 
+const char* CLocalization::Localize(int LanguageIndex, const char* pText)
+{
+	return LocalizeWithDepth(LanguageIndex, pText, 0);
+}
+
 const char* CLocalization::Localize(const char* pLanguageCode, const char* pText)
 {
-	return LocalizeWithDepth(pLanguageCode, pText, 0);
+	return LocalizeWithDepth(GetLanguageIndex(pLanguageCode), pText, 0);
 }
 
-void CLocalization::Format_V(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, va_list VarArgs)
+std::shared_ptr<const CLocalizationTemplate> CLocalization::GetTemplate(const char* pText, int LanguageIndex, bool Localized)
 {
-	CLanguage* pLanguage = m_pMainLanguage;
-	if(pLanguageCode)
+	const CTemplateKey Key = { pText, LanguageIndex, Localized };
 	{
-		for(int i = 0; i < m_pLanguages.size(); i++)
-		{
-			if(str_comp(m_pLanguages[i]->GetFilename(), pLanguageCode) != 0)
-				continue;
-
-			pLanguage = m_pLanguages[i];
-			break;
-		}
+		std::lock_guard<std::mutex> Lock(m_TemplatesMutex);
+		const auto Iter = m_Templates.find(Key);
+		// the same pointer may hold different text, e.g. a reused stack buffer
+		if(Iter != m_Templates.end() && str_comp(Iter->second->m_Source.c_str(), pText) == 0)
+			return Iter->second;
 	}
 
+	auto pTemplate = std::make_shared<CLocalizationTemplate>();
+	pTemplate->Compile(pText, Localized ? LocalizeWithDepth(LanguageIndex, pText, 0) : pText);
+
+	std::lock_guard<std::mutex> Lock(m_TemplatesMutex);
+	if((int)m_Templates.size() >= MAX_TEMPLATES)
+		m_Templates.clear();
+	m_Templates[Key] = pTemplate;
+	return pTemplate;
+}
+
+void CLocalization::Format_V(dynamic_string& Buffer, int LanguageIndex, const char* pText, va_list VarArgs)
+{
+	const CLanguage* pLanguage = GetLanguage(LanguageIndex);
 	if(!pLanguage)
 	{
 		Buffer.append(pText);
 		return;
 	}
 
-	// start parameters of the end of the name and type string
-	const int BufferStart = Buffer.length();
-	int BufferIter = BufferStart;
-	int ParamTypeStart = -1;
-
-	// argument parsing
-	va_list VarArgsIter;
-	va_copy(VarArgsIter, VarArgs);
-
-	// character positions
-	int Iter = 0;
-	int Start = 0;
-
-	// parse text to search for positions
-	while(pText[Iter])
-	{
-		if(ParamTypeStart >= 0)
-		{
-			if(pText[Iter] != '}')
-			{
-				Iter = str_utf8_forward(pText, Iter);
-				continue;
-			}
-
-			// we get data from an argument parsing arguments
-			if(str_comp_num("STR", pText + ParamTypeStart, 3) == 0) // string
-			{
-				const char* pVarArgValue = va_arg(VarArgsIter, const char*);
-				const char* pTranslatedValue = pLanguage->Localize(pVarArgValue);
-				BufferIter = Buffer.append_at(BufferIter, (pTranslatedValue ? pTranslatedValue : pVarArgValue));
-			}
-			else if(str_comp_num("INT", pText + ParamTypeStart, 3) == 0) // intiger
-			{
-				char aBuf[128];
-				const int pVarArgValue = va_arg(VarArgsIter, int);
-				str_format(aBuf, sizeof(aBuf), "%d", pVarArgValue); // %ll
-				BufferIter = Buffer.append_at(BufferIter, aBuf);
-			}
-			else if(str_comp_num("VAL", pText + ParamTypeStart, 3) == 0) // value
-			{
-				const int pVarArgValue = va_arg(VarArgsIter, int);
-				BufferIter = Buffer.append_at(BufferIter, get_commas<int>(pVarArgValue).c_str());
-			}
-
-			//
-			Start = Iter + 1;
-			ParamTypeStart = -1;
-		}
+	GetTemplate(pText, LanguageIndex, false)->Format(Buffer, VarArgs, [pLanguage](const char* pValue) { return pLanguage->Localize(pValue); });
+}
 
-		// parameter parsing start
-		else
-		{
-			if(pText[Iter] == '{')
-			{
-				BufferIter = Buffer.append_at_num(BufferIter, pText + Start, Iter - Start);
-				Iter++;
-				ParamTypeStart = Iter;
-			}
-		}
+void CLocalization::Format_V(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, va_list VarArgs)
+{
+	Format_V(Buffer, GetLanguageIndex(pLanguageCode), pText, VarArgs);
+}
 
-		Iter = str_utf8_forward(pText, Iter);
-	}
+void CLocalization::Format(dynamic_string& Buffer, int LanguageIndex, const char* pText, ...)
+{
+	va_list VarArgs;
+	va_start(VarArgs, pText);
 
-	// close the argument macro
-	va_end(VarArgsIter);
+	Format_V(Buffer, LanguageIndex, pText, VarArgs);
 
-	if(Iter > 0 && ParamTypeStart == -1)
-		Buffer.append_at_num(BufferIter, pText + Start, Iter - Start);
+	va_end(VarArgs);
 }
 
 void CLocalization::Format(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, ...)
@@ -296,11 +269,31 @@ void CLocalization::Format(dynamic_string& Buffer, const char* pLanguageCode, co
 	va_end(VarArgs);
 }
 
+void CLocalization::Format_VL(dynamic_string& Buffer, int LanguageIndex, const char* pText, va_list VarArgs)
+{
+	const CLanguage* pLanguage = GetLanguage(LanguageIndex);
+	if(!pLanguage)
+	{
+		Buffer.append(pText);
+		return;
+	}
+
+	GetTemplate(pText, LanguageIndex, true)->Format(Buffer, VarArgs, [pLanguage](const char* pValue) { return pLanguage->Localize(pValue); });
+}
+
 void CLocalization::Format_VL(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, va_list VarArgs)
 {
-	const char* pLocalText = Localize(pLanguageCode, pText);
+	Format_VL(Buffer, GetLanguageIndex(pLanguageCode), pText, VarArgs);
+}
+
+void CLocalization::Format_L(dynamic_string& Buffer, int LanguageIndex, const char* pText, ...)
+{
+	va_list VarArgs;
+	va_start(VarArgs, pText);
 
-	Format_V(Buffer, pLanguageCode, pLocalText, VarArgs);
+	Format_VL(Buffer, LanguageIndex, pText, VarArgs);
+
+	va_end(VarArgs);
 }
 
 void CLocalization::Format_L(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, ...)
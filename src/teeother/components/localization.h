@@ -3,6 +3,8 @@
 
 #include <teeother/tl/hashtable.h>
 
+#include "localization_template.h"
+
 /*
  * TODO: Join plural rules example {RP:{INT}:{STR}} or {PR:{INT}:player} use rules from lang files
  */
@@ -64,13 +66,36 @@ public:
 
 protected:
 	CLanguage* m_pMainLanguage;
+	int m_MainLanguageIndex;
+
+	// compiled format templates keyed by the text pointer, the language and whether the text gets localized
+	struct CTemplateKey
+	{
+		const char* m_pText;
+		int m_Language;
+		bool m_Localized;
+
+		bool operator==(const CTemplateKey& Other) const { return m_pText == Other.m_pText && m_Language == Other.m_Language && m_Localized == Other.m_Localized; }
+	};
+	struct CTemplateKeyHash
+	{
+		size_t operator()(const CTemplateKey& Key) const { return std::hash<const void*>()(Key.m_pText) ^ (size_t)((Key.m_Language << 1) | Key.m_Localized) * 0x9E3779B97F4A7C15ull; }
+	};
+	enum
+	{
+		MAX_TEMPLATES = 16384,
+	};
+	std::mutex m_TemplatesMutex;
+	std::unordered_map<CTemplateKey, std::shared_ptr<const CLocalizationTemplate>, CTemplateKeyHash> m_Templates;
+
+	std::shared_ptr<const CLocalizationTemplate> GetTemplate(const char* pText, int LanguageIndex, bool Localized);
 
 public:
 	array<CLanguage*> m_pLanguages;
 	fixed_string128 m_Cfg_MainLanguage;
 
 protected:
-	const char* LocalizeWithDepth(const char* pLanguageCode, const char* pText, int Depth);
+	const char* LocalizeWithDepth(int LanguageIndex, const char* pText, int Depth);
 
 public:
 	CLocalization(IStorageEngine* pStorage);
@@ -79,14 +104,23 @@ public:
 	virtual bool InitConfig(int argc, const char** argv);
 	virtual bool Init();
 
+	//language index, the main language for unknown codes
+	int GetLanguageIndex(const char* pLanguageCode) const;
+	CLanguage* GetLanguage(int LanguageIndex) const;
+
 	//localize
+	const char* Localize(int LanguageIndex, const char* pText);
 	const char* Localize(const char* pLanguageCode, const char* pText);
 
 	//format
+	void Format_V(dynamic_string& Buffer, int LanguageIndex, const char* pText, va_list VarArgs);
 	void Format_V(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, va_list VarArgs);
+	void Format(dynamic_string& Buffer, int LanguageIndex, const char* pText, ...);
 	void Format(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, ...);
 	//localize, format
+	void Format_VL(dynamic_string& Buffer, int LanguageIndex, const char* pText, va_list VarArgs);
 	void Format_VL(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, va_list VarArgs);
+	void Format_L(dynamic_string& Buffer, int LanguageIndex, const char* pText, ...);
 	void Format_L(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, ...);
 };
 
@@ -0,0 +1,129 @@
+#ifndef TEEOTHER_COMPONENTS_LOCALIZATION_TEMPLATE_H
+#define TEEOTHER_COMPONENTS_LOCALIZATION_TEMPLATE_H
+
+#include <base/math.h>
+#include <base/system.h>
+#include <teeother/system/string.h>
+
+#include <cstdarg>
+#include <string>
+#include <vector>
+
+/*
+ * Format text split once into literal and {STR}/{INT}/{VAL} segments,
+ * formatting is then a plain copy of the segments and the arguments.
+ */
+class CLocalizationTemplate
+{
+public:
+	enum
+	{
+		SEGMENT_TEXT = 0,
+		SEGMENT_STR,
+		SEGMENT_INT,
+		SEGMENT_VAL,
+	};
+
+	class CSegment
+	{
+	public:
+		int m_Type;
+		int m_Offset;
+		int m_Size;
+	};
+
+	std::string m_Source; // text the template was requested for, used to detect reused pointers
+	std::string m_Text; // text the segments point into, the translation of the source if localized
+	std::vector<CSegment> m_vSegments;
+
+	void Compile(const char* pSource, const char* pText)
+	{
+		m_Source = pSource;
+		m_Text = pText;
+		m_vSegments.clear();
+
+		// same scanning rules as the old per call parser, unknown placeholders are dropped
+		int Iter = 0;
+		int Start = 0;
+		int ParamTypeStart = -1;
+		while(pText[Iter])
+		{
+			if(ParamTypeStart >= 0)
+			{
+				if(pText[Iter] != '}')
+				{
+					Iter = str_utf8_forward(pText, Iter);
+					continue;
+				}
+
+				if(str_comp_num("STR", pText + ParamTypeStart, 3) == 0)
+					m_vSegments.push_back({SEGMENT_STR, 0, 0});
+				else if(str_comp_num("INT", pText + ParamTypeStart, 3) == 0)
+					m_vSegments.push_back({SEGMENT_INT, 0, 0});
+				else if(str_comp_num("VAL", pText + ParamTypeStart, 3) == 0)
+					m_vSegments.push_back({SEGMENT_VAL, 0, 0});
+
+				Start = Iter + 1;
+				ParamTypeStart = -1;
+			}
+			else if(pText[Iter] == '{')
+			{
+				AddText(Start, Iter - Start);
+				Iter++;
+				ParamTypeStart = Iter;
+			}
+
+			Iter = str_utf8_forward(pText, Iter);
+		}
+
+		if(Iter > 0 && ParamTypeStart == -1)
+			AddText(Start, Iter - Start);
+	}
+
+	// Translate maps a {STR} argument to its translation or nullptr
+	template<typename FTranslate>
+	void Format(dynamic_string& Buffer, va_list VarArgs, FTranslate&& Translate) const
+	{
+		va_list VarArgsIter;
+		va_copy(VarArgsIter, VarArgs);
+
+		int BufferIter = Buffer.length();
+		for(const auto& Segment : m_vSegments)
+		{
+			switch(Segment.m_Type)
+			{
+				case SEGMENT_TEXT:
+					BufferIter = Buffer.append_at_num(BufferIter, m_Text.c_str() + Segment.m_Offset, Segment.m_Size);
+					break;
+				case SEGMENT_STR:
+				{
+					const char* pVarArgValue = va_arg(VarArgsIter, const char*);
+					const char* pTranslatedValue = Translate(pVarArgValue);
+					BufferIter = Buffer.append_at(BufferIter, pTranslatedValue ? pTranslatedValue : pVarArgValue);
+					break;
+				}
+				case SEGMENT_INT:
+				{
+					char aBuf[16];
+					str_from_int(va_arg(VarArgsIter, int), aBuf);
+					BufferIter = Buffer.append_at(BufferIter, aBuf);
+					break;
+				}
+				case SEGMENT_VAL:
+					BufferIter = Buffer.append_at(BufferIter, get_commas<int>(va_arg(VarArgsIter, int)).c_str());
+					break;
+			}
+		}
+
+		va_end(VarArgsIter);
+	}
+
+private:
+	void AddText(int Offset, int Size)
+	{
+		if(Size > 0)
+			m_vSegments.push_back({SEGMENT_TEXT, Offset, Size});
+	}
+};
+
+#endif
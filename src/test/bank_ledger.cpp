@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <game/server/core/tools/bank_ledger.h>
+
+TEST(BankLedger, MergesDeltasPerBank)
+{
+	CBankLedger Ledger;
+	EXPECT_FALSE(Ledger.HasPending());
+	Ledger.Record(CBankLedger::KIND_GUILD, 3, 500);
+	Ledger.Record(CBankLedger::KIND_GUILD, 3, -200);
+	Ledger.Record(CBankLedger::KIND_HOUSE, 3, 100);
+	Ledger.Record(CBankLedger::KIND_HOUSE, 7, 50);
+	Ledger.Record(CBankLedger::KIND_HOUSE, 7, -50);
+	Ledger.Record(CBankLedger::KIND_GUILD, 9, 0);
+	EXPECT_TRUE(Ledger.HasPending());
+
+	// one row per bank that changed in total
+	std::vector<CBankLedger::CEntry> vBatch = Ledger.TakeBatch();
+	ASSERT_EQ(vBatch.size(), 2u);
+	EXPECT_EQ(vBatch[0].m_Kind, CBankLedger::KIND_GUILD);
+	EXPECT_EQ(vBatch[0].m_OwnerID, 3);
+	EXPECT_EQ(vBatch[0].m_Delta, 300);
+	EXPECT_EQ(vBatch[1].m_Kind, CBankLedger::KIND_HOUSE);
+	EXPECT_EQ(vBatch[1].m_Delta, 100);
+	EXPECT_LT(vBatch[0].m_Seq, vBatch[1].m_Seq);
+	EXPECT_FALSE(Ledger.HasPending());
+	EXPECT_TRUE(Ledger.TakeBatch().empty());
+}
+
+TEST(BankLedger, RequeuedRowsKeepTheirSequence)
+{
+	CBankLedger Ledger;
+	Ledger.Record(CBankLedger::KIND_GUILD, 1, -40);
+	std::vector<CBankLedger::CEntry> vFailed = Ledger.TakeBatch();
+	ASSERT_EQ(vFailed.size(), 1u);
+	const int64_t Seq = vFailed[0].m_Seq;
+
+	// a failed row comes again as it was, new changes of the same bank get a row of their own
+	Ledger.Record(CBankLedger::KIND_GUILD, 1, -10);
+	Ledger.Requeue(std::move(vFailed));
+	EXPECT_TRUE(Ledger.HasPending());
+
+	std::vector<CBankLedger::CEntry> vBatch = Ledger.TakeBatch();
+	ASSERT_EQ(vBatch.size(), 2u);
+	EXPECT_EQ(vBatch[0].m_Seq, Seq);
+	EXPECT_EQ(vBatch[0].m_Delta, -40);
+	EXPECT_GT(vBatch[1].m_Seq, Seq);
+	EXPECT_EQ(vBatch[1].m_Delta, -10);
+}
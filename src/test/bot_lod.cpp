@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <base/math.h>
+#include <base/system.h>
+#include <game/server/bot_lod.h>
+
+#include <vector>
+
+static const float FULL_DIST = 600.0f;
+static const float REDUCED_DIST = 900.0f;
+
+TEST(BotLod, Classify)
+{
+	EXPECT_EQ(CBotLodScheduler::Classify(0.0f, FULL_DIST, REDUCED_DIST), BotLod::FULL);
+	EXPECT_EQ(CBotLodScheduler::Classify(599.0f, FULL_DIST, REDUCED_DIST), BotLod::FULL);
+	EXPECT_EQ(CBotLodScheduler::Classify(600.0f, FULL_DIST, REDUCED_DIST), BotLod::REDUCED);
+	EXPECT_EQ(CBotLodScheduler::Classify(899.0f, FULL_DIST, REDUCED_DIST), BotLod::REDUCED);
+	EXPECT_EQ(CBotLodScheduler::Classify(900.0f, FULL_DIST, REDUCED_DIST), BotLod::MINIMAL);
+	EXPECT_EQ(CBotLodScheduler::Classify(1e10f, FULL_DIST, REDUCED_DIST), BotLod::MINIMAL);
+}
+
+TEST(BotLod, ThinkTicksSpread)
+{
+	// every bot of a tier thinks exactly once per interval, and the bots are spread over the ticks
+	const BotLod aLods[] = {BotLod::FULL, BotLod::REDUCED, BotLod::MINIMAL};
+	for(BotLod Lod : aLods)
+	{
+		const int Interval = CBotLodScheduler::Interval(Lod);
+		std::vector<int> vPerTick(Interval, 0);
+		for(int ClientID = 64; ClientID < 64 + 100 * Interval; ClientID++)
+		{
+			int Thinks = 0;
+			for(int Tick = 1000; Tick < 1000 + Interval; Tick++)
+			{
+				if(CBotLodScheduler::IsThinkTick(Lod, Tick, ClientID))
+				{
+					Thinks++;
+					vPerTick[Tick - 1000]++;
+				}
+			}
+			EXPECT_EQ(Thinks, 1);
+		}
+		for(int Count : vPerTick)
+			EXPECT_EQ(Count, 100);
+	}
+}
+
+// stands in for HandleBot: target search and hook probing
+static float SimulateThink(float Seed)
+{
+	float Acc = Seed;
+	for(int i = 0; i < 100; i++)
+		Acc = Acc * 0.999f + sinf(Acc + i) * 0.5f;
+	return Acc;
+}
+
+TEST(BotLod, Benchmark)
+{
+	const int NumBots = 500;
+	const int NumTicks = 200;
+
+	// bots spread along a line away from a single player
+	std::vector<BotLod> vLods(NumBots);
+	for(int i = 0; i < NumBots; i++)
+		vLods[i] = CBotLodScheduler::Classify(i * 2.0f, FULL_DIST, REDUCED_DIST);
+
+	volatile float Sink = 0.0f;
+	int64_t Start = time_get();
+	for(int Tick = 0; Tick < NumTicks; Tick++)
+		for(int i = 0; i < NumBots; i++)
+			Sink = Sink + SimulateThink((float)i);
+	const int64_t Full = time_get() - Start;
+
+	int Thinks = 0;
+	Start = time_get();
+	for(int Tick = 0; Tick < NumTicks; Tick++)
+	{
+		for(int i = 0; i < NumBots; i++)
+		{
+			if(!CBotLodScheduler::IsThinkTick(vLods[i], Tick, 64 + i))
+				continue;
+			Sink = Sink + SimulateThink((float)i);
+			Thinks++;
+		}
+	}
+	const int64_t Lod = time_get() - Start;
+
+	// 300 full, 150 reduced and 50 minimal bots
+	EXPECT_EQ(Thinks, NumTicks * 300 + NumTicks / 4 * 150 + NumTicks / 25 * 50);
+	printf("bot ai %d bots: all full %.1fus, lod %.1fus per tick\n", NumBots,
+		Full * 1000000.0 / time_freq() / NumTicks, Lod * 1000000.0 / time_freq() / NumTicks);
+}
@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/collision.h>
+#include <game/mapitems.h>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// the tile walk as it was before the raycast acceleration, the reference for the results
+static int ReferenceIntersectLine(const CCollision &Collision, vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *pOutBeforeCollision, int ColFlag)
+{
+	auto IsTile = [&](int x, int y) { return Collision.GetCollisionAt((float)x, (float)y) & ColFlag; };
+
+	const int Tile0X = round_to_int(Pos0.x) / 32;
+	const int Tile0Y = round_to_int(Pos0.y) / 32;
+	const int Tile1X = round_to_int(Pos1.x) / 32;
+	const int Tile1Y = round_to_int(Pos1.y) / 32;
+
+	const float Ratio = (Tile0X == Tile1X) ? 1.f : (Pos1.y - Pos0.y) / (Pos1.x - Pos0.x);
+	const float DetPos = Pos0.x * Pos1.y - Pos0.y * Pos1.x;
+
+	const int DeltaTileX = (Tile0X <= Tile1X) ? 1 : -1;
+	const int DeltaTileY = (Tile0Y <= Tile1Y) ? 1 : -1;
+
+	const float DeltaError = DeltaTileY * DeltaTileX * Ratio;
+
+	int CurTileX = Tile0X;
+	int CurTileY = Tile0Y;
+	vec2 Pos = Pos0;
+
+	bool Vertical = false;
+
+	float Error = 0;
+	if(Tile0Y != Tile1Y && Tile0X != Tile1X)
+	{
+		Error = (CurTileX * Ratio - CurTileY - DetPos / (32 * (Pos1.x - Pos0.x))) * DeltaTileY;
+		if(Tile0X < Tile1X)
+			Error += Ratio * DeltaTileY;
+		if(Tile0Y < Tile1Y)
+			Error -= DeltaTileY;
+	}
+
+	while(CurTileX != Tile1X || CurTileY != Tile1Y)
+	{
+		if(IsTile(CurTileX * 32, CurTileY * 32))
+			break;
+		if(CurTileY != Tile1Y && (CurTileX == Tile1X || Error > 0))
+		{
+			CurTileY += DeltaTileY;
+			Error -= 1;
+			Vertical = false;
+		}
+		else
+		{
+			CurTileX += DeltaTileX;
+			Error += DeltaError;
+			Vertical = true;
+		}
+	}
+	if(IsTile(CurTileX * 32, CurTileY * 32))
+	{
+		if(CurTileX != Tile0X || CurTileY != Tile0Y)
+		{
+			if(Vertical)
+			{
+				Pos.x = 32 * (CurTileX + ((Tile0X < Tile1X) ? 0 : 1));
+				Pos.y = (Pos.x * (Pos1.y - Pos0.y) - DetPos) / (Pos1.x - Pos0.x);
+			}
+			else
+			{
+				Pos.y = 32 * (CurTileY + ((Tile0Y < Tile1Y) ? 0 : 1));
+				Pos.x = (Pos.y * (Pos1.x - Pos0.x) + DetPos) / (Pos1.y - Pos0.y);
+			}
+		}
+		if(pOutCollision)
+			*pOutCollision = Pos;
+		if(pOutBeforeCollision)
+		{
+			vec2 Dir = normalize(Pos1 - Pos0);
+			if(Vertical)
+				Dir *= 0.5f / absolute(Dir.x) + 1.f;
+			else
+				Dir *= 0.5f / absolute(Dir.y) + 1.f;
+			*pOutBeforeCollision = Pos - Dir;
+		}
+		return Collision.GetCollisionAt((float)(CurTileX * 32), (float)(CurTileY * 32));
+	}
+	if(pOutCollision)
+		*pOutCollision = Pos1;
+	if(pOutBeforeCollision)
+		*pOutBeforeCollision = Pos1;
+	return 0;
+}
+
+// bit-exact, with every nan counted as equal since a zero length hit normalizes a null vector
+static bool SameFloat(float a, float b)
+{
+	if(std::isnan(a) && std::isnan(b))
+		return true;
+	return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+static bool SameVec(vec2 a, vec2 b)
+{
+	return SameFloat(a.x, b.x) && SameFloat(a.y, b.y);
+}
+
+class CCollisionMap
+{
+public:
+	std::vector<CTile> m_vTiles;
+	CCollision m_Collision;
+
+	// walled map with solid blocks and scattered special tiles
+	CCollisionMap(int Width, int Height, int Blocks, unsigned Seed)
+	{
+		std::mt19937 Rng(Seed);
+		m_vTiles.resize(Width * Height);
+		std::memset(m_vTiles.data(), 0, m_vTiles.size() * sizeof(CTile));
+		auto Set = [&](int x, int y, int Index) { m_vTiles[y * Width + x].m_Index = Index; };
+
+		for(int x = 0; x < Width; x++)
+		{
+			Set(x, 0, TILE_SOLID);
+			Set(x, Height - 1, TILE_SOLID);
+		}
+		for(int y = 0; y < Height; y++)
+		{
+			Set(0, y, TILE_SOLID);
+			Set(Width - 1, y, TILE_SOLID);
+		}
+		for(int i = 0; i < Blocks; i++)
+		{
+			const int w = 1 + Rng() % 8, h = 1 + Rng() % 5;
+			const int x0 = Rng() % (Width - w), y0 = Rng() % (Height - h);
+			const int Index = (Rng() % 4) ? TILE_SOLID : TILE_NOHOOK;
+			for(int y = y0; y < y0 + h; y++)
+				for(int x = x0; x < x0 + w; x++)
+					Set(x, y, Index);
+		}
+		const int aSpecial[] = {TILE_DEATH, TILE_INVISIBLE_WALL, TILE_INVISIBLE_WALL, 200};
+		for(int i = 0; i < Width * Height / 50; i++)
+			Set(Rng() % Width, Rng() % Height, aSpecial[Rng() % 4]);
+
+		m_Collision.Init(m_vTiles.data(), Width, Height);
+	}
+};
+
+TEST(Collision, IntersectLineBitExact)
+{
+	const int aFlags[] = {CCollision::COLFLAG_SOLID, CCollision::COLFLAG_SOLID | CCollision::COLFLAG_DISALLOW_MOVE,
+		CCollision::COLFLAG_DEATH, CCollision::COLFLAG_NOHOOK};
+
+	for(unsigned Seed = 0; Seed < 8; Seed++)
+	{
+		CCollisionMap Map(40 + Seed * 30, 30 + Seed * 10, Seed * 40, Seed);
+		const CCollision &Collision = Map.m_Collision;
+		const float MapW = Collision.GetWidth() * 32.0f, MapH = Collision.GetHeight() * 32.0f;
+
+		std::mt19937 Rng(1000 + Seed);
+		std::uniform_real_distribution<float> PosX(-300.0f, MapW + 300.0f), PosY(-300.0f, MapH + 300.0f);
+		std::uniform_real_distribution<float> Offset(-1.0f, 1.0f);
+		for(int i = 0; i < 20000; i++)
+		{
+			const vec2 Pos0(PosX(Rng), PosY(Rng));
+			vec2 Pos1;
+			switch(i % 5)
+			{
+			case 0: Pos1 = vec2(PosX(Rng), PosY(Rng)); break;
+			case 1: Pos1 = Pos0 + vec2(Offset(Rng), Offset(Rng)) * 100.0f; break;
+			case 2: Pos1 = Pos0 + vec2(Offset(Rng) * 800.0f, 0.0f); break;
+			case 3: Pos1 = Pos0 + vec2(0.0f, Offset(Rng) * 800.0f); break;
+			default: Pos1 = (i % 10 == 4) ? Pos0 : Pos0 + vec2(Offset(Rng), Offset(Rng)) * 20.0f;
+			}
+			const int ColFlag = aFlags[(i / 5) % 4];
+
+			vec2 RefCol(-1, -1), RefBefore(-1, -1), Col(-1, -1), Before(-1, -1);
+			const int RefResult = ReferenceIntersectLine(Collision, Pos0, Pos1, &RefCol, &RefBefore, ColFlag);
+			int Result;
+			if(ColFlag == CCollision::COLFLAG_SOLID)
+				Result = Collision.IntersectLine(Pos0, Pos1, &Col, &Before);
+			else
+				Result = Collision.IntersectLineColFlag(Pos0, Pos1, &Col, &Before, ColFlag) ? RefResult : 0;
+
+			ASSERT_EQ(Result, RefResult) << "seed " << Seed << " ray " << i << " flag " << ColFlag;
+			ASSERT_TRUE(SameVec(Col, RefCol)) << "seed " << Seed << " ray " << i << " flag " << ColFlag;
+			ASSERT_TRUE(SameVec(Before, RefBefore)) << "seed " << Seed << " ray " << i << " flag " << ColFlag;
+		}
+	}
+}
+
+TEST(Collision, IntersectLineBenchmark)
+{
+	// open arena with a few platforms, bots looking for targets across it
+	CCollisionMap Map(300, 150, 120, 7);
+	const CCollision &Collision = Map.m_Collision;
+
+	std::mt19937 Rng(42);
+	std::uniform_real_distribution<float> PosX(32.0f, 299 * 32.0f), PosY(32.0f, 149 * 32.0f), Offset(-1.0f, 1.0f);
+	std::vector<std::pair<vec2, vec2>> vRays(10000);
+	for(auto &Ray : vRays)
+	{
+		Ray.first = vec2(PosX(Rng), PosY(Rng));
+		Ray.second = Ray.first + vec2(Offset(Rng), Offset(Rng)) * 800.0f;
+	}
+
+	int Hits = 0;
+	vec2 Col, Before;
+	int64_t Start = time_get();
+	for(const auto &Ray : vRays)
+		Hits += ReferenceIntersectLine(Collision, Ray.first, Ray.second, &Col, &Before, CCollision::COLFLAG_SOLID) != 0;
+	const int64_t Reference = time_get() - Start;
+
+	Start = time_get();
+	for(const auto &Ray : vRays)
+		Hits -= Collision.IntersectLine(Ray.first, Ray.second, &Col, &Before) != 0;
+	const int64_t Current = time_get() - Start;
+
+	EXPECT_EQ(Hits, 0);
+	printf("IntersectLine %d rays: reference %.1fns, current %.1fns per ray\n", (int)vRays.size(),
+		Reference * 1000000000.0 / time_freq() / vRays.size(), Current * 1000000000.0 / time_freq() / vRays.size());
+}
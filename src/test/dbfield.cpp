@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/server/core/tools/dbfield.h>
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <variant>
+
+struct CTestSchema
+{
+	static constexpr DBSchema<int, float, std::string> ms_Schema
+	{
+		DBFieldInfo<int> { "Level", "Level", 1 },
+		DBFieldInfo<float> { "Speed", "Speed", 0.5f },
+		DBFieldInfo<std::string> { "Title", "Title", "none" },
+	};
+};
+
+struct CTestJobSchema
+{
+	static constexpr DBSchema<int, int, int> ms_Schema
+	{
+		DBFieldInfo<int> { "Level", "Job level", 1 },
+		DBFieldInfo<int> { "Exp", "Job experience", 0 },
+		DBFieldInfo<int> { "Upgrade", "Job upgrades", 0 },
+	};
+};
+
+class CFakeResult : public ISqlResult
+{
+public:
+	std::map<std::string, std::string> m_Row;
+
+	bool next() override { return false; }
+	size_t rowsCount() const override { return 1; }
+	size_t getRow() const override { return 1; }
+	int getInt(const std::string &Column) const override { return std::stoi(m_Row.at(Column)); }
+	int64_t getInt64(const std::string &Column) const override { return std::stoll(m_Row.at(Column)); }
+	double getDouble(const std::string &Column) const override { return std::stod(m_Row.at(Column)); }
+	bool getBoolean(const std::string &Column) const override { return getInt(Column) != 0; }
+	std::string getString(const std::string &Column) const override { return m_Row.at(Column); }
+	bool isNull(const std::string &Column) const override { return !m_Row.count(Column); }
+};
+
+class CFakeStatement
+{
+public:
+	std::vector<std::string> m_vBinds;
+
+	CFakeStatement &Bind(int Value) { m_vBinds.push_back(std::to_string(Value)); return *this; }
+	CFakeStatement &Bind(double Value) { m_vBinds.push_back(std::to_string(Value)); return *this; }
+	CFakeStatement &Bind(const std::string &Value) { m_vBinds.push_back(Value); return *this; }
+};
+
+TEST(DBField, SchemaDefaultsAndUpdate)
+{
+	DBFieldContainer<CTestSchema> Data;
+	EXPECT_EQ(Data.Get<0>(), 1);
+	EXPECT_FLOAT_EQ(Data.Get<1>(), 0.5f);
+	EXPECT_EQ(Data.Get<2>(), "none");
+	EXPECT_EQ(DBFieldContainer<CTestSchema>::GetUpdateColumns(), "Level = ?, Speed = ?, Title = ?");
+	EXPECT_EQ(&DBFieldContainer<CTestSchema>::GetUpdateColumns(), &DBFieldContainer<CTestSchema>::GetUpdateColumns());
+
+	auto pRes = std::make_unique<CFakeResult>();
+	pRes->m_Row = {{"Level", "7"}, {"Speed", "1.25"}, {"Title", "it's"}};
+	std::unique_ptr<ISqlResult> Res(std::move(pRes));
+	Data.InitFields(&Res);
+	EXPECT_EQ(Data.Get<0>(), 7);
+	EXPECT_FLOAT_EQ(Data.Get<1>(), 1.25f);
+	EXPECT_EQ(Data.Get<2>(), "it's");
+
+	CFakeStatement Statement;
+	Data.BindFields(Statement);
+	ASSERT_EQ(Statement.m_vBinds.size(), 3u);
+	EXPECT_EQ(Statement.m_vBinds[0], "7");
+	EXPECT_EQ(Statement.m_vBinds[1], "1.250000");
+	EXPECT_EQ(Statement.m_vBinds[2], "it's");
+
+	Data.Reset();
+	EXPECT_EQ(Data.Get<0>(), 1);
+}
+
+TEST(DBField, RuntimeAccess)
+{
+	using CJobFields = DBFieldContainer<CTestJobSchema>;
+	CJobFields Data;
+	ASSERT_NE(Data.At(2), nullptr);
+	*Data.At(2) = 5;
+	EXPECT_EQ(Data.Get<2>(), 5);
+	EXPECT_EQ(Data.At(3), nullptr);
+	EXPECT_EQ(Data.At((size_t)-1), nullptr);
+	EXPECT_STREQ(CJobFields::GetFieldName(1), "Exp");
+	EXPECT_STREQ(CJobFields::GetDescription(0), "Job level");
+	EXPECT_STREQ(CJobFields::GetFieldName(3), "");
+}
+
+// the former container: a list of variants searched by id on every access
+class CReferenceFields
+{
+	struct CField
+	{
+		size_t m_UniqueID;
+		int m_Value;
+	};
+	using FieldVariant = std::variant<CField, float>;
+	std::list<FieldVariant> m_VariantsData;
+
+public:
+	CReferenceFields() { m_VariantsData = {CField {0, 1}, CField {1, 0}, CField {2, 0}}; }
+
+	int &operator()(size_t UniqueID)
+	{
+		auto it = std::find_if(m_VariantsData.begin(), m_VariantsData.end(), [UniqueID](auto &p) {
+			try { return std::get<CField>(p).m_UniqueID == UniqueID; }
+			catch(const std::bad_variant_access &) { return false; }
+		});
+		return std::get<CField>(*it).m_Value;
+	}
+};
+
+TEST(DBField, Benchmark)
+{
+	// job experience gain as done for every gathered ore or plant
+	const int Players = 64;
+	const int Iterations = 20000;
+	std::vector<CReferenceFields> vReference(Players);
+	std::vector<DBFieldContainer<CTestJobSchema>> vCurrent(Players);
+
+	int64_t Start = time_get();
+	for(int i = 0; i < Iterations; i++)
+	{
+		for(auto &Fields : vReference)
+		{
+			Fields(1) += 3;
+			if(Fields(1) >= Fields(0) * 100)
+			{
+				Fields(1) -= Fields(0) * 100;
+				Fields(0)++;
+				Fields(2)++;
+			}
+		}
+	}
+	const int64_t Reference = time_get() - Start;
+
+	Start = time_get();
+	for(int i = 0; i < Iterations; i++)
+	{
+		for(auto &Fields : vCurrent)
+		{
+			Fields.Get<1>() += 3;
+			if(Fields.Get<1>() >= Fields.Get<0>() * 100)
+			{
+				Fields.Get<1>() -= Fields.Get<0>() * 100;
+				Fields.Get<0>()++;
+				Fields.Get<2>()++;
+			}
+		}
+	}
+	const int64_t Current = time_get() - Start;
+
+	EXPECT_EQ(vReference[0](0), vCurrent[0].Get<0>());
+	EXPECT_EQ(vReference[Players - 1](2), vCurrent[Players - 1].Get<2>());
+	printf("job field access %d players: variant list %.1fns, schema %.1fns per update\n", Players,
+		Reference * 1000000000.0 / time_freq() / Iterations / Players, Current * 1000000000.0 / time_freq() / Iterations / Players);
+}
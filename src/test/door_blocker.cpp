@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/server/door_blocker.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+struct CTestDoor
+{
+	vec2 m_From;
+	vec2 m_To;
+	int m_ID;
+};
+
+// the test every door did for every character before the index
+static bool DoorHit(vec2 From, vec2 To, vec2 Pos, float Radius)
+{
+	vec2 IntersectPos;
+	return closest_point_on_line(From, To, Pos, IntersectPos) && distance(IntersectPos, Pos) <= Radius;
+}
+
+static std::vector<CTestDoor> MakeDoors(CDoorBlockerSystem &System, int Num, std::mt19937 &Rng, float MapSize)
+{
+	std::uniform_real_distribution<float> Coord(0.0f, MapSize);
+	std::uniform_int_distribution<int> Length(2, 8);
+	std::vector<CTestDoor> vDoors;
+	for(int i = 0; i < Num; i++)
+	{
+		const vec2 From(Coord(Rng), Coord(Rng));
+		const vec2 To = From + ((i % 2) ? vec2(0.0f, -32.0f) : vec2(32.0f, 0.0f)) * (float)Length(Rng);
+		vDoors.push_back({From, To, System.AddSegment(From, To)});
+	}
+	return vDoors;
+}
+
+TEST(DoorBlocker, MatchesBruteForce)
+{
+	const float aRadii[] = {16.0f, 48.0f, 64.0f, 144.0f};
+	for(unsigned Seed = 0; Seed < 6; Seed++)
+	{
+		std::mt19937 Rng(Seed);
+		CDoorBlockerSystem System;
+		const float MapSize = 1000.0f + Seed * 1500.0f;
+		std::vector<CTestDoor> vDoors = MakeDoors(System, 40, Rng, MapSize);
+
+		// a few characters right on the doors, the rest anywhere, some outside the map
+		std::uniform_real_distribution<float> Coord(-200.0f, MapSize + 200.0f), Offset(-100.0f, 100.0f);
+		std::vector<vec2> vBodies(MAX_CLIENTS);
+		for(int i = 0; i < MAX_CLIENTS; i++)
+		{
+			const CTestDoor &Door = vDoors[i % vDoors.size()];
+			vBodies[i] = (i % 3 == 0) ? mix(Door.m_From, Door.m_To, 0.5f) + vec2(Offset(Rng), Offset(Rng)) : vec2(Coord(Rng), Coord(Rng));
+		}
+
+		System.BeginRebuild(1);
+		for(int i = 0; i < MAX_CLIENTS; i++)
+			System.AddBody(i, vBodies[i]);
+		System.EndRebuild();
+
+		for(const CTestDoor &Door : vDoors)
+		{
+			for(float Radius : aRadii)
+			{
+				std::vector<int> vExpected, vFound;
+				for(int i = 0; i < MAX_CLIENTS; i++)
+					if(DoorHit(Door.m_From, Door.m_To, vBodies[i], Radius))
+						vExpected.push_back(i);
+				System.ForEachCandidate(Door.m_ID, Radius, [&](int ClientID) {
+					if(DoorHit(Door.m_From, Door.m_To, vBodies[ClientID], Radius))
+						vFound.push_back(ClientID);
+				});
+				std::sort(vFound.begin(), vFound.end());
+				EXPECT_EQ(vFound, vExpected) << "seed " << Seed << " door " << Door.m_ID << " radius " << Radius;
+			}
+		}
+	}
+}
+
+TEST(DoorBlocker, SegmentsAndAccess)
+{
+	CDoorBlockerSystem System;
+	int HouseA, HouseB;
+	const int DoorA1 = System.AddSegment(vec2(0, 0), vec2(0, 64), &HouseA);
+	const int DoorA2 = System.AddSegment(vec2(100, 0), vec2(100, 64), &HouseA);
+	const int DoorB = System.AddSegment(vec2(200, 0), vec2(200, 64), &HouseB);
+	const int Wall = System.AddSegment(vec2(300, 0), vec2(300, 64));
+
+	// removed ids are handed out again
+	System.RemoveSegment(Wall);
+	System.RemoveSegment(Wall);
+	EXPECT_EQ(System.AddSegment(vec2(400, 0), vec2(400, 64)), Wall);
+	EXPECT_EQ(System.GetFrom(Wall), vec2(400, 0));
+
+	// one computation per owner and client until the next tick
+	int Calls = 0;
+	auto Allow = [&]() { Calls++; return true; };
+	auto Deny = [&]() { Calls++; return false; };
+	EXPECT_TRUE(System.NeedsRebuild(5));
+	System.BeginRebuild(5);
+	System.EndRebuild();
+	EXPECT_FALSE(System.NeedsRebuild(5));
+	EXPECT_TRUE(System.HasAccess(DoorA1, 3, Allow));
+	EXPECT_TRUE(System.HasAccess(DoorA2, 3, Deny));
+	EXPECT_FALSE(System.HasAccess(DoorB, 3, Deny));
+	EXPECT_FALSE(System.HasAccess(DoorA2, 4, Deny));
+	EXPECT_EQ(Calls, 3);
+
+	// segments without an owner are never cached
+	EXPECT_TRUE(System.HasAccess(Wall, 3, Allow));
+	EXPECT_TRUE(System.HasAccess(Wall, 3, Allow));
+	EXPECT_EQ(Calls, 5);
+
+	EXPECT_TRUE(System.NeedsRebuild(6));
+	System.BeginRebuild(6);
+	System.EndRebuild();
+	EXPECT_FALSE(System.HasAccess(DoorA1, 3, Deny));
+	EXPECT_EQ(Calls, 6);
+
+	System.MarkDirty();
+	EXPECT_TRUE(System.NeedsRebuild(6));
+}
+
+TEST(DoorBlocker, Benchmark)
+{
+	// 50 doors and walls on a large map, a full server of characters
+	const int NumDoors = 50;
+	const int NumTicks = 200;
+	const float Radius = 16.0f;
+	std::mt19937 Rng(7);
+	CDoorBlockerSystem System;
+	std::vector<CTestDoor> vDoors = MakeDoors(System, NumDoors, Rng, 9000.0f);
+
+	std::uniform_real_distribution<float> Coord(0.0f, 9000.0f), Step(-10.0f, 10.0f);
+	std::vector<vec2> vBodies(MAX_CLIENTS);
+	for(auto &Pos : vBodies)
+		Pos = vec2(Coord(Rng), Coord(Rng));
+	std::vector<std::vector<vec2>> vvPositions(NumTicks);
+	for(auto &vPositions : vvPositions)
+	{
+		for(auto &Pos : vBodies)
+			Pos += vec2(Step(Rng), Step(Rng));
+		vPositions = vBodies;
+	}
+
+	int Hits = 0;
+	int64_t Start = time_get();
+	for(const auto &vPositions : vvPositions)
+		for(const CTestDoor &Door : vDoors)
+			for(int i = 0; i < MAX_CLIENTS; i++)
+				Hits += DoorHit(Door.m_From, Door.m_To, vPositions[i], Radius);
+	const int64_t Reference = time_get() - Start;
+
+	Start = time_get();
+	for(int Tick = 0; Tick < NumTicks; Tick++)
+	{
+		const auto &vPositions = vvPositions[Tick];
+		System.BeginRebuild(Tick);
+		for(int i = 0; i < MAX_CLIENTS; i++)
+			System.AddBody(i, vPositions[i]);
+		System.EndRebuild();
+		for(const CTestDoor &Door : vDoors)
+			System.ForEachCandidate(Door.m_ID, Radius, [&](int ClientID) { Hits -= DoorHit(Door.m_From, Door.m_To, vPositions[ClientID], Radius); });
+	}
+	const int64_t Current = time_get() - Start;
+
+	EXPECT_EQ(Hits, 0);
+	printf("door blockers %d doors, %d characters: reference %.1fus, current %.1fus per tick\n", NumDoors, MAX_CLIENTS,
+		Reference * 1000000.0 / time_freq() / NumTicks, Current * 1000000.0 / time_freq() / NumTicks);
+}
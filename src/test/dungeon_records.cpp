@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/server/core/tools/dungeon_records.h>
+
+#include <map>
+#include <random>
+
+// what the leaderboard has to agree with, sorted out of every best passage
+static std::vector<CDungeonRecords::CRecord> ExpectedTop(const std::map<int, CDungeonRecords::CRecord>& Best)
+{
+	std::vector<CDungeonRecords::CRecord> vAll;
+	for(const auto& [UserID, Record] : Best)
+		vAll.push_back(Record);
+	std::sort(vAll.begin(), vAll.end(), [](const CDungeonRecords::CRecord& Left, const CDungeonRecords::CRecord& Right) {
+		return Left.m_Seconds != Right.m_Seconds ? Left.m_Seconds < Right.m_Seconds : Left.m_UserID < Right.m_UserID;
+	});
+	vAll.resize(std::min((int)vAll.size(), (int)CDungeonRecords::TOP_SIZE));
+	return vAll;
+}
+
+TEST(DungeonRecords, Fuzz)
+{
+	std::mt19937 Rng(48);
+	std::uniform_int_distribution<int> RandUser(1, 200), RandSeconds(60, 900), RandHelp(0, 500);
+
+	CDungeonRecords Records;
+	std::map<int, CDungeonRecords::CRecord> Best;
+	for(int Step = 0; Step < 20000; Step++)
+	{
+		const int UserID = RandUser(Rng);
+		const int Seconds = RandSeconds(Rng);
+		const int PassageHelp = RandHelp(Rng);
+
+		auto Iter = Best.find(UserID);
+		const bool NewBest = Iter == Best.end() || Seconds < Iter->second.m_Seconds;
+		if(NewBest)
+			Best[UserID] = {UserID, Seconds, PassageHelp};
+		ASSERT_EQ(Records.Submit(UserID, Seconds, PassageHelp), NewBest);
+
+		const CDungeonRecords::CRecord* pRecord = Records.Find(UserID);
+		ASSERT_NE(pRecord, nullptr);
+		ASSERT_EQ(pRecord->m_Seconds, Best[UserID].m_Seconds);
+		ASSERT_EQ(pRecord->m_PassageHelp, Best[UserID].m_PassageHelp);
+
+		const auto vExpected = ExpectedTop(Best);
+		const auto& vTop = Records.Top();
+		ASSERT_EQ(vTop.size(), vExpected.size());
+		for(size_t i = 0; i < vTop.size(); i++)
+		{
+			ASSERT_EQ(vTop[i].m_UserID, vExpected[i].m_UserID) << "rank " << i << " step " << Step;
+			ASSERT_EQ(vTop[i].m_Seconds, vExpected[i].m_Seconds);
+			ASSERT_EQ(vTop[i].m_PassageHelp, vExpected[i].m_PassageHelp);
+		}
+	}
+	EXPECT_EQ(Records.Size(), (int)Best.size());
+	EXPECT_EQ(Records.Find(0), nullptr);
+}
+
+TEST(DungeonRecords, Benchmark)
+{
+	// the former leaderboard: every record of the dungeon sorted for the first five
+	const int Users = 2000, Runs = 2000;
+	std::mt19937 Rng(48);
+	CDungeonRecords Records;
+	std::vector<CDungeonRecords::CRecord> vTable;
+	for(int UserID = 1; UserID <= Users; UserID++)
+	{
+		const int Seconds = 60 + (int)(Rng() % 840);
+		Records.Submit(UserID, Seconds, 0);
+		vTable.push_back({UserID, Seconds, 0});
+	}
+
+	int Sum = 0;
+	int64_t Start = time_get();
+	for(int r = 0; r < Runs; r++)
+	{
+		auto vSorted = vTable;
+		std::partial_sort(vSorted.begin(), vSorted.begin() + CDungeonRecords::TOP_SIZE, vSorted.end(),
+			[](const CDungeonRecords::CRecord& Left, const CDungeonRecords::CRecord& Right) { return Left.m_Seconds < Right.m_Seconds; });
+		for(int i = 0; i < CDungeonRecords::TOP_SIZE; i++)
+			Sum += vSorted[i].m_Seconds;
+	}
+	const int64_t Reference = time_get() - Start;
+
+	Start = time_get();
+	for(int r = 0; r < Runs; r++)
+	{
+		for(const auto& Record : Records.Top())
+			Sum -= Record.m_Seconds;
+	}
+	const int64_t Current = time_get() - Start;
+
+	EXPECT_EQ(Sum, 0);
+	printf("dungeon records %d users: reference %.1fns, current %.1fns per leaderboard\n", Users,
+		Reference * 1000000000.0 / time_freq() / Runs, Current * 1000000000.0 / time_freq() / Runs);
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/server/core/tools/inventory_index.h>
+
+#include <map>
+#include <random>
+
+struct CTestItem
+{
+	int m_Type;
+	int m_Slot;
+	int m_Value = 0;
+	bool m_Settings = false;
+
+	bool Held() const { return m_Value > 0; }
+	bool Equipped() const { return m_Value > 0 && m_Settings; }
+};
+
+// what the index has to agree with, found by scanning every item
+static void ExpectConsistent(const CInventoryIndex& Index, const std::map<int, CTestItem>& Items, int NumTypes, int NumSlots)
+{
+	for(int Type = 0; Type < NumTypes; Type++)
+	{
+		std::vector<int> vExpected;
+		for(const auto& [ID, Item] : Items)
+			if(Item.Held() && Item.m_Type == Type)
+				vExpected.push_back(ID);
+		ASSERT_EQ(Index.Held(Type), vExpected) << "type " << Type;
+		ASSERT_EQ(Index.Count(Type), (int)vExpected.size());
+	}
+
+	std::vector<int> vAllEquipped;
+	for(int Slot = -1; Slot < NumSlots; Slot++)
+	{
+		std::vector<int> vHeld, vEquipped;
+		for(const auto& [ID, Item] : Items)
+		{
+			if(Item.Held() && Item.m_Slot == Slot)
+				vHeld.push_back(ID);
+			if(Item.Equipped() && Item.m_Slot == Slot)
+				vEquipped.push_back(ID);
+		}
+		ASSERT_EQ(Index.HeldInSlot(Slot), vHeld) << "slot " << Slot;
+		ASSERT_EQ(Index.Equipped(Slot), vEquipped) << "slot " << Slot;
+		ASSERT_EQ(Index.FindEquipped(Slot), vEquipped.empty() ? -1 : vEquipped[0]);
+		if(!vEquipped.empty())
+			ASSERT_EQ(Index.FindEquipped(Slot, vEquipped[0]), vEquipped.size() > 1 ? vEquipped[1] : -1);
+		vAllEquipped.insert(vAllEquipped.end(), vEquipped.begin(), vEquipped.end());
+	}
+	std::sort(vAllEquipped.begin(), vAllEquipped.end());
+	ASSERT_EQ(Index.Equipped(), vAllEquipped);
+}
+
+TEST(InventoryIndex, Fuzz)
+{
+	const int NumTypes = 9, NumSlots = 14, NumItems = 300;
+	std::mt19937 Rng(47);
+	std::uniform_int_distribution<int> RandItem(1, NumItems), RandOp(0, 5), RandValue(1, 5);
+
+	// item descriptions stay fixed, as they do on the server
+	std::map<int, CTestItem> Items;
+	for(int ID = 1; ID <= NumItems; ID++)
+		Items[ID] = {(int)(Rng() % NumTypes), (int)(Rng() % (NumSlots + 1)) - 1};
+
+	CInventoryIndex Index;
+	auto Update = [&](int ID) {
+		const CTestItem& Item = Items[ID];
+		Index.Set(ID, Item.m_Type, Item.m_Slot, Item.Held(), Item.Equipped());
+	};
+
+	for(int Step = 0; Step < 20000; Step++)
+	{
+		const int ID = RandItem(Rng);
+		CTestItem& Item = Items[ID];
+		switch(RandOp(Rng))
+		{
+		case 0: // add
+		case 1:
+			Item.m_Value += RandValue(Rng);
+			break;
+		case 2: // remove, the last one unequips
+			Item.m_Value = std::max(0, Item.m_Value - RandValue(Rng));
+			if(!Item.m_Value)
+				Item.m_Settings = false;
+			break;
+		case 3: // equip, one item per slot
+			if(Item.Held())
+			{
+				Item.m_Settings = !Item.m_Settings;
+				Update(ID);
+				for(int Other = Index.FindEquipped(Item.m_Slot, ID); Item.m_Settings && Other >= 1; Other = Index.FindEquipped(Item.m_Slot, ID))
+				{
+					Items[Other].m_Settings = false;
+					Update(Other);
+				}
+			}
+			break;
+		case 4: // looked up without a change
+			break;
+		case 5: // logout and load again now and then
+			if(Step % 1000 == 5)
+			{
+				Index.Clear();
+				for(const auto& [OtherID, Other] : Items)
+					Update(OtherID);
+			}
+			break;
+		}
+		Update(ID);
+		if(Step % 50 == 0)
+			ExpectConsistent(Index, Items, NumTypes, NumSlots);
+		if(HasFatalFailure())
+			return;
+	}
+	ExpectConsistent(Index, Items, NumTypes, NumSlots);
+}
+
+TEST(InventoryIndex, Benchmark)
+{
+	// the former count: a pass over every item with a description lookup each
+	const int NumTypes = 9, NumItems = 400, Runs = 20000;
+	std::map<int, CTestItem> Descriptions;
+	std::map<int, CTestItem> Items;
+	CInventoryIndex Index;
+	for(int ID = 1; ID <= NumItems; ID++)
+	{
+		Descriptions[ID] = {ID % NumTypes, ID % 8};
+		Items[ID] = {0, 0, ID % 3};
+		Index.Set(ID, ID % NumTypes, ID % 8, Items[ID].Held(), false);
+	}
+
+	int Sum = 0;
+	int64_t Start = time_get();
+	for(int r = 0; r < Runs; r++)
+		for(const auto& [ID, Item] : Items)
+			Sum += Item.Held() && Descriptions[ID].m_Type == r % NumTypes;
+	const int64_t Reference = time_get() - Start;
+
+	Start = time_get();
+	for(int r = 0; r < Runs; r++)
+		Sum -= Index.Count(r % NumTypes);
+	const int64_t Current = time_get() - Start;
+
+	EXPECT_EQ(Sum, 0);
+	printf("inventory %d items: reference %.1fns, current %.1fns per type count\n", NumItems,
+		Reference * 1000000000.0 / time_freq() / Runs, Current * 1000000000.0 / time_freq() / Runs);
+}
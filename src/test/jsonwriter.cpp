@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/shared/jsonwriter.h>
+#include <teeother/tl/nlohmann_json.h>
+
+static void WriteServerInfo(CJsonWriter *pJson, int Clients)
+{
+	pJson->BeginObject();
+	pJson->WriteAttribute("max_clients");
+	pJson->WriteIntValue(64);
+	pJson->WriteAttribute("name");
+	pJson->WriteStrValue("MRPG \"test\"\n");
+	pJson->WriteAttribute("map");
+	pJson->BeginObject();
+	pJson->WriteAttribute("name");
+	pJson->WriteStrValue("Multiworld");
+	pJson->EndObject();
+	pJson->WriteAttribute("clients");
+	pJson->BeginArray();
+	for(int i = 0; i < Clients; i++)
+	{
+		pJson->BeginObject();
+		pJson->WriteAttribute("name");
+		pJson->WriteStrValue("nameless tee");
+		pJson->WriteAttribute("score");
+		pJson->WriteIntValue(i);
+		pJson->WriteAttribute("is_player");
+		pJson->WriteBoolValue(i % 2 == 0);
+		pJson->EndObject();
+	}
+	pJson->EndArray();
+	pJson->EndObject();
+}
+
+TEST(JsonWriter, CompactBuffer)
+{
+	CJsonBufferWriter Writer;
+	WriteServerInfo(&Writer, 2);
+	EXPECT_STREQ(Writer.GetOutput(),
+		"{\"max_clients\":64,\"name\":\"MRPG \\\"test\\\"\\n\",\"map\":{\"name\":\"Multiworld\"},"
+		"\"clients\":[{\"name\":\"nameless tee\",\"score\":0,\"is_player\":true},{\"name\":\"nameless tee\",\"score\":1,\"is_player\":false}]}");
+	EXPECT_EQ(Writer.GetOutputLength(), str_length(Writer.GetOutput()));
+
+	// a new document in the same writer
+	Writer.Clear();
+	Writer.BeginArray();
+	Writer.EndArray();
+	EXPECT_STREQ(Writer.GetOutput(), "[]");
+
+	Writer.Clear();
+	WriteServerInfo(&Writer, 0);
+	const nlohmann::json Parsed = nlohmann::json::parse(Writer.GetOutput());
+	EXPECT_EQ(Parsed["name"], "MRPG \"test\"\n");
+	EXPECT_TRUE(Parsed["clients"].empty());
+}
+
+TEST(JsonWriter, Benchmark)
+{
+	// the former serialization: a document tree dumped to a new string
+	const int Clients = 64;
+	const int Runs = 2000;
+	size_t Size = 0;
+	int64_t Start = time_get();
+	for(int r = 0; r < Runs; r++)
+	{
+		nlohmann::json JsServerInfo;
+		JsServerInfo["max_clients"] = 64;
+		JsServerInfo["name"] = "MRPG \"test\"\n";
+		JsServerInfo["map"]["name"] = "Multiworld";
+		for(int i = 0; i < Clients; i++)
+		{
+			nlohmann::json JsPlayerInfo;
+			JsPlayerInfo["name"] = "nameless tee";
+			JsPlayerInfo["score"] = i;
+			JsPlayerInfo["is_player"] = i % 2 == 0;
+			JsServerInfo["clients"].push_back(JsPlayerInfo);
+		}
+		Size += JsServerInfo.dump(-1).size();
+	}
+	const int64_t Reference = time_get() - Start;
+
+	CJsonBufferWriter Writer;
+	Start = time_get();
+	for(int r = 0; r < Runs; r++)
+	{
+		Writer.Clear();
+		WriteServerInfo(&Writer, Clients);
+		Size += Writer.GetOutputLength();
+	}
+	const int64_t Current = time_get() - Start;
+
+	EXPECT_GT(Size, 0u);
+	printf("server info %d clients: reference %.1fus, current %.1fus per document\n", Clients,
+		Reference * 1000000.0 / time_freq() / Runs, Current * 1000000.0 / time_freq() / Runs);
+}
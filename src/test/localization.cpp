@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <teeother/components/localization_template.h>
+
+#include <cstdio>
+
+// the per call parser templates replace, kept as the reference for the output
+static void ReferenceFormat_V(dynamic_string &Buffer, const char *pText, va_list VarArgs)
+{
+	int BufferIter = Buffer.length();
+	int ParamTypeStart = -1;
+
+	va_list VarArgsIter;
+	va_copy(VarArgsIter, VarArgs);
+
+	int Iter = 0;
+	int Start = 0;
+	while(pText[Iter])
+	{
+		if(ParamTypeStart >= 0)
+		{
+			if(pText[Iter] != '}')
+			{
+				Iter = str_utf8_forward(pText, Iter);
+				continue;
+			}
+
+			if(str_comp_num("STR", pText + ParamTypeStart, 3) == 0)
+			{
+				const char *pVarArgValue = va_arg(VarArgsIter, const char *);
+				BufferIter = Buffer.append_at(BufferIter, str_comp(pVarArgValue, "sword") == 0 ? "schwert" : pVarArgValue);
+			}
+			else if(str_comp_num("INT", pText + ParamTypeStart, 3) == 0)
+			{
+				char aBuf[128];
+				str_format(aBuf, sizeof(aBuf), "%d", va_arg(VarArgsIter, int));
+				BufferIter = Buffer.append_at(BufferIter, aBuf);
+			}
+			else if(str_comp_num("VAL", pText + ParamTypeStart, 3) == 0)
+			{
+				BufferIter = Buffer.append_at(BufferIter, get_commas<int>(va_arg(VarArgsIter, int)).c_str());
+			}
+
+			Start = Iter + 1;
+			ParamTypeStart = -1;
+		}
+		else if(pText[Iter] == '{')
+		{
+			BufferIter = Buffer.append_at_num(BufferIter, pText + Start, Iter - Start);
+			Iter++;
+			ParamTypeStart = Iter;
+		}
+
+		Iter = str_utf8_forward(pText, Iter);
+	}
+
+	va_end(VarArgsIter);
+
+	if(Iter > 0 && ParamTypeStart == -1)
+		Buffer.append_at_num(BufferIter, pText + Start, Iter - Start);
+}
+
+static const char *Translate(const char *pText)
+{
+	return str_comp(pText, "sword") == 0 ? "schwert" : nullptr;
+}
+
+static void ReferenceFormat(dynamic_string &Buffer, const char *pText, ...)
+{
+	va_list VarArgs;
+	va_start(VarArgs, pText);
+	ReferenceFormat_V(Buffer, pText, VarArgs);
+	va_end(VarArgs);
+}
+
+static void TemplateFormat(const CLocalizationTemplate *pTemplate, dynamic_string *pBuffer, ...)
+{
+	va_list VarArgs;
+	va_start(VarArgs, pBuffer);
+	pTemplate->Format(*pBuffer, VarArgs, Translate);
+	va_end(VarArgs);
+}
+
+TEST(Localization, TemplateMatchesReference)
+{
+	const char *apTexts[] = {
+		"",
+		"plain text",
+		"{STR} got {INT} x {VAL}",
+		"{STR}{INT}{VAL}",
+		"Price: {STR} ({INT}%) costs {VAL} gold",
+		"unknown {FOO} placeholder {STR} {INT} {VAL}",
+		"unterminated {STR",
+		"empty {} {STR} braces {STR} {INT} {VAL}",
+		"✎ {STR} äöü {INT} ★ {VAL} end",
+		"{",
+		"trailing {",
+		"{STRING} {INTEGER} {VALUE}",
+	};
+
+	// every text takes a prefix of the arguments below
+	for(const char *pText : apTexts)
+	{
+		CLocalizationTemplate Template;
+		Template.Compile(pText, pText);
+
+		dynamic_string Reference, Current;
+		Reference.append("prefix ");
+		Current.append("prefix ");
+		ReferenceFormat(Reference, pText, "sword", -12345, 1234567, "shield", 7, -7);
+		TemplateFormat(&Template, &Current, "sword", -12345, 1234567, "shield", 7, -7);
+		EXPECT_STREQ(Current.buffer(), Reference.buffer()) << "text: " << pText;
+	}
+}
+
+TEST(Localization, TemplateBenchmark)
+{
+	const char *pText = "Player {STR} has {VAL} gold and reached level {INT}, equipped with a {STR} (+{INT} damage)";
+	CLocalizationTemplate Template;
+	Template.Compile(pText, pText);
+
+	const int Iterations = 200000;
+	dynamic_string Buffer;
+
+	int64_t Start = time_get();
+	for(int i = 0; i < Iterations; i++)
+	{
+		Buffer.clear();
+		ReferenceFormat(Buffer, pText, "nameless tee", 1234567, i, "sword", 42);
+	}
+	const int64_t Reference = time_get() - Start;
+
+	Start = time_get();
+	for(int i = 0; i < Iterations; i++)
+	{
+		Buffer.clear();
+		TemplateFormat(&Template, &Buffer, "nameless tee", 1234567, i, "sword", 42);
+	}
+	const int64_t Current = time_get() - Start;
+
+	printf("localization format: reparse %.1fns, template %.1fns per call\n",
+		Reference * 1000000000.0 / time_freq() / Iterations, Current * 1000000000.0 / time_freq() / Iterations);
+}
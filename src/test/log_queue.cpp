@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/shared/log_queue.h>
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static void MakeMessage(CLogMessage *pMessage, int Producer, int Seq)
+{
+	pMessage->m_Level = LEVEL_INFO;
+	pMessage->m_HaveColor = false;
+	str_copy(pMessage->m_aSystem, "sql", sizeof(pMessage->m_aSystem));
+	pMessage->m_TimestampLength = 0;
+	pMessage->m_SystemLength = 3;
+	pMessage->m_LineMessageOffset = 5;
+	pMessage->m_LineLength = str_format(pMessage->m_aLine, sizeof(pMessage->m_aLine), "sql: %d %d", Producer, Seq);
+}
+
+TEST(LogQueue, SixteenProducers)
+{
+	const int Producers = 16;
+	const int PerProducer = 20000;
+	CLogQueue Queue;
+	Queue.Init(1024);
+
+	std::atomic<int> Pushed {0};
+	std::atomic_bool Done {false};
+	std::vector<std::thread> vThreads;
+	for(int p = 0; p < Producers; p++)
+	{
+		vThreads.emplace_back([&, p]() {
+			CLogMessage Message;
+			for(int i = 0; i < PerProducer; i++)
+			{
+				MakeMessage(&Message, p, i);
+				if(Queue.Push(&Message))
+					Pushed++;
+			}
+		});
+	}
+
+	// drained in budgets like the server loop does, lines of one producer stay in order
+	std::vector<int> vLast(Producers, -1);
+	int Received = 0;
+	std::thread Joiner([&]() {
+		for(auto &Thread : vThreads)
+			Thread.join();
+		Done = true;
+	});
+	CLogMessage Message;
+	auto Consume = [&](const CLogRecord &Record) {
+		Record.Get(&Message);
+		int Producer, Seq;
+		ASSERT_EQ(sscanf(Message.Message(), "%d %d", &Producer, &Seq), 2);
+		ASSERT_GE(Producer, 0);
+		ASSERT_LT(Producer, Producers);
+		EXPECT_GT(Seq, vLast[Producer]);
+		vLast[Producer] = Seq;
+		EXPECT_STREQ(Message.m_aSystem, "sql");
+		Received++;
+	};
+	while(!Done.load())
+		Queue.Drain(256, Consume);
+	Joiner.join();
+	Queue.Drain(1 << 30, Consume);
+
+	EXPECT_TRUE(Queue.Empty());
+	EXPECT_EQ(Received, Pushed.load());
+	EXPECT_EQ((uint64_t)Received + Queue.Dropped(), (uint64_t)Producers * PerProducer);
+}
+
+TEST(LogQueue, FullQueueDropsAndCutsLongLines)
+{
+	CLogQueue Queue;
+	Queue.Init(4);
+	CLogMessage Message;
+	for(int i = 0; i < 6; i++)
+	{
+		MakeMessage(&Message, 0, i);
+		EXPECT_EQ(Queue.Push(&Message), i < 4);
+	}
+	EXPECT_EQ(Queue.Dropped(), 2u);
+	EXPECT_EQ(Queue.Drain(3, [](const CLogRecord &) {}), 3);
+	EXPECT_EQ(Queue.Drain(3, [](const CLogRecord &) {}), 1);
+
+	// a line longer than a record keeps its head
+	memset(Message.m_aLine, 'a', sizeof(Message.m_aLine) - 1);
+	Message.m_aLine[sizeof(Message.m_aLine) - 1] = '\0';
+	Message.m_LineLength = sizeof(Message.m_aLine) - 1;
+	ASSERT_TRUE(Queue.Push(&Message));
+	Queue.Drain(1, [&](const CLogRecord &Record) {
+		Record.Get(&Message);
+		EXPECT_EQ(Message.m_LineLength, CLogRecord::MAX_LINE_LENGTH - 1);
+		EXPECT_EQ(str_length(Message.m_aLine), Message.m_LineLength);
+	});
+}
+
+TEST(LogQueue, Benchmark)
+{
+	// the former path: every producer takes one lock and copies into a vector
+	// lines the queue drops when the consumer falls behind are cheaper than kept ones, the count is printed
+	const int Producers = 16;
+	const int PerProducer = 5000;
+	auto Run = [&](auto &&Push, auto &&Drain) {
+		std::atomic_bool Done {false};
+		std::vector<std::thread> vThreads;
+		const int64_t Start = time_get();
+		for(int p = 0; p < Producers; p++)
+		{
+			vThreads.emplace_back([&, p]() {
+				CLogMessage Message;
+				for(int i = 0; i < PerProducer; i++)
+				{
+					MakeMessage(&Message, p, i);
+					Push(&Message);
+				}
+			});
+		}
+		std::thread Consumer([&]() {
+			while(!Done.load())
+				Drain();
+		});
+		for(auto &Thread : vThreads)
+			Thread.join();
+		const int64_t Time = time_get() - Start;
+		Done = true;
+		Consumer.join();
+		return Time;
+	};
+
+	std::mutex Mutex;
+	std::vector<CLogMessage> vPending;
+	auto LockedPush = [&](const CLogMessage *pMessage) {
+		std::lock_guard<std::mutex> Lock(Mutex);
+		vPending.push_back(*pMessage);
+	};
+	auto LockedDrain = [&]() {
+		std::lock_guard<std::mutex> Lock(Mutex);
+		vPending.clear();
+	};
+	const int64_t Reference = Run(LockedPush, LockedDrain);
+
+	CLogQueue Queue;
+	Queue.Init(1024);
+	const int64_t Current = Run([&](const CLogMessage *pMessage) { Queue.Push(pMessage); }, [&]() { Queue.Drain(256, [](const CLogRecord &) {}); });
+
+	const int Total = Producers * PerProducer;
+	printf("log queue %d producers: reference %.1fns, current %.1fns per line (%llu dropped)\n", Producers,
+		Reference * 1000000000.0 / time_freq() / Total, Current * 1000000000.0 / time_freq() / Total, (unsigned long long)Queue.Dropped());
+}
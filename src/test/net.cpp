@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/shared/masterserver.h>
+#include <engine/shared/network_thread.h>
+
+#include <ctime>
+
+static NETSOCKET OpenLoopback(NETADDR *pAddr)
+{
+	net_addr_from_str(pAddr, "127.0.0.1");
+	for(int Port = 28303; Port < 28403; Port++)
+	{
+		pAddr->port = Port;
+		NETSOCKET Socket = net_udp_create(*pAddr);
+		if(Socket)
+			return Socket;
+	}
+	return nullptr;
+}
+
+static int DrainSocket(NETSOCKET Socket, int Expected, unsigned char *pFirstByte)
+{
+	int Received = 0;
+	for(int Tries = 0; Received < Expected && Tries < 1000; Tries++)
+	{
+		NETADDR From;
+		unsigned char *pData;
+		int Bytes = net_udp_recv(Socket, &From, &pData);
+		if(Bytes <= 0)
+		{
+			net_socket_read_wait(Socket, 1000);
+			continue;
+		}
+		pFirstByte[Received++] = pData[0];
+	}
+	return Received;
+}
+
+// sends a few ticks worth of server traffic over loopback, returns the send calls used
+static uint64_t RunTicks(bool Batching, int NumTicks, int PacketsPerTick, double *pCpuPerPacket)
+{
+	NETADDR ServerAddr, ClientAddr;
+	NETSOCKET Server = OpenLoopback(&ServerAddr);
+	NETSOCKET Client = OpenLoopback(&ClientAddr);
+	EXPECT_TRUE(Server && Client);
+	if(!Server || !Client)
+		return 0;
+
+	net_udp_set_send_batching(Server, Batching);
+
+	unsigned char aPacket[300] = {0};
+	unsigned char aFirstBytes[256];
+	NETSTATS Before, After;
+	net_stats(&Before);
+	std::clock_t CpuSend = 0;
+	for(int Tick = 0; Tick < NumTicks; Tick++)
+	{
+		std::clock_t CpuStart = std::clock();
+		for(int i = 0; i < PacketsPerTick; i++)
+		{
+			aPacket[0] = (unsigned char)i;
+			net_udp_send(Server, &ClientAddr, aPacket, sizeof(aPacket));
+		}
+		net_udp_flush(Server);
+		CpuSend += std::clock() - CpuStart;
+
+		// packet order must be kept
+		EXPECT_EQ(DrainSocket(Client, PacketsPerTick, aFirstBytes), PacketsPerTick);
+		for(int i = 0; i < PacketsPerTick; i++)
+			EXPECT_EQ(aFirstBytes[i], (unsigned char)i);
+	}
+	net_stats(&After);
+
+	*pCpuPerPacket = (double)CpuSend * 1000000.0 / CLOCKS_PER_SEC / (NumTicks * PacketsPerTick);
+	net_udp_close(Server);
+	net_udp_close(Client);
+	return After.sent_calls - Before.sent_calls;
+}
+
+TEST(Net, UdpSendBatching)
+{
+	const int NumTicks = 50;
+	const int PacketsPerTick = 64;
+
+	double CpuDirect = 0, CpuBatched = 0;
+	uint64_t DirectCalls = RunTicks(false, NumTicks, PacketsPerTick, &CpuDirect);
+	uint64_t BatchedCalls = RunTicks(true, NumTicks, PacketsPerTick, &CpuBatched);
+
+	EXPECT_EQ(DirectCalls, (uint64_t)NumTicks * PacketsPerTick);
+#if defined(CONF_PLATFORM_LINUX)
+	EXPECT_EQ(BatchedCalls, (uint64_t)NumTicks);
+#endif
+
+	printf("udp send: direct %.1f calls/tick %.2fus cpu/packet, batched %.1f calls/tick %.2fus cpu/packet\n",
+		(double)DirectCalls / NumTicks, CpuDirect, (double)BatchedCalls / NumTicks, CpuBatched);
+}
+
+TEST(Net, DatagramRingOrder)
+{
+	static CNetDatagramRing s_Ring;
+	s_Ring.Init(16);
+	const int Num = 100000;
+
+	void *pProducer = thread_init(
+		[](void *) {
+			for(int i = 0; i < Num; i++)
+			{
+				CNetDatagram *pSlot;
+				while(!(pSlot = s_Ring.BeginPush()))
+					thread_yield();
+				pSlot->m_Size = i;
+				s_Ring.EndPush();
+			}
+		},
+		nullptr, "ring producer");
+	ASSERT_TRUE(pProducer);
+
+	for(int Expected = 0; Expected < Num;)
+	{
+		const CNetDatagram *pDatagram = s_Ring.Front();
+		if(!pDatagram)
+		{
+			thread_yield();
+			continue;
+		}
+		ASSERT_EQ(pDatagram->m_Size, Expected);
+		s_Ring.Pop();
+		Expected++;
+	}
+	thread_wait(pProducer);
+	EXPECT_TRUE(s_Ring.Empty());
+}
+
+TEST(Net, RecvThreadClassify)
+{
+	unsigned char aPacket[32] = {0};
+	aPacket[0] = 0x10; // plain connection packet
+	EXPECT_EQ(CNetRecvThread::Classify(aPacket, sizeof(aPacket)), CNetRecvThread::CLASS_CLIENT);
+
+	for(int i = 0; i < 6; i++)
+		aPacket[i] = 0xff; // connless header
+	EXPECT_EQ(CNetRecvThread::Classify(aPacket, sizeof(aPacket)), CNetRecvThread::CLASS_CONNLESS);
+
+	mem_copy(aPacket + 6, SERVERBROWSE_GETINFO, SERVERBROWSE_SIZE);
+	EXPECT_EQ(CNetRecvThread::Classify(aPacket, sizeof(aPacket)), CNetRecvThread::CLASS_BROWSER);
+	mem_copy(aPacket + 6, SERVERBROWSE_GETINFO_64_LEGACY, SERVERBROWSE_SIZE);
+	EXPECT_EQ(CNetRecvThread::Classify(aPacket, sizeof(aPacket)), CNetRecvThread::CLASS_BROWSER);
+
+	// too short to carry the token byte
+	EXPECT_EQ(CNetRecvThread::Classify(aPacket, 6 + SERVERBROWSE_SIZE), CNetRecvThread::CLASS_CONNLESS);
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/shared/profiler.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(Profiler, Histogram)
+{
+	CProfileEntry Entry("test");
+	for(int i = 0; i < 98; i++)
+		Entry.Add(1000);
+	Entry.Add(50000);
+	Entry.Add(3000000);
+
+	EXPECT_EQ(Entry.Count(), 100u);
+	EXPECT_EQ(Entry.Total(), 98 * 1000 + 50000 + 3000000);
+	EXPECT_EQ(Entry.Max(), 3000000);
+	EXPECT_EQ(Entry.Percentile(50), 1024);
+	EXPECT_EQ(Entry.Percentile(99), 65536);
+	EXPECT_EQ(Entry.Percentile(100), 3000000);
+
+	Entry.Reset();
+	EXPECT_EQ(Entry.Count(), 0u);
+	EXPECT_EQ(Entry.Percentile(50), 0);
+}
+
+TEST(Profiler, ConcurrentAdd)
+{
+	CProfileEntry Entry("threads");
+	std::vector<std::thread> vThreads;
+	for(int t = 0; t < 4; t++)
+		vThreads.emplace_back([&Entry, t]() {
+			for(int i = 0; i < 10000; i++)
+				Entry.Add(t * 100 + 1);
+		});
+	for(auto &Thread : vThreads)
+		Thread.join();
+
+	EXPECT_EQ(Entry.Count(), 40000u);
+	EXPECT_EQ(Entry.Max(), 301);
+}
+
+TEST(Profiler, ReportSortsByTotal)
+{
+	CProfiler *pProfiler = CProfiler::Get();
+	CProfileEntry *pSmall = pProfiler->Entry("test/report/small");
+	CProfileEntry *pLarge = pProfiler->Entry("test/report/large");
+	EXPECT_EQ(pProfiler->Entry("test/report/small"), pSmall);
+	pSmall->Add(10);
+	pLarge->Add(100000);
+
+	std::vector<std::string> vLines;
+	pProfiler->Report("test/report", [&vLines](const char *pLine) { vLines.emplace_back(pLine); });
+	ASSERT_EQ(vLines.size(), 3u);
+	EXPECT_EQ(vLines[1].rfind("test/report/large", 0), 0u);
+	EXPECT_EQ(vLines[2].rfind("test/report/small", 0), 0u);
+}
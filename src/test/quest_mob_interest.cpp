@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/server/core/tools/quest_mob_interest.h>
+
+#include <memory>
+#include <random>
+
+TEST(QuestMobInterest, Transitions)
+{
+	auto pInterest = std::make_unique<CQuestMobInterest>();
+	const int Mob = MAX_PLAYERS, OtherMob = MAX_PLAYERS + 1;
+	pInterest->AddMob(Mob, 10, 1, 0);
+	pInterest->AddMob(OtherMob, 10, 1, 1);
+	EXPECT_EQ(pInterest->FindMob(10, 1, 0), Mob);
+	EXPECT_EQ(pInterest->FindMob(10, 1, 1), OtherMob);
+	EXPECT_EQ(pInterest->FindMob(10, 2, 0), -1);
+
+	// accept
+	pInterest->Accept(Mob, 3);
+	pInterest->Accept(Mob, 5);
+	pInterest->Accept(OtherMob, 3);
+	EXPECT_TRUE(pInterest->IsActive(Mob, 3));
+	EXPECT_FALSE(pInterest->IsActive(Mob, 4));
+	EXPECT_EQ(pInterest->Active(Mob).count(), 2u);
+	EXPECT_EQ(pInterest->Mobs(3), (std::vector<int> {Mob, OtherMob}));
+
+	// a defeat only counts for active clients, a new accept takes it back
+	pInterest->Defeat(Mob, 3);
+	pInterest->Defeat(Mob, 4);
+	EXPECT_TRUE(pInterest->IsComplete(Mob, 3));
+	EXPECT_FALSE(pInterest->IsComplete(Mob, 4));
+	pInterest->Accept(Mob, 3);
+	EXPECT_FALSE(pInterest->IsComplete(Mob, 3));
+	pInterest->Defeat(Mob, 3);
+
+	// finish keeps the mob while another client still has it
+	EXPECT_FALSE(pInterest->Finish(Mob, 3));
+	EXPECT_FALSE(pInterest->IsActive(Mob, 3));
+	EXPECT_FALSE(pInterest->IsComplete(Mob, 3));
+	EXPECT_EQ(pInterest->Mobs(3), (std::vector<int> {OtherMob}));
+	EXPECT_TRUE(pInterest->Finish(Mob, 5));
+	EXPECT_TRUE(pInterest->Finish(Mob, 5));
+
+	// abandon leaves every mob of the client
+	pInterest->Accept(Mob, 7);
+	pInterest->Accept(OtherMob, 7);
+	pInterest->Abandon(3);
+	pInterest->Abandon(7);
+	EXPECT_TRUE(pInterest->Mobs(3).empty());
+	EXPECT_TRUE(pInterest->Mobs(7).empty());
+	EXPECT_TRUE(pInterest->Active(Mob).none());
+	EXPECT_TRUE(pInterest->Finish(OtherMob, 7));
+
+	// a removed mob has no clients and its slot can be taken by the next one
+	pInterest->Accept(Mob, 1);
+	pInterest->RemoveMob(Mob);
+	EXPECT_FALSE(pInterest->IsActive(Mob, 1));
+	EXPECT_TRUE(pInterest->Mobs(1).empty());
+	EXPECT_EQ(pInterest->FindMob(10, 1, 0), -1);
+	pInterest->Accept(Mob, 1);
+	EXPECT_FALSE(pInterest->IsActive(Mob, 1));
+	pInterest->AddMob(Mob, 11, 0, 0);
+	EXPECT_EQ(pInterest->FindMob(11, 0, 0), Mob);
+	EXPECT_FALSE(pInterest->IsActive(Mob, 1));
+
+	// bad client IDs are ignored
+	pInterest->Accept(Mob, -1);
+	pInterest->Accept(Mob, MAX_PLAYERS);
+	EXPECT_TRUE(pInterest->Active(Mob).none());
+	EXPECT_TRUE(pInterest->Mobs(MAX_PLAYERS).empty());
+}
+
+TEST(QuestMobInterest, Fuzz)
+{
+	// the former per mob arrays are the reference
+	const int NumMobs = 16;
+	auto pInterest = std::make_unique<CQuestMobInterest>();
+	bool aaActive[NumMobs][MAX_PLAYERS] {};
+	bool aaComplete[NumMobs][MAX_PLAYERS] {};
+	for(int m = 0; m < NumMobs; m++)
+		pInterest->AddMob(MAX_PLAYERS + m, 1, m, 0);
+
+	std::mt19937 Rng(50);
+	for(int Step = 0; Step < 20000; Step++)
+	{
+		const int m = Rng() % NumMobs;
+		const int ClientID = Rng() % MAX_PLAYERS;
+		const int MobID = MAX_PLAYERS + m;
+		switch(Rng() % 5)
+		{
+		case 0:
+		case 1:
+			pInterest->Accept(MobID, ClientID);
+			aaActive[m][ClientID] = true;
+			aaComplete[m][ClientID] = false;
+			break;
+		case 2:
+			pInterest->Defeat(MobID, ClientID);
+			aaComplete[m][ClientID] = aaActive[m][ClientID];
+			break;
+		case 3:
+		{
+			aaActive[m][ClientID] = aaComplete[m][ClientID] = false;
+			bool Empty = true;
+			for(bool Active : aaActive[m])
+				Empty = Empty && !Active;
+			ASSERT_EQ(pInterest->Finish(MobID, ClientID), Empty);
+			break;
+		}
+		case 4:
+			if(Step % 20 == 0)
+			{
+				pInterest->Abandon(ClientID);
+				for(int Other = 0; Other < NumMobs; Other++)
+					aaActive[Other][ClientID] = aaComplete[Other][ClientID] = false;
+			}
+			break;
+		}
+
+		for(int c = 0; c < MAX_PLAYERS; c++)
+		{
+			std::vector<int> vExpected;
+			for(int Other = 0; Other < NumMobs; Other++)
+			{
+				ASSERT_EQ(pInterest->IsActive(MAX_PLAYERS + Other, c), aaActive[Other][c]);
+				ASSERT_EQ(pInterest->IsComplete(MAX_PLAYERS + Other, c), aaComplete[Other][c]);
+				if(aaActive[Other][c])
+					vExpected.push_back(MAX_PLAYERS + Other);
+			}
+			ASSERT_EQ(pInterest->Mobs(c), vExpected);
+		}
+	}
+}
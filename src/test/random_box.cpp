@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <game/server/core/components/Inventory/RandomBox/RandomBoxData.h>
+
+#include <random>
+
+class CTestRandom
+{
+	std::mt19937 m_Rng;
+	std::uniform_real_distribution<float> m_Dist {0.0f, 1.0f};
+
+public:
+	explicit CTestRandom(unsigned Seed) : m_Rng(Seed) {}
+	float operator()() { return m_Dist(m_Rng); }
+};
+
+// Pearson's chi-squared statistic of the observed counts against the weights
+static double ChiSquared(const std::vector<int>& vCounts, const std::vector<float>& vWeights, int Draws)
+{
+	double Total = 0.0;
+	for(float Weight : vWeights)
+		Total += Weight;
+
+	double Chi = 0.0;
+	for(size_t i = 0; i < vWeights.size(); i++)
+	{
+		const double Expected = Draws * vWeights[i] / Total;
+		if(Expected > 0.0)
+			Chi += (vCounts[i] - Expected) * (vCounts[i] - Expected) / Expected;
+		else
+			EXPECT_EQ(vCounts[i], 0) << "weightless column " << i << " was drawn";
+	}
+	return Chi;
+}
+
+TEST(RandomBox, AliasTableDistribution)
+{
+	// chi-squared critical values at p = 0.001 for 3, 5 and 7 degrees of freedom
+	const std::vector<std::pair<std::vector<float>, double>> vCases = {
+		{{25.0f, 25.0f, 25.0f, 25.0f}, 16.27},
+		{{0.5f, 2.0f, 10.0f, 30.0f, 57.5f, 0.0f}, 20.52},
+		{{100.0f, 1.0f, 0.1f, 3.0f, 100.0f, 7.0f, 40.0f, 0.01f}, 24.32},
+	};
+
+	const int Draws = 400000;
+	unsigned Seed = 1;
+	for(const auto& [vWeights, Critical] : vCases)
+	{
+		CAliasTable Table;
+		Table.Build(vWeights);
+		ASSERT_EQ(Table.Size(), (int)vWeights.size());
+
+		CTestRandom Random(Seed++);
+		std::vector<int> vCounts(vWeights.size(), 0);
+		for(int i = 0; i < Draws; i++)
+			vCounts[Table.Draw(Random)]++;
+		EXPECT_LT(ChiSquared(vCounts, vWeights, Draws), Critical);
+	}
+
+	CAliasTable Empty;
+	Empty.Build({0.0f, 0.0f});
+	EXPECT_TRUE(Empty.IsEmpty());
+}
+
+TEST(RandomBox, RollMergesItems)
+{
+	// the same item twice with different amounts, merged into one grant
+	CRandomBox Box {CRandomItem(10, 1, 60.0f), CRandomItem(20, 5, 30.0f), CRandomItem(10, 3, 10.0f)};
+	CTestRandom Random(7);
+
+	const int Boxes = 100000;
+	const auto vReceived = Box.Roll(Boxes, Random);
+	ASSERT_EQ(vReceived.size(), 2u);
+	EXPECT_EQ(vReceived[0].m_Item.m_ItemID, 10);
+	EXPECT_EQ(vReceived[1].m_Item.m_ItemID, 20);
+	EXPECT_EQ(vReceived[0].m_Coincidences + vReceived[1].m_Coincidences, Boxes);
+	EXPECT_EQ(vReceived[1].m_Item.m_Value, vReceived[1].m_Coincidences * 5);
+
+	// 70% of the boxes give item 10, at 1 or 3 per box
+	EXPECT_NEAR(vReceived[0].m_Coincidences / (double)Boxes, 0.7, 0.01);
+	EXPECT_NEAR(vReceived[0].m_Item.m_Value / (double)Boxes, 0.6 + 0.3, 0.02);
+
+	// without any chance the last item is given, as before
+	CRandomBox Fallback {CRandomItem(1, 1, 0.0f), CRandomItem(2, 1, 0.0f)};
+	EXPECT_EQ(Fallback.Draw(Random).m_ItemID, 2);
+}
+
+TEST(RandomBox, Benchmark)
+{
+	// the former draw: one roll per entry in the order of the chances
+	std::vector<CRandomItem> vItems;
+	for(int i = 0; i < 16; i++)
+		vItems.emplace_back(i, 1, 1.0f + i * 2.0f);
+	CRandomBox Box;
+	for(const auto& Item : vItems)
+		Box.Add(Item);
+
+	const int Draws = 1000000;
+	CTestRandom Random(3);
+	int Sum = 0;
+	int64_t Start = time_get();
+	for(int i = 0; i < Draws; i++)
+	{
+		const auto Iter = std::find_if(vItems.begin(), vItems.end(), [&Random](const CRandomItem& Item) { return Random() * 100.0f < Item.m_Chance; });
+		Sum += Iter != vItems.end() ? Iter->m_ItemID : vItems.back().m_ItemID;
+	}
+	const int64_t Reference = time_get() - Start;
+
+	Start = time_get();
+	for(int i = 0; i < Draws; i++)
+		Sum += Box.Draw(Random).m_ItemID;
+	const int64_t Current = time_get() - Start;
+
+	EXPECT_GT(Sum, 0);
+	printf("random box %d items: reference %.1fns, current %.1fns per draw\n", (int)vItems.size(),
+		Reference * 1000000000.0 / time_freq() / Draws, Current * 1000000000.0 / time_freq() / Draws);
+}
@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/shared/snapshot.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// plain scalar delta with linear key lookups, the reference for the delta format
+static int ReferenceCreateDelta(const short *pItemSizes, const CSnapshot *pFrom, const CSnapshot *pTo, void *pDstData)
+{
+	CSnapshotDelta::CData *pDelta = (CSnapshotDelta::CData *)pDstData;
+	int *pData = (int *)pDelta->m_aData;
+
+	pDelta->m_NumDeletedItems = 0;
+	pDelta->m_NumUpdateItems = 0;
+	pDelta->m_NumTempItems = 0;
+
+	for(int i = 0; i < pFrom->NumItems(); i++)
+	{
+		const CSnapshotItem *pFromItem = pFrom->GetItem(i);
+		if(pTo->GetItemIndex(pFromItem->Key()) == -1)
+		{
+			pDelta->m_NumDeletedItems++;
+			*pData++ = pFromItem->Key();
+		}
+	}
+
+	for(int i = 0; i < pTo->NumItems(); i++)
+	{
+		const int ItemSize = pTo->GetItemSize(i);
+		const int NumInts = ItemSize / sizeof(int32_t);
+		const CSnapshotItem *pCurItem = pTo->GetItem(i);
+		const int PastIndex = pFrom->GetItemIndex(pCurItem->Key());
+		const bool IncludeSize = pCurItem->Type() >= 64 || !pItemSizes[pCurItem->Type()];
+
+		if(PastIndex != -1)
+		{
+			const int *pPast = pFrom->GetItem(PastIndex)->Data();
+			int *pItemDataDst = pData + (IncludeSize ? 3 : 2);
+			int Needed = 0;
+			for(int d = 0; d < NumInts; d++)
+			{
+				pItemDataDst[d] = (unsigned)pCurItem->Data()[d] - (unsigned)pPast[d];
+				Needed |= pItemDataDst[d];
+			}
+			if(Needed)
+			{
+				*pData++ = pCurItem->Type();
+				*pData++ = pCurItem->ID();
+				if(IncludeSize)
+					*pData++ = NumInts;
+				pData += NumInts;
+				pDelta->m_NumUpdateItems++;
+			}
+		}
+		else
+		{
+			*pData++ = pCurItem->Type();
+			*pData++ = pCurItem->ID();
+			if(IncludeSize)
+				*pData++ = NumInts;
+			mem_copy(pData, pCurItem->Data(), ItemSize);
+			pData += NumInts;
+			pDelta->m_NumUpdateItems++;
+		}
+	}
+
+	if(!pDelta->m_NumDeletedItems && !pDelta->m_NumUpdateItems)
+		return 0;
+	return (int)((char *)pData - (char *)pDstData);
+}
+
+class CSnapshotFuzzer
+{
+public:
+	struct CItem
+	{
+		int m_Type;
+		int m_ID;
+		std::vector<int> m_vData;
+	};
+
+	std::mt19937 m_Rng;
+	short m_aItemSizes[64];
+
+	CSnapshotFuzzer(unsigned Seed) :
+		m_Rng(Seed)
+	{
+		mem_zero(m_aItemSizes, sizeof(m_aItemSizes));
+		for(int Type = 1; Type < 16; Type++)
+			m_aItemSizes[Type] = (short)(((Type % 7) + 1) * sizeof(int32_t));
+	}
+
+	int Random(int Min, int Max) { return std::uniform_int_distribution<int>(Min, Max)(m_Rng); }
+
+	std::vector<CItem> RandomItems(int Num)
+	{
+		std::vector<CItem> vItems;
+		for(int i = 0; i < Num; i++)
+		{
+			CItem Item;
+			Item.m_Type = Random(1, 24);
+			Item.m_ID = i;
+			const int Size = Item.m_Type < 16 ? m_aItemSizes[Item.m_Type] / (int)sizeof(int32_t) : Random(0, 22);
+			for(int d = 0; d < Size; d++)
+				Item.m_vData.push_back(Random(INT_MIN, INT_MAX));
+			vItems.push_back(Item);
+		}
+		return vItems;
+	}
+
+	void Mutate(std::vector<CItem> &vItems)
+	{
+		for(auto &Item : vItems)
+		{
+			if(Random(0, 3) != 0)
+				continue;
+			for(auto &Value : Item.m_vData)
+				if(Random(0, 2) == 0)
+					Value = (int)((unsigned)Value + Random(-5, 5));
+		}
+		// drop and add some items, keeping ids unique
+		for(int i = Random(0, 4); i > 0 && !vItems.empty(); i--)
+			vItems.erase(vItems.begin() + Random(0, (int)vItems.size() - 1));
+		std::vector<CItem> vNew = RandomItems(Random(0, 4));
+		for(auto &Item : vNew)
+		{
+			Item.m_ID = 1000 + Random(0, 60000);
+			bool Exists = false;
+			for(const auto &Other : vItems)
+				Exists |= Other.m_Type == Item.m_Type && Other.m_ID == Item.m_ID;
+			if(!Exists)
+				vItems.push_back(Item);
+		}
+		std::shuffle(vItems.begin(), vItems.end(), m_Rng);
+	}
+
+	static int Build(const std::vector<CItem> &vItems, char *pBuf)
+	{
+		CSnapshotBuilder Builder;
+		Builder.Init();
+		for(const auto &Item : vItems)
+		{
+			void *pData = Builder.NewItem(Item.m_Type, Item.m_ID, Item.m_vData.size() * sizeof(int32_t));
+			if(pData && !Item.m_vData.empty())
+				mem_copy(pData, Item.m_vData.data(), Item.m_vData.size() * sizeof(int32_t));
+		}
+		return Builder.Finish(pBuf);
+	}
+};
+
+TEST(SnapshotDelta, DiffItem)
+{
+	for(int Size = 0; Size < 40; Size++)
+	{
+		std::vector<int> vPast(Size), vCurrent(Size), vOut(Size + 1, 0x55);
+		for(int i = 0; i < Size; i++)
+		{
+			vPast[i] = INT_MAX - i;
+			vCurrent[i] = vPast[i];
+		}
+		EXPECT_EQ(CSnapshotDelta::DiffItem(vPast.data(), vCurrent.data(), vOut.data(), Size), 0);
+
+		if(Size > 0)
+		{
+			vCurrent[Size - 1] = INT_MIN;
+			EXPECT_NE(CSnapshotDelta::DiffItem(vPast.data(), vCurrent.data(), vOut.data(), Size), 0);
+			EXPECT_EQ(vOut[Size - 1], (int)((unsigned)INT_MIN - (unsigned)vPast[Size - 1]));
+		}
+		EXPECT_EQ(vOut[Size], 0x55);
+	}
+}
+
+TEST(SnapshotDelta, FuzzIdenticalToReference)
+{
+	CSnapshotFuzzer Fuzzer(1337);
+	CSnapshotDelta Delta;
+	for(int Type = 0; Type < 64; Type++)
+		Delta.SetStaticsize(Type, Fuzzer.m_aItemSizes[Type]);
+
+	static char s_aFrom[CSnapshot::MAX_SIZE], s_aTo[CSnapshot::MAX_SIZE];
+	static char s_aDelta[CSnapshot::MAX_SIZE], s_aRefDelta[CSnapshot::MAX_SIZE];
+
+	for(int Round = 0; Round < 200; Round++)
+	{
+		std::vector<CSnapshotFuzzer::CItem> vItems = Fuzzer.RandomItems(Fuzzer.Random(0, 300));
+		CSnapshotFuzzer::Build(vItems, s_aFrom);
+		for(int Step = 0; Step < 5; Step++)
+		{
+			Fuzzer.Mutate(vItems);
+			CSnapshotFuzzer::Build(vItems, s_aTo);
+
+			const int Size = Delta.CreateDelta((CSnapshot *)s_aFrom, (CSnapshot *)s_aTo, s_aDelta);
+			const int RefSize = ReferenceCreateDelta(Fuzzer.m_aItemSizes, (CSnapshot *)s_aFrom, (CSnapshot *)s_aTo, s_aRefDelta);
+			ASSERT_EQ(Size, RefSize);
+			ASSERT_EQ(mem_comp(s_aDelta, s_aRefDelta, Size), 0);
+
+			// the delta must also apply back to the target
+			static char s_aUnpacked[CSnapshot::MAX_SIZE];
+			if(Size)
+			{
+				const int UnpackedSize = Delta.UnpackDelta((CSnapshot *)s_aFrom, (CSnapshot *)s_aUnpacked, s_aDelta, Size);
+				ASSERT_GE(UnpackedSize, 0);
+				EXPECT_EQ(((CSnapshot *)s_aUnpacked)->NumItems(), ((CSnapshot *)s_aTo)->NumItems());
+			}
+		}
+	}
+}
+
+TEST(SnapshotDelta, Benchmark)
+{
+	// player sized items moving a little each tick, like a busy world
+	CSnapshotFuzzer Fuzzer(42);
+	CSnapshotDelta Delta;
+	for(int Type = 0; Type < 64; Type++)
+		Delta.SetStaticsize(Type, Fuzzer.m_aItemSizes[Type]);
+
+	static char s_aFrom[CSnapshot::MAX_SIZE], s_aTo[CSnapshot::MAX_SIZE];
+	static char s_aDelta[CSnapshot::MAX_SIZE];
+	std::vector<CSnapshotFuzzer::CItem> vItems = Fuzzer.RandomItems(600);
+	CSnapshotFuzzer::Build(vItems, s_aFrom);
+	Fuzzer.Mutate(vItems);
+	CSnapshotFuzzer::Build(vItems, s_aTo);
+
+	const int Iterations = 200;
+	int64_t Start = time_get();
+	for(int i = 0; i < Iterations; i++)
+		ReferenceCreateDelta(Fuzzer.m_aItemSizes, (CSnapshot *)s_aFrom, (CSnapshot *)s_aTo, s_aDelta);
+	const int64_t Reference = time_get() - Start;
+
+	Start = time_get();
+	for(int i = 0; i < Iterations; i++)
+		Delta.CreateDelta((CSnapshot *)s_aFrom, (CSnapshot *)s_aTo, s_aDelta);
+	const int64_t Current = time_get() - Start;
+
+	printf("CreateDelta %d items: reference %.2fus, current %.2fus per call\n", ((CSnapshot *)s_aTo)->NumItems(),
+		Reference * 1000000.0 / time_freq() / Iterations, Current * 1000000.0 / time_freq() / Iterations);
+}
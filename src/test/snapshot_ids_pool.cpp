@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/server/snapshot_ids_pool.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+struct CTestBlock
+{
+	int m_ID;
+	int m_Num;
+};
+
+// blocks never overlap each other or the single IDs
+static void ExpectDisjoint(const std::vector<CTestBlock>& vBlocks)
+{
+	std::vector<bool> vOwned(CSnapIDPool::MAX_IDS, false);
+	for(const auto& Block : vBlocks)
+	{
+		ASSERT_GE(Block.m_ID, (int)CSnapIDPool::FIRST_BLOCK_ID);
+		ASSERT_LE(Block.m_ID + Block.m_Num, (int)CSnapIDPool::MAX_IDS);
+		for(int i = 0; i < Block.m_Num; i++)
+		{
+			ASSERT_FALSE(vOwned[Block.m_ID + i]) << "id " << Block.m_ID + i;
+			vOwned[Block.m_ID + i] = true;
+		}
+	}
+}
+
+TEST(SnapIDPool, BlocksExhaustAndMerge)
+{
+	auto pPool = std::make_unique<CSnapIDPool>();
+
+	// the block space is used up by blocks of any size
+	for(int Num : {1, 3, 4, 24, 64})
+	{
+		int Size = 1;
+		while(Size < Num)
+			Size *= 2;
+
+		std::vector<CTestBlock> vBlocks;
+		for(int ID; (ID = pPool->NewIDBlock(Num)) >= 0;)
+			vBlocks.push_back({ID, Num});
+		ASSERT_EQ((int)vBlocks.size(), CSnapIDPool::BLOCK_IDS / Size) << "num " << Num;
+		ASSERT_EQ(pPool->BlockUsage(), (int)CSnapIDPool::BLOCK_IDS);
+		ExpectDisjoint(vBlocks);
+
+		// freed blocks are not reused before they time out
+		for(const auto& Block : vBlocks)
+			pPool->FreeIDBlock(Block.m_ID);
+		EXPECT_EQ(pPool->NewIDBlock(1), -1);
+		EXPECT_EQ(pPool->BlockUsage(), (int)CSnapIDPool::BLOCK_IDS);
+
+		// and merge back into the whole space once they do
+		pPool->TimeoutIDs();
+		EXPECT_EQ(pPool->BlockUsage(), 0);
+		const int Whole = pPool->NewIDBlock(CSnapIDPool::BLOCK_IDS);
+		ASSERT_EQ(Whole, (int)CSnapIDPool::FIRST_BLOCK_ID);
+		pPool->FreeIDBlock(Whole);
+		pPool->TimeoutIDs();
+	}
+
+	EXPECT_EQ(pPool->NewIDBlock(0), -1);
+	EXPECT_EQ(pPool->NewIDBlock(CSnapIDPool::BLOCK_IDS + 1), -1);
+
+	// single IDs stay below the block space
+	for(int i = 0; i < 1000; i++)
+		ASSERT_LT(pPool->NewID(), (int)CSnapIDPool::FIRST_BLOCK_ID);
+}
+
+TEST(SnapIDPool, Stress)
+{
+	auto pPool = std::make_unique<CSnapIDPool>();
+	std::mt19937 Rng(49);
+	std::uniform_int_distribution<int> RandNum(1, 48), RandOp(0, 2);
+
+	std::vector<CTestBlock> vLive;
+	std::vector<int> vTimed;
+	int Failed = 0;
+	for(int Step = 0; Step < 50000; Step++)
+	{
+		const int Op = RandOp(Rng);
+		if(Op < 2 || vLive.empty())
+		{
+			const int Num = RandNum(Rng);
+			const int ID = pPool->NewIDBlock(Num);
+			if(ID < 0)
+			{
+				Failed++;
+				continue;
+			}
+
+			// a block waiting for its timeout is never handed out again
+			for(int Timed : vTimed)
+				ASSERT_NE(ID, Timed);
+			vLive.push_back({ID, Num});
+		}
+		else
+		{
+			const size_t Index = Rng() % vLive.size();
+			pPool->FreeIDBlock(vLive[Index].m_ID);
+			vTimed.push_back(vLive[Index].m_ID);
+			vLive[Index] = vLive.back();
+			vLive.pop_back();
+		}
+
+		if(Step % 500 == 0)
+		{
+			ExpectDisjoint(vLive);
+			if(HasFatalFailure())
+				return;
+		}
+		if(Step % 5000 == 0)
+		{
+			pPool->TimeoutIDs();
+			vTimed.clear();
+		}
+	}
+	ExpectDisjoint(vLive);
+	EXPECT_GT(Failed, 0);
+
+	// everything freed comes back as the whole space
+	for(const auto& Block : vLive)
+		pPool->FreeIDBlock(Block.m_ID);
+	pPool->TimeoutIDs();
+	EXPECT_EQ(pPool->BlockUsage(), 0);
+	EXPECT_EQ(pPool->NewIDBlock(CSnapIDPool::BLOCK_IDS), (int)CSnapIDPool::FIRST_BLOCK_ID);
+}
+
+TEST(SnapIDPool, Benchmark)
+{
+	// the former way: every particle of an effect takes and frees its own ID
+	const int Particles = 8, Effects = 512, Runs = 200;
+	auto pPool = std::make_unique<CSnapIDPool>();
+	std::vector<int> vIDs(Effects * Particles);
+
+	int64_t Start = time_get();
+	for(int r = 0; r < Runs; r++)
+	{
+		for(int& ID : vIDs)
+			ID = pPool->NewID();
+		for(int ID : vIDs)
+			pPool->FreeID(ID);
+		pPool->TimeoutIDs();
+	}
+	const int64_t Reference = time_get() - Start;
+
+	Start = time_get();
+	for(int r = 0; r < Runs; r++)
+	{
+		for(int e = 0; e < Effects; e++)
+			vIDs[e] = pPool->NewIDBlock(Particles);
+		for(int e = 0; e < Effects; e++)
+			pPool->FreeIDBlock(vIDs[e]);
+		pPool->TimeoutIDs();
+	}
+	const int64_t Current = time_get() - Start;
+
+	EXPECT_EQ(pPool->BlockUsage(), 0);
+	printf("snap ids %d particles: reference %.1fns, current %.1fns per effect\n", Particles,
+		Reference * 1000000000.0 / time_freq() / Runs / Effects, Current * 1000000000.0 / time_freq() / Runs / Effects);
+}
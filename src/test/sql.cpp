@@ -0,0 +1,210 @@
+#include "test.h"
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+#include <engine/server/sql_backend.h>
+
+#if defined(CONF_SQLITE)
+
+static const char *s_pDump =
+	"-- phpMyAdmin SQL Dump\n"
+	"SET SQL_MODE = \"NO_AUTO_VALUE_ON_ZERO\";\n"
+	"START TRANSACTION;\n"
+	"/*!40101 SET NAMES utf8mb4 */;\n"
+	"CREATE TABLE `tw_accounts_items` (\n"
+	"  `ID` int(11) NOT NULL,\n"
+	"  `ItemID` int(11) NOT NULL,\n"
+	"  `Value` int(11) NOT NULL DEFAULT 0,\n"
+	"  `Settings` int(11) unsigned NOT NULL DEFAULT 0,\n"
+	"  `Enchant` int(11) NOT NULL DEFAULT 0,\n"
+	"  `Durability` int(11) NOT NULL DEFAULT 100,\n"
+	"  `UserID` int(11) NOT NULL\n"
+	") ENGINE=InnoDB DEFAULT CHARSET=utf8mb4;\n"
+	"CREATE TABLE `tw_items_list` (\n"
+	"  `ID` int(11) NOT NULL,\n"
+	"  `Name` varchar(32) CHARACTER SET utf8mb4 COLLATE utf8mb4_general_ci NOT NULL DEFAULT 'Item name',\n"
+	"  `Description` varchar(64) NOT NULL,\n"
+	"  `Emote` enum('Pain','Happy','Blink') DEFAULT NULL,\n"
+	"  `Time` datetime NOT NULL DEFAULT current_timestamp() ON UPDATE current_timestamp()\n"
+	") ENGINE=InnoDB DEFAULT CHARSET=latin1;\n"
+	"INSERT INTO `tw_items_list` (`ID`, `Name`, `Description`, `Emote`) VALUES\n"
+	"(1, 'Gold', 'Won\\'t get wet; a \\\\ path', 'Happy'),\n"
+	"(2, 'Skin', '{\\\"color\\\":2555648}', NULL);\n"
+	"ALTER TABLE `tw_accounts_items`\n"
+	"  ADD PRIMARY KEY (`ID`),\n"
+	"  ADD UNIQUE KEY `ItemUser` (`ItemID`,`UserID`),\n"
+	"  ADD KEY `UserID` (`UserID`);\n"
+	"ALTER TABLE `tw_items_list`\n"
+	"  ADD PRIMARY KEY (`ID`);\n"
+	"ALTER TABLE `tw_accounts_items`\n"
+	"  MODIFY `ID` int(11) NOT NULL AUTO_INCREMENT, AUTO_INCREMENT=1;\n"
+	"ALTER TABLE `tw_accounts_items`\n"
+	"  ADD CONSTRAINT `fk_item` FOREIGN KEY (`ItemID`) REFERENCES `tw_items_list` (`ID`) ON DELETE CASCADE;\n"
+	"COMMIT;\n";
+
+static std::unique_ptr<ISqlBackend> OpenDump(const char *pFilename, const char *pDump)
+{
+	IOHANDLE File = io_open(pFilename, IOFLAG_WRITE);
+	if(!File)
+		return nullptr;
+	io_write(File, pDump, str_length(pDump));
+	io_close(File);
+
+	std::unique_ptr<ISqlBackend> pBackend(CreateSqlBackendSqlite("", pFilename));
+	fs_remove(pFilename);
+	return pBackend;
+}
+
+TEST(Sql, SqliteImportsDump)
+{
+	CTestInfo Info;
+	auto pBackend = OpenDump(Info.m_aFilename, s_pDump);
+	ASSERT_TRUE(pBackend);
+	std::unique_ptr<ISqlConnection> pConnection(pBackend->Connect());
+
+	auto pRes = pConnection->ExecuteQuery("SELECT * FROM tw_items_list ORDER BY ID");
+	ASSERT_EQ(pRes->rowsCount(), 2u);
+	ASSERT_TRUE(pRes->next());
+	EXPECT_EQ(pRes->getRow(), 1u);
+	EXPECT_EQ(pRes->getInt("ID"), 1);
+	EXPECT_EQ(pRes->getString("name"), "Gold");
+	EXPECT_EQ(pRes->getString("Description"), "Won't get wet; a \\ path");
+	EXPECT_EQ(pRes->getString("Emote"), "Happy");
+	EXPECT_FALSE(pRes->getString("Time").empty());
+	ASSERT_TRUE(pRes->next());
+	EXPECT_EQ(pRes->getString("Description"), "{\"color\":2555648}");
+	EXPECT_TRUE(pRes->isNull("Emote"));
+	EXPECT_FALSE(pRes->next());
+	EXPECT_THROW(pRes->getInt("ID"), CSqlException);
+
+	// keys from the trailing ALTER TABLE statements
+	pConnection->Execute("INSERT INTO tw_accounts_items (ItemID, UserID, Value) VALUES ('1', '7', '10')");
+	EXPECT_THROW(pConnection->Execute("INSERT INTO tw_accounts_items (ItemID, UserID) VALUES (1, 7)"), CSqlException);
+	pRes = pConnection->ExecuteQuery("SELECT ID, Durability FROM tw_accounts_items WHERE UserID = '7'");
+	ASSERT_TRUE(pRes->next());
+	EXPECT_EQ(pRes->getInt("ID"), 1);
+	EXPECT_EQ(pRes->getInt("Durability"), 100);
+
+	// runtime queries use mysql escaping too
+	pConnection->Execute("UPDATE tw_items_list SET Name = 'It\\'s \\\"new\\\"' WHERE ID = '2'");
+	pRes = pConnection->ExecuteQuery("SELECT Name FROM tw_items_list WHERE ID = 2");
+	ASSERT_TRUE(pRes->next());
+	EXPECT_EQ(pRes->getString("Name"), "It's \"new\"");
+}
+
+TEST(Sql, SqliteSharedMemoryConnections)
+{
+	CTestInfo Info;
+	auto pBackend = OpenDump(Info.m_aFilename, s_pDump);
+	ASSERT_TRUE(pBackend);
+	std::unique_ptr<ISqlConnection> pFirst(pBackend->Connect());
+	std::unique_ptr<ISqlConnection> pSecond(pBackend->Connect());
+
+	pFirst->Execute("INSERT INTO tw_accounts_items (ItemID, UserID, Value) VALUES (2, 3, 4)");
+	auto pRes = pSecond->ExecuteQuery("SELECT Value FROM tw_accounts_items WHERE ItemID = 2 AND UserID = 3");
+	ASSERT_TRUE(pRes->next());
+	EXPECT_EQ(pRes->getInt("Value"), 4);
+}
+
+// inventory saves as done by CPlayerItem::Save, formatted against prepared
+TEST(Sql, SqliteInventorySaveLoad)
+{
+	CTestInfo Info;
+	auto pBackend = OpenDump(Info.m_aFilename, s_pDump);
+	ASSERT_TRUE(pBackend);
+	std::unique_ptr<ISqlConnection> pConnection(pBackend->Connect());
+
+	const int NumUsers = 20;
+	const int NumItems = 50;
+	const int Rounds = 4;
+
+	int64_t Start = time_get();
+	for(int Round = 0; Round < Rounds; Round++)
+	{
+		for(int User = 0; User < NumUsers; User++)
+		{
+			for(int Item = 0; Item < NumItems; Item++)
+			{
+				char aBuf[256];
+				str_format(aBuf, sizeof(aBuf), "SELECT ItemID FROM tw_accounts_items WHERE ItemID = '%d' AND UserID = '%d'", Item, User);
+				if(pConnection->ExecuteQuery(aBuf)->next())
+					str_format(aBuf, sizeof(aBuf), "UPDATE tw_accounts_items SET Value = '%d' WHERE ItemID = '%d' AND UserID = '%d'", Round, Item, User);
+				else
+					str_format(aBuf, sizeof(aBuf), "INSERT INTO tw_accounts_items (ItemID, UserID, Value) VALUES ('%d', '%d', '%d')", Item, User, Round);
+				pConnection->Execute(aBuf);
+			}
+		}
+	}
+	const int64_t Formatted = time_get() - Start;
+
+	auto pSelect = pConnection->Prepare("SELECT ItemID FROM tw_accounts_items WHERE ItemID = ? AND UserID = ?");
+	auto pUpdate = pConnection->Prepare("UPDATE tw_accounts_items SET Value = ? WHERE ItemID = ? AND UserID = ?");
+	Start = time_get();
+	for(int Round = 0; Round < Rounds; Round++)
+	{
+		for(int User = 0; User < NumUsers; User++)
+		{
+			for(int Item = 0; Item < NumItems; Item++)
+			{
+				pSelect->SetInt(1, Item);
+				pSelect->SetInt(2, User);
+				ASSERT_TRUE(pSelect->ExecuteQuery()->next());
+				pUpdate->SetInt(1, Rounds + Round);
+				pUpdate->SetInt(2, Item);
+				pUpdate->SetInt(3, User);
+				pUpdate->Execute();
+			}
+		}
+	}
+	const int64_t Prepared = time_get() - Start;
+
+	auto pRes = pConnection->ExecuteQuery("SELECT COUNT(*) AS Num, MIN(Value) AS Low, MAX(Value) AS High FROM tw_accounts_items");
+	ASSERT_TRUE(pRes->next());
+	EXPECT_EQ(pRes->getInt("Num"), NumUsers * NumItems);
+	EXPECT_EQ(pRes->getInt("Low"), Rounds * 2 - 1);
+	EXPECT_EQ(pRes->getInt("High"), Rounds * 2 - 1);
+
+	const int Saves = Rounds * NumUsers * NumItems;
+	printf("sqlite inventory saves: formatted %.1fus, prepared %.1fus per save\n",
+		Formatted * 1000000.0 / time_freq() / Saves, Prepared * 1000000.0 / time_freq() / Saves);
+}
+
+TEST(Sql, SqliteImportsProjectDump)
+{
+	// the test binary usually runs from a build directory next to the dump
+	const char *apPaths[] = {"MRPG-database.sql", "../MRPG-database.sql", "../../MRPG-database.sql"};
+	const char *pPath = nullptr;
+	for(const char *pCandidate : apPaths)
+	{
+		if(fs_is_file(pCandidate))
+		{
+			pPath = pCandidate;
+			break;
+		}
+	}
+	if(!pPath)
+		return;
+
+	std::unique_ptr<ISqlBackend> pBackend(CreateSqlBackendSqlite("", pPath));
+	std::unique_ptr<ISqlConnection> pConnection(pBackend->Connect());
+
+	IOHANDLE File = io_open(pPath, IOFLAG_READ);
+	ASSERT_TRUE(File);
+	std::string Dump(io_length(File), '\0');
+	io_read(File, Dump.data(), Dump.size());
+	io_close(File);
+
+	int NumTables = 0;
+	for(size_t Pos = Dump.find("CREATE TABLE"); Pos != std::string::npos; Pos = Dump.find("CREATE TABLE", Pos + 1))
+		NumTables++;
+
+	auto pRes = pConnection->ExecuteQuery("SELECT COUNT(*) AS Num FROM sqlite_master WHERE type = 'table' AND name NOT LIKE 'sqlite_%'");
+	ASSERT_TRUE(pRes->next());
+	EXPECT_EQ(pRes->getInt("Num"), NumTables);
+
+	pRes = pConnection->ExecuteQuery("SELECT COUNT(*) AS Num FROM tw_items_list");
+	ASSERT_TRUE(pRes->next());
+	EXPECT_GT(pRes->getInt("Num"), 0);
+}
+
+#endif
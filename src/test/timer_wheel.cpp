@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <game/server/core/tools/timer_wheel.h>
+
+#include <random>
+#include <vector>
+
+struct CTestGrant
+{
+	int m_ID;
+	int64_t m_DueTick;
+};
+
+TEST(TimerWheel, FiresInOrderExactlyOnce)
+{
+	CTimerWheel<CTestGrant> Wheel;
+	std::mt19937 Rng(11);
+	std::uniform_int_distribution<int> Delay(-5, 3 * CTimerWheel<CTestGrant>::NUM_SLOTS), Step(1, 40);
+
+	std::vector<int> vFired;
+	std::vector<int64_t> vScheduledDue;
+	int64_t Tick = 1000;
+	int64_t LastDue = -1;
+	int NextID = 0;
+
+	auto Schedule = [&](int64_t Now) {
+		// overdue items fire with the next advance at the earliest
+		const int64_t Due = Now + Delay(Rng);
+		vScheduledDue.push_back(std::max(Due, Now + 1));
+		Wheel.Schedule(Due, {NextID++, std::max(Due, Now + 1)});
+	};
+
+	Wheel.Advance(Tick, [](CTestGrant&) { FAIL(); });
+	while(Tick < 20000)
+	{
+		for(int i = 0; i < 5; i++)
+			Schedule(Tick);
+
+		// mostly single ticks, sometimes a jump over more than a turn as after a stall
+		const int64_t Next = Tick + ((Tick % 97 == 0) ? 600 : Step(Rng) / 10 + 1);
+		LastDue = -1;
+		Wheel.Advance(Next, [&](CTestGrant& Grant) {
+			EXPECT_LE(Grant.m_DueTick, Next);
+			EXPECT_GT(Grant.m_DueTick, Tick);
+			EXPECT_GE(Grant.m_DueTick, LastDue);
+			LastDue = Grant.m_DueTick;
+			vFired.push_back(Grant.m_ID);
+
+			// scheduling from inside a grant lands in a later advance
+			if(Grant.m_ID % 50 == 0)
+				Schedule(Next);
+		});
+		Tick = Next;
+	}
+
+	const size_t Left = Wheel.Size();
+	Wheel.Drain([&](CTestGrant& Grant) { vFired.push_back(Grant.m_ID); });
+	EXPECT_EQ(Wheel.Size(), 0u);
+	EXPECT_GT(Left, 0u);
+
+	// every item exactly once
+	ASSERT_EQ(vFired.size(), (size_t)NextID);
+	std::vector<int> vSeen(NextID, 0);
+	for(int ID : vFired)
+		vSeen[ID]++;
+	for(int ID = 0; ID < NextID; ID++)
+		EXPECT_EQ(vSeen[ID], 1) << "item " << ID;
+}
+
+TEST(TimerWheel, SameTickKeepsScheduleOrder)
+{
+	CTimerWheel<CTestGrant> Wheel;
+	Wheel.Advance(10, [](CTestGrant&) {});
+	Wheel.Schedule(10 + CTimerWheel<CTestGrant>::NUM_SLOTS, {0, 0});
+	for(int i = 1; i <= 5; i++)
+		Wheel.Schedule(12, {i, 12});
+	Wheel.Schedule(11, {6, 11});
+
+	std::vector<int> vFired;
+	Wheel.Advance(12, [&](CTestGrant& Grant) { vFired.push_back(Grant.m_ID); });
+	EXPECT_EQ(vFired, (std::vector<int> {6, 1, 2, 3, 4, 5}));
+
+	// the item a full turn away shares the slot of tick 10 but waits for its own turn
+	vFired.clear();
+	Wheel.Advance(10 + CTimerWheel<CTestGrant>::NUM_SLOTS - 1, [&](CTestGrant& Grant) { vFired.push_back(Grant.m_ID); });
+	EXPECT_TRUE(vFired.empty());
+	Wheel.Advance(10 + CTimerWheel<CTestGrant>::NUM_SLOTS, [&](CTestGrant& Grant) { vFired.push_back(Grant.m_ID); });
+	EXPECT_EQ(vFired, (std::vector<int> {0}));
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <engine/server/world_dormancy.h>
+
+static const int TICK_SPEED = 50;
+static const int DELAY = 10 * TICK_SPEED;
+
+// the two kinds of timers a world has: absolute respawn deadlines and per tick countdowns
+class CTestWorld
+{
+public:
+	CWorldDormancy m_Dormancy;
+	int m_Ticked = 0;
+	bool m_MobAlive = true;
+	int m_MobRespawnTick = 0;
+	int m_EffectTicks = 0;
+
+	void ServerTick(int Tick, bool HasPlayers)
+	{
+		if(!m_Dormancy.Update(Tick, HasPlayers, DELAY))
+			return;
+
+		m_Dormancy.TakeCatchUp();
+		m_Ticked++;
+		if(!m_MobAlive && Tick >= m_MobRespawnTick)
+			m_MobAlive = true;
+		if(m_EffectTicks > 0)
+			m_EffectTicks--;
+	}
+};
+
+TEST(WorldDormancy, SleepsAfterDelay)
+{
+	CWorldDormancy Dormancy;
+	EXPECT_TRUE(Dormancy.Update(0, true, DELAY));
+	EXPECT_EQ(Dormancy.State(), CWorldDormancy::STATE_ACTIVE);
+
+	EXPECT_TRUE(Dormancy.Update(1, false, DELAY));
+	EXPECT_EQ(Dormancy.State(), CWorldDormancy::STATE_EMPTY);
+	EXPECT_TRUE(Dormancy.Update(DELAY, false, DELAY));
+	EXPECT_FALSE(Dormancy.Update(DELAY + 1, false, DELAY));
+	EXPECT_TRUE(Dormancy.IsDormant());
+	EXPECT_FALSE(Dormancy.Update(DELAY + 100, false, DELAY));
+
+	// a player connecting straight into the world wakes it without ChangeWorld
+	EXPECT_TRUE(Dormancy.Update(DELAY + 201, true, DELAY));
+	EXPECT_EQ(Dormancy.TakeCatchUp(), 200);
+	EXPECT_EQ(Dormancy.TakeCatchUp(), 0);
+	EXPECT_EQ(Dormancy.FrozenTicks(), 200);
+}
+
+TEST(WorldDormancy, ReturningPlayerCancelsSleep)
+{
+	CWorldDormancy Dormancy;
+	for(int Tick = 0; Tick < DELAY - 1; Tick++)
+		EXPECT_TRUE(Dormancy.Update(Tick, false, DELAY));
+	EXPECT_TRUE(Dormancy.Update(DELAY - 1, true, DELAY));
+	EXPECT_EQ(Dormancy.TakeCatchUp(), 0);
+
+	// the delay starts over once the world is empty again
+	EXPECT_TRUE(Dormancy.Update(DELAY, false, DELAY));
+	EXPECT_TRUE(Dormancy.Update(2 * DELAY - 1, false, DELAY));
+	EXPECT_FALSE(Dormancy.Update(2 * DELAY, false, DELAY));
+}
+
+TEST(WorldDormancy, DisabledNeverSleeps)
+{
+	CWorldDormancy Dormancy;
+	for(int Tick = 0; Tick < 100 * DELAY; Tick += 7)
+		EXPECT_TRUE(Dormancy.Update(Tick, false, 0));
+	EXPECT_EQ(Dormancy.FrozenTicks(), 0);
+}
+
+TEST(WorldDormancy, WakeMatchesRespawnAndTimerState)
+{
+	CTestWorld World;
+	World.m_EffectTicks = 800;
+
+	// the player kills a mob and leaves, its respawn falls into the dormant time
+	int Tick = 0;
+	for(; Tick < 100; Tick++)
+	{
+		if(Tick == 90)
+		{
+			World.m_MobAlive = false;
+			World.m_MobRespawnTick = Tick + 20 * TICK_SPEED;
+		}
+		World.ServerTick(Tick, true);
+	}
+	for(; Tick < 5000; Tick++)
+		World.ServerTick(Tick, false);
+
+	// ticked until the delay passed, then nothing ran
+	EXPECT_TRUE(World.m_Dormancy.IsDormant());
+	EXPECT_EQ(World.m_Ticked, 100 + DELAY);
+	EXPECT_FALSE(World.m_MobAlive);
+	EXPECT_EQ(World.m_EffectTicks, 800 - World.m_Ticked);
+
+	// ChangeWorld wakes the world, the catch-up comes with its next tick
+	World.m_Dormancy.Wake(Tick);
+	EXPECT_EQ(World.m_Dormancy.State(), CWorldDormancy::STATE_ACTIVE);
+	EXPECT_EQ(World.m_Dormancy.FrozenTicks(), Tick - (100 + DELAY));
+	World.ServerTick(Tick, true);
+
+	EXPECT_TRUE(World.m_MobAlive);
+	EXPECT_EQ(World.m_EffectTicks, 800 - World.m_Ticked);
+	EXPECT_EQ(World.m_Ticked, Tick - World.m_Dormancy.FrozenTicks() + 1);
+	EXPECT_EQ(World.m_Dormancy.TakeCatchUp(), 0);
+}